@@ -28,6 +28,9 @@ namespace crypto::cipher
 			static constexpr int block_size = AES<Nk, Nb, Nr>::block_size;
 
 		private:
+			template<typename Cipher>
+			friend class CTR_HMAC_SHA256;
+
 			byte w[4 * Nb * (Nr + 1)];
 		};
 
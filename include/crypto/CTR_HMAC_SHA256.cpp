@@ -0,0 +1,180 @@
+#include"CTR_HMAC_SHA256.h"
+#include<algorithm>
+#include<utils/bit.h>
+#include<utils/cpu.h>
+
+#if defined(utils_x86)
+#include<immintrin.h>
+#endif
+
+using namespace crypto;
+using utils::endian;
+using utils::byte_to_word;
+using utils::word_to_byte;
+
+namespace
+{
+#if defined(utils_x86)
+	//the 16 steps of 4 SHA-256 rounds of hashed, with the Nr rounds of AES of counter spread over them.
+	//the message words are loaded before out is written, so hashed and out may be the same block
+	template<int Nr, bool Aes, bool Sha>
+	__attribute__((target("aes,sha,sse4.1"), always_inline)) inline void stitched_block(const __m128i* round_key, const __m128i* counter, byte* out, const byte* hashed, __m128i& abef, __m128i& cdgh) noexcept
+	{
+		const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0b, 0x0405060700010203);
+		const __m128i abef_save = abef;
+		const __m128i cdgh_save = cdgh;
+		__m128i W[4] = {}, x[4] = {};
+
+		if (Sha)
+			for (int i = 0; i < 4; i++)
+				W[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hashed + i * 16)), mask);
+		if (Aes)
+			for (int k = 0; k < 4; k++)
+				x[k] = _mm_xor_si128(counter[k], round_key[0]);
+
+		for (int i = 0; i < 16; i++)
+		{
+			if (Sha)
+			{
+				if (i >= 4)
+					W[i % 4] = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(W[i % 4], W[(i + 1) % 4]), _mm_alignr_epi8(W[(i + 3) % 4], W[(i + 2) % 4], 4)), W[(i + 3) % 4]);
+
+				__m128i message = _mm_add_epi32(W[i % 4], _mm_load_si128(reinterpret_cast<const __m128i*>(hash::SHA256::K + i * 4)));
+				cdgh = _mm_sha256rnds2_epu32(cdgh, abef, message);
+				abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(message, 0x0e));
+			}
+
+			if (Aes && i < Nr - 1)
+				for (int k = 0; k < 4; k++)
+					x[k] = _mm_aesenc_si128(x[k], round_key[i + 1]);
+			else if (Aes && i == Nr - 1)
+				for (int k = 0; k < 4; k++)
+					x[k] = _mm_aesenclast_si128(x[k], round_key[Nr]);
+		}
+
+		if (Sha)
+		{
+			abef = _mm_add_epi32(abef, abef_save);
+			cdgh = _mm_add_epi32(cdgh, cdgh_save);
+		}
+		if (Aes)
+			for (int k = 0; k < 4; k++)
+			{
+				__m128i* p = reinterpret_cast<__m128i*>(out + k * 16);
+				_mm_storeu_si128(p, _mm_xor_si128(_mm_loadu_si128(p), x[k]));
+			}
+	}
+
+	//the four big-endian counter blocks of the next 64 bytes
+	__attribute__((target("sse4.1"), always_inline)) inline void next_counters(uint64_t& high, uint64_t& low, __m128i* counter) noexcept
+	{
+		for (int k = 0; k < 4; k++)
+		{
+			counter[k] = _mm_set_epi64x(__builtin_bswap64(low), __builtin_bswap64(high));
+			if (!++low)
+				high++;
+		}
+	}
+
+	//w holds the round keys, counter the next counter block and H the state of SHA-256 after whole blocks.
+	//encrypting hashes block i - 1 while block i is encrypted, decrypting hashes and decrypts block i together
+	template<int Nr, bool Decrypt>
+	__attribute__((target("aes,sha,sse4.1")))
+	void ctr_sha256_ni(const byte* w, byte* counter, uint32_t* H, byte* data, size_t blocks) noexcept
+	{
+		__m128i round_key[Nr + 1];
+		for (int i = 0; i <= Nr; i++)
+			round_key[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(w + i * 16));
+		uint64_t high = byte_to_word<endian::big, uint64_t>(counter);
+		uint64_t low = byte_to_word<endian::big, uint64_t>(counter + 8);
+
+		__m128i dcba = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(H)), 0xb1);
+		__m128i hgfe = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(H + 4)), 0x1b);
+		__m128i abef = _mm_alignr_epi8(dcba, hgfe, 8);
+		__m128i cdgh = _mm_blend_epi16(hgfe, dcba, 0xf0);
+
+		constexpr int size = crypto::hash::SHA256::block_size;
+		__m128i ctr[4];
+		if (Decrypt)
+			for (size_t i = 0; i < blocks; i++)
+			{
+				next_counters(high, low, ctr);
+				stitched_block<Nr, true, true>(round_key, ctr, data + i * size, data + i * size, abef, cdgh);
+			}
+		else if (blocks)
+		{
+			next_counters(high, low, ctr);
+			stitched_block<Nr, true, false>(round_key, ctr, data, nullptr, abef, cdgh);
+			for (size_t i = 1; i < blocks; i++)
+			{
+				next_counters(high, low, ctr);
+				stitched_block<Nr, true, true>(round_key, ctr, data + i * size, data + (i - 1) * size, abef, cdgh);
+			}
+			stitched_block<Nr, false, true>(round_key, nullptr, nullptr, data + (blocks - 1) * size, abef, cdgh);
+		}
+
+		__m128i feba = _mm_shuffle_epi32(abef, 0x1b);
+		__m128i dchg = _mm_shuffle_epi32(cdgh, 0xb1);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(H), _mm_blend_epi16(feba, dchg, 0xf0));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(H + 4), _mm_alignr_epi8(dchg, feba, 8));
+		word_to_byte<endian::big>(high, counter);
+		word_to_byte<endian::big>(low, counter + 8);
+	}
+#endif
+}
+
+//-------------------------------------------------------------------------------------------------
+
+template<typename Cipher>
+bool crypto::cipher::CTR_HMAC_SHA256<Cipher>::supported() noexcept
+{
+	const auto& feature = utils::cpu_feature::get();
+	return feature.aes && feature.sha && feature.sse41;
+}
+
+template<typename Cipher>
+void crypto::cipher::CTR_HMAC_SHA256<Cipher>::encrypt(typename CTR<Cipher>::encryption& ctr, MAC::HMAC<hash::SHA256>& mac, byte* data, size_t length) noexcept
+{
+	crypt<false>(ctr, mac, data, length);
+}
+
+template<typename Cipher>
+void crypto::cipher::CTR_HMAC_SHA256<Cipher>::decrypt(typename CTR<Cipher>::encryption& ctr, MAC::HMAC<hash::SHA256>& mac, byte* data, size_t length) noexcept
+{
+	crypt<true>(ctr, mac, data, length);
+}
+
+//the kernel takes the state of the inner hash as is, so it needs the hash at a block boundary
+template<typename Cipher>
+template<bool Decrypt>
+void crypto::cipher::CTR_HMAC_SHA256<Cipher>::crypt(typename CTR<Cipher>::encryption& ctr, MAC::HMAC<hash::SHA256>& mac, byte* data, size_t length) noexcept
+{
+	hash::SHA256& inner = mac.inner_hash;
+#if defined(utils_x86)
+	if (supported() && !inner.M_length)
+	{
+		constexpr int Nr = Cipher::key_size / 4 + 6;
+		ctr_sha256_ni<Nr, Decrypt>(ctr.cipher.w, ctr.counter, inner.H, data, length / block_size);
+		inner.total_length += length;
+		return;
+	}
+#endif
+
+	//CTR writes the keystream to out before it reads in
+	if (Decrypt)
+		mac.update(data, length);
+	for (size_t i = 0; i < length; i += Cipher::block_size)
+	{
+		byte temp[Cipher::block_size];
+		ctr.encrypt(data + i, temp);
+		std::copy(temp, temp + Cipher::block_size, data + i);
+	}
+	if (!Decrypt)
+		mac.update(data, length);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+template class crypto::cipher::CTR_HMAC_SHA256<crypto::cipher::AES_128>;
+template class crypto::cipher::CTR_HMAC_SHA256<crypto::cipher::AES_192>;
+template class crypto::cipher::CTR_HMAC_SHA256<crypto::cipher::AES_256>;
\ No newline at end of file
@@ -0,0 +1,37 @@
+#ifndef crypto_CTR_HMAC_SHA256_h
+#define crypto_CTR_HMAC_SHA256_h
+#include"define.h"
+#include"AES.h"
+#include"CTR_mode.h"
+#include"HMAC.h"
+#include"SHA.h"
+
+//AES in CTR mode and HMAC-SHA256 of the ciphertext, encrypt-then-MAC in one pass
+
+namespace crypto::cipher
+{
+	//the AES-NI rounds of the four counters of a 64-byte block run interleaved with the SHA-NI rounds of a block of
+	//ciphertext, so the data is read once and the two take different execution ports. Cipher is AES_128, AES_192 or AES_256
+	template<typename Cipher>
+	class CTR_HMAC_SHA256
+	{
+	public:
+		CTR_HMAC_SHA256() = delete;
+
+		//AES-NI and the SHA extensions, otherwise encrypt() and decrypt() run the cipher and the MAC one after the other
+		static bool supported() noexcept;
+
+		//length is a multiple of block_size. encrypt() encrypts data in place and updates mac with the ciphertext,
+		//decrypt() updates mac with the ciphertext in data and decrypts it in place
+		static void encrypt(typename CTR<Cipher>::encryption& ctr, MAC::HMAC<hash::SHA256>& mac, byte* data, size_t length) noexcept;
+		static void decrypt(typename CTR<Cipher>::encryption& ctr, MAC::HMAC<hash::SHA256>& mac, byte* data, size_t length) noexcept;
+
+		static constexpr int block_size = hash::SHA256::block_size;
+
+	private:
+		template<bool Decrypt>
+		static void crypt(typename CTR<Cipher>::encryption& ctr, MAC::HMAC<hash::SHA256>& mac, byte* data, size_t length) noexcept;
+	};
+}
+
+#endif
\ No newline at end of file
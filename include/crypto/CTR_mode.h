@@ -35,6 +35,9 @@ namespace crypto::cipher
 			static constexpr int block_size = CTR<Cipher>::block_size;
 
 		private:
+			template<typename>
+			friend class CTR_HMAC_SHA256;
+
 			void increment() noexcept;
 
 			typename Cipher::encryption cipher;
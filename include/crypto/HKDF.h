@@ -0,0 +1,68 @@
+#ifndef crypto_HKDF_h
+#define crypto_HKDF_h
+#include"define.h"
+#include<algorithm>
+#include"HMAC.h"
+
+//RFC 5869
+
+namespace crypto::KDF
+{
+	template<typename Hash>
+	class HKDF
+	{
+	public:
+		HKDF() = delete;
+
+		//output.length <= 255 * output_size
+		static void derive(const_array salt, const_array ikm, const_array info, array output) noexcept;
+		static void extract(const_array salt, const_array ikm, byte* prk) noexcept;
+		static void expand(const byte* prk, const_array info, array output) noexcept;
+
+		static constexpr int output_size = Hash::output_size;
+	};
+}
+
+//-------------------------------------------------------------------------------------------------
+
+template<typename Hash>
+void crypto::KDF::HKDF<Hash>::derive(const_array salt, const_array ikm, const_array info, array output) noexcept
+{
+	byte prk[output_size];
+	extract(salt, ikm, prk);
+	expand(prk, info, output);
+}
+
+template<typename Hash>
+void crypto::KDF::HKDF<Hash>::extract(const_array salt, const_array ikm, byte* prk) noexcept
+{
+	constexpr byte zero[output_size] = {};
+	if (!salt.data)
+		salt = { zero, output_size };
+
+	MAC::HMAC<Hash>(salt.data, salt.length, ikm.data, ikm.length, prk);
+}
+
+template<typename Hash>
+void crypto::KDF::HKDF<Hash>::expand(const byte* prk, const_array info, array output) noexcept
+{
+	//every block is keyed by the prk, its pad blocks are hashed once
+	const typename MAC::HMAC<Hash>::prepared_key key(prk, output_size);
+	byte T[output_size];
+	for (byte i = 1; output.length; i++)
+	{
+		MAC::HMAC<Hash> h(key);
+		if (i != 1)
+			h.update(T, output_size);
+		h.update(info.data, info.length);
+		h.update(&i, 1);
+		h.final(T);
+
+		size_t outlen = std::min<size_t>(output.length, output_size);
+		std::copy(T, T + outlen, output.data);
+		output.data += outlen;
+		output.length -= outlen;
+	}
+}
+
+#endif
\ No newline at end of file
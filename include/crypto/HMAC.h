@@ -5,17 +5,29 @@
 
 //RFC 2104
 
+namespace crypto::cipher
+{
+	template<typename Cipher>
+	class CTR_HMAC_SHA256;
+}
+
 namespace crypto::MAC
 {
 	template<typename Hash>
 	class HMAC
 	{
 	public:
+		class prepared_key;
+
 		HMAC() = default;
 		HMAC(const byte* key, size_t keylen) noexcept;
+		HMAC(const prepared_key& key) noexcept;
 		HMAC(const byte* key, size_t keylen, const byte* input, size_t length, byte* output) noexcept;
+		HMAC(const prepared_key& key, const byte* input, size_t length, byte* output) noexcept;
 
+		//both start a new message
 		void init(const byte* key, size_t keylen) noexcept;
+		void init(const prepared_key& key) noexcept;
 		void update(const byte* input, size_t length) noexcept;
 		void final(byte* output) noexcept;
 
@@ -23,6 +35,24 @@ namespace crypto::MAC
 		static constexpr int output_size = Hash::output_size;
 
 	private:
+		template<typename>
+		friend class cipher::CTR_HMAC_SHA256;
+
+		Hash outer_hash;
+		Hash inner_hash;
+	};
+
+	//the inner and outer states after the pad blocks of a key, so the messages under the key
+	//start with a copy of the states instead of two more compressions
+	template<typename Hash>
+	class HMAC<Hash>::prepared_key
+	{
+	public:
+		prepared_key(const byte* key, size_t keylen) noexcept;
+
+	private:
+		friend class HMAC<Hash>;
+
 		Hash outer_hash;
 		Hash inner_hash;
 	};
@@ -34,6 +64,9 @@ crypto::MAC::HMAC<Hash>::HMAC(const byte* key, size_t keylen) noexcept
 	this->init(key, keylen);
 }
 
+template<typename Hash>
+crypto::MAC::HMAC<Hash>::HMAC(const prepared_key& key) noexcept : outer_hash(key.outer_hash), inner_hash(key.inner_hash) {}
+
 template<typename Hash>
 crypto::MAC::HMAC<Hash>::HMAC(const byte* key, size_t keylen, const byte* input, size_t length, byte* output) noexcept : HMAC<Hash>(key, keylen)
 {
@@ -42,25 +75,23 @@ crypto::MAC::HMAC<Hash>::HMAC(const byte* key, size_t keylen, const byte* input,
 }
 
 template<typename Hash>
-void crypto::MAC::HMAC<Hash>::init(const byte* key, size_t keylen) noexcept
+crypto::MAC::HMAC<Hash>::HMAC(const prepared_key& key, const byte* input, size_t length, byte* output) noexcept : HMAC<Hash>(key)
 {
-	byte k[Hash::block_size] = {};
-
-	if (keylen > Hash::block_size)
-		Hash(key, keylen, k);
-	else
-		std::copy(key, key + keylen, k);
-
-	byte opad_key[Hash::block_size];
-	for (int i = 0; i < Hash::block_size; i++)
-		opad_key[i] = k[i] ^ 0x5c;
+	this->update(input, length);
+	this->final(output);
+}
 
-	byte ipad_key[Hash::block_size];
-	for (int i = 0; i < Hash::block_size; i++)
-		ipad_key[i] = k[i] ^ 0x36;
+template<typename Hash>
+void crypto::MAC::HMAC<Hash>::init(const byte* key, size_t keylen) noexcept
+{
+	this->init(prepared_key(key, keylen));
+}
 
-	this->outer_hash.update(opad_key, Hash::block_size);
-	this->inner_hash.update(ipad_key, Hash::block_size);
+template<typename Hash>
+void crypto::MAC::HMAC<Hash>::init(const prepared_key& key) noexcept
+{
+	this->outer_hash = key.outer_hash;
+	this->inner_hash = key.inner_hash;
 }
 
 template<typename Hash>
@@ -79,4 +110,28 @@ void crypto::MAC::HMAC<Hash>::final(byte* output) noexcept
 	this->outer_hash.final(output);
 }
 
+//-------------------------------------------------------------------------------------------------
+
+template<typename Hash>
+crypto::MAC::HMAC<Hash>::prepared_key::prepared_key(const byte* key, size_t keylen) noexcept
+{
+	byte k[Hash::block_size] = {};
+
+	if (keylen > Hash::block_size)
+		Hash(key, keylen, k);
+	else
+		std::copy(key, key + keylen, k);
+
+	byte opad_key[Hash::block_size];
+	for (int i = 0; i < Hash::block_size; i++)
+		opad_key[i] = k[i] ^ 0x5c;
+
+	byte ipad_key[Hash::block_size];
+	for (int i = 0; i < Hash::block_size; i++)
+		ipad_key[i] = k[i] ^ 0x36;
+
+	this->outer_hash.update(opad_key, Hash::block_size);
+	this->inner_hash.update(ipad_key, Hash::block_size);
+}
+
 #endif
\ No newline at end of file
@@ -1,6 +1,11 @@
 #include"SHA.h"
 #include<algorithm>
 #include<utils/bit.h>
+#include<utils/cpu.h>
+
+#if defined(utils_x86)
+#include<immintrin.h>
+#endif
 
 using namespace crypto;
 using utils::endian;
@@ -25,12 +30,13 @@ namespace
 
 	//-------------------------------------------------------------------------------------------------
 
+	//compress(input, blocks) is handed every whole block of input at once, only a partial block is buffered
 	template<int block_size, typename T, typename F>
 	void update(const byte* input, size_t length, byte* M, int& M_length, T& total_length , F&& compress) noexcept
 	{
 		total_length += length;
 
-		while (length)
+		if (M_length)
 		{
 			int outlen = (M_length + length < block_size) ? length : block_size - M_length;
 			std::copy(input, input + outlen, M + M_length);
@@ -39,12 +45,21 @@ namespace
 			input += outlen;
 			length -= outlen;
 
-			if (M_length == block_size)
-			{
-				compress();
-				M_length = 0;
-			}
+			if (M_length < block_size)
+				return;
+			compress(M, 1);
+			M_length = 0;
+		}
+
+		if (size_t blocks = length / block_size)
+		{
+			compress(input, blocks);
+			input += blocks * block_size;
+			length -= blocks * block_size;
 		}
+
+		std::copy(input, input + length, M);
+		M_length = static_cast<int>(length);
 	}
 
 	template<int block_size, typename word, int N, typename T, typename F>
@@ -56,13 +71,13 @@ namespace
 		if (M_length + sizeof(total_length) > block_size)
 		{
 			std::fill(M + M_length, M + block_size, 0);
-			compress();
+			compress(M, 1);
 			M_length = 0;
 		}
 
 		std::fill(M + M_length, M + block_size - sizeof(total_length), 0);
 		word_to_byte<endian::big>(static_cast<T>(total_length * 8), M + block_size - sizeof(total_length));
-		compress();
+		compress(M, 1);
 
 		for (int i = 0; i < N; i++)
 			word_to_byte<endian::big>(H[i], output + i * sizeof(word));
@@ -77,6 +92,113 @@ namespace
 	{
 		return x ^ y ^ z;
 	}
+
+	void sha1_compress_generic(uint32_t* H, const byte* input, size_t blocks) noexcept
+	{
+		for (; blocks; blocks--, input += crypto::hash::SHA1::block_size)
+		{
+			uint32_t W[80];
+			uint32_t a, b, c, d, e;
+
+			for (int t = 0; t <= 15; t++)
+				W[t] = byte_to_word<endian::big, uint32_t>(input + t * sizeof(uint32_t));
+			for (int t = 16; t <= 79; t++)
+				W[t] = rotl(static_cast<uint32_t>(W[t - 3] ^ W[t - 8] ^ W[t - 14] ^ W[t - 16]), 1);
+
+			a = H[0];
+			b = H[1];
+			c = H[2];
+			d = H[3];
+			e = H[4];
+
+			for (int t = 0; t <= 79; t++)
+			{
+				uint32_t T;
+				if (0 <= t && t <= 19)
+					T = rotl(a, 5) + Ch(b, c, d) + e + 0x5a827999 + W[t];
+				else if (20 <= t && t <= 39)
+					T = rotl(a, 5) + Parity(b, c, d) + e + 0x6ed9eba1 + W[t];
+				else if (40 <= t && t <= 59)
+					T = rotl(a, 5) + Maj(b, c, d) + e + 0x8f1bbcdc + W[t];
+				else// if (60 <= t && t <= 79)
+					T = rotl(a, 5) + Parity(b, c, d) + e + 0xca62c1d6 + W[t];
+				e = d;
+				d = c;
+				c = rotl(b, 30);
+				b = a;
+				a = T;
+			}
+
+			H[0] += a;
+			H[1] += b;
+			H[2] += c;
+			H[3] += d;
+			H[4] += e;
+		}
+	}
+
+#if defined(utils_x86)
+	//Intel SHA extensions, each sha1rnds4 runs 4 rounds and the message schedule stays in 4 registers
+	__attribute__((target("sha,sse4.1")))
+	void sha1_compress_ni(uint32_t* H, const byte* input, size_t blocks) noexcept
+	{
+		const __m128i mask = _mm_set_epi64x(0x0001020304050607, 0x08090a0b0c0d0e0f);
+		__m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(H)), 0x1b);
+		__m128i e0 = _mm_set_epi32(H[4], 0, 0, 0);
+
+		for (; blocks; blocks--, input += crypto::hash::SHA1::block_size)
+		{
+			const __m128i abcd_save = abcd;
+			const __m128i e0_save = e0;
+			__m128i W[4], e[2] = { e0, abcd };
+
+			for (int i = 0; i < 20; i++)
+			{
+				if (i < 4)
+					W[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i * 16)), mask);
+				else
+					W[i % 4] = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(W[i % 4], W[(i + 1) % 4]), W[(i + 2) % 4]), W[(i + 3) % 4]);
+
+				const int s = i % 2;
+				e[s] = i ? _mm_sha1nexte_epu32(e[s], W[i % 4]) : _mm_add_epi32(e[s], W[i % 4]);
+				e[s ^ 1] = abcd;
+				switch (i / 5)
+				{
+				case 0:
+					abcd = _mm_sha1rnds4_epu32(abcd, e[s], 0);
+					break;
+				case 1:
+					abcd = _mm_sha1rnds4_epu32(abcd, e[s], 1);
+					break;
+				case 2:
+					abcd = _mm_sha1rnds4_epu32(abcd, e[s], 2);
+					break;
+				default:
+					abcd = _mm_sha1rnds4_epu32(abcd, e[s], 3);
+					break;
+				}
+			}
+
+			e0 = _mm_sha1nexte_epu32(e[0], e0_save);
+			abcd = _mm_add_epi32(abcd, abcd_save);
+		}
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(H), _mm_shuffle_epi32(abcd, 0x1b));
+		H[4] = _mm_extract_epi32(e0, 3);
+	}
+#endif
+
+	using sha1_compress_function = void(*)(uint32_t* H, const byte* input, size_t blocks) noexcept;
+
+	sha1_compress_function select_sha1_compress() noexcept
+	{
+#if defined(utils_x86)
+		const auto& feature = utils::cpu_feature::get();
+		if (feature.sha && feature.sse41)
+			return sha1_compress_ni;
+#endif
+		return sha1_compress_generic;
+	}
 }
 
 crypto::hash::SHA1::SHA1() noexcept : H{ 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0 }, M_length(0), total_length(0) {}
@@ -89,53 +211,18 @@ crypto::hash::SHA1::SHA1(const byte* input, size_t length, byte* output) noexcep
 
 void crypto::hash::SHA1::update(const byte* input, size_t length) noexcept
 {
-	::update<block_size>(input, length, this->M, this->M_length, this->total_length, [&]() { this->compress(); });
+	::update<block_size>(input, length, this->M, this->M_length, this->total_length, [&](const byte* p, size_t blocks) { this->compress(p, blocks); });
 }
 
 void crypto::hash::SHA1::final(byte* output) noexcept
 {
-	::final<block_size>(output, this->H, this->M, this->M_length, this->total_length, [&]() { this->compress(); });
+	::final<block_size>(output, this->H, this->M, this->M_length, this->total_length, [&](const byte* p, size_t blocks) { this->compress(p, blocks); });
 }
 
-void crypto::hash::SHA1::compress() noexcept
+void crypto::hash::SHA1::compress(const byte* input, size_t blocks) noexcept
 {
-	word W[80];
-	word a, b, c, d, e;
-
-	for (int t = 0; t <= 15; t++)
-		W[t] = byte_to_word<endian::big, word>(this->M + t * sizeof(word));
-	for (int t = 16; t <= 79; t++)
-		W[t] = rotl(static_cast<word>(W[t - 3] ^ W[t - 8] ^ W[t - 14] ^ W[t - 16]), 1);
-
-	a = this->H[0];
-	b = this->H[1];
-	c = this->H[2];
-	d = this->H[3];
-	e = this->H[4];
-
-	for (int t = 0; t <= 79; t++)
-	{
-		word T;
-		if (0 <= t && t <= 19)
-			T = rotl(a, 5) + Ch(b, c, d) + e + 0x5a827999 + W[t];
-		else if (20 <= t && t <= 39)
-			T = rotl(a, 5) + Parity(b, c, d) + e + 0x6ed9eba1 + W[t];
-		else if (40 <= t && t <= 59)
-			T = rotl(a, 5) + Maj(b, c, d) + e + 0x8f1bbcdc + W[t];
-		else// if (60 <= t && t <= 79)
-			T = rotl(a, 5) + Parity(b, c, d) + e + 0xca62c1d6 + W[t];
-		e = d;
-		d = c;
-		c = rotl(b, 30);
-		b = a;
-		a = T;
-	}
-
-	this->H[0] += a;
-	this->H[1] += b;
-	this->H[2] += c;
-	this->H[3] += d;
-	this->H[4] += e;
+	static const sha1_compress_function f = select_sha1_compress();
+	f(this->H, input, blocks);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -161,6 +248,104 @@ namespace
 	{
 		return rotr(x, 17) ^ rotr(x, 19) ^ (x >> 10);
 	}
+
+	void sha256_compress_generic(uint32_t* H, const byte* input, size_t blocks) noexcept
+	{
+		for (; blocks; blocks--, input += crypto::hash::SHA256::block_size)
+		{
+			uint32_t W[64];
+			uint32_t a, b, c, d, e, f, g, h;
+
+			for (int t = 0; t <= 15; t++)
+				W[t] = byte_to_word<endian::big, uint32_t>(input + t * sizeof(uint32_t));
+			for (int t = 16; t <= 63; t++)
+				W[t] = sigma1(W[t - 2]) + W[t - 7] + sigma0(W[t - 15]) + W[t - 16];
+
+			a = H[0];
+			b = H[1];
+			c = H[2];
+			d = H[3];
+			e = H[4];
+			f = H[5];
+			g = H[6];
+			h = H[7];
+
+			for (int t = 0; t <= 63; t++)
+			{
+				uint32_t T1 = h + Sigma1(e) + Ch(e, f, g) + crypto::hash::SHA256::K[t] + W[t];
+				uint32_t T2 = Sigma0(a) + Maj(a, b, c);
+				h = g;
+				g = f;
+				f = e;
+				e = d + T1;
+				d = c;
+				c = b;
+				b = a;
+				a = T1 + T2;
+			}
+
+			H[0] += a;
+			H[1] += b;
+			H[2] += c;
+			H[3] += d;
+			H[4] += e;
+			H[5] += f;
+			H[6] += g;
+			H[7] += h;
+		}
+	}
+
+#if defined(utils_x86)
+	//Intel SHA extensions, the state is kept as ABEF and CDGH and each sha256rnds2 runs 2 rounds
+	__attribute__((target("sha,sse4.1")))
+	void sha256_compress_ni(uint32_t* H, const byte* input, size_t blocks) noexcept
+	{
+		const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0b, 0x0405060700010203);
+		__m128i dcba = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(H)), 0xb1);
+		__m128i hgfe = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(H + 4)), 0x1b);
+		__m128i abef = _mm_alignr_epi8(dcba, hgfe, 8);
+		__m128i cdgh = _mm_blend_epi16(hgfe, dcba, 0xf0);
+
+		for (; blocks; blocks--, input += crypto::hash::SHA256::block_size)
+		{
+			const __m128i abef_save = abef;
+			const __m128i cdgh_save = cdgh;
+			__m128i W[4];
+
+			for (int i = 0; i < 16; i++)
+			{
+				if (i < 4)
+					W[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i * 16)), mask);
+				else
+					W[i % 4] = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(W[i % 4], W[(i + 1) % 4]), _mm_alignr_epi8(W[(i + 3) % 4], W[(i + 2) % 4], 4)), W[(i + 3) % 4]);
+
+				__m128i message = _mm_add_epi32(W[i % 4], _mm_load_si128(reinterpret_cast<const __m128i*>(crypto::hash::SHA256::K + i * 4)));
+				cdgh = _mm_sha256rnds2_epu32(cdgh, abef, message);
+				abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(message, 0x0e));
+			}
+
+			abef = _mm_add_epi32(abef, abef_save);
+			cdgh = _mm_add_epi32(cdgh, cdgh_save);
+		}
+
+		__m128i feba = _mm_shuffle_epi32(abef, 0x1b);
+		__m128i dchg = _mm_shuffle_epi32(cdgh, 0xb1);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(H), _mm_blend_epi16(feba, dchg, 0xf0));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(H + 4), _mm_alignr_epi8(dchg, feba, 8));
+	}
+#endif
+
+	using sha256_compress_function = void(*)(uint32_t* H, const byte* input, size_t blocks) noexcept;
+
+	sha256_compress_function select_sha256_compress() noexcept
+	{
+#if defined(utils_x86)
+		const auto& feature = utils::cpu_feature::get();
+		if (feature.sha && feature.sse41)
+			return sha256_compress_ni;
+#endif
+		return sha256_compress_generic;
+	}
 }
 
 crypto::hash::SHA256::SHA256() noexcept : H{ 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 }, M_length(0), total_length(0) {}
@@ -178,66 +363,18 @@ crypto::hash::SHA256::SHA256(const byte* input, size_t length, byte* output) noe
 
 void crypto::hash::SHA256::update(const byte* input, size_t length) noexcept
 {
-	::update<block_size>(input, length, this->M, this->M_length, this->total_length, [&]() { this->compress(); });
+	::update<block_size>(input, length, this->M, this->M_length, this->total_length, [&](const byte* p, size_t blocks) { this->compress(p, blocks); });
 }
 
 void crypto::hash::SHA256::final(byte* output) noexcept
 {
-	::final<block_size>(output, this->H, this->M, this->M_length, this->total_length, [&]() { this->compress(); });
+	::final<block_size>(output, this->H, this->M, this->M_length, this->total_length, [&](const byte* p, size_t blocks) { this->compress(p, blocks); });
 }
 
-void crypto::hash::SHA256::compress() noexcept
+void crypto::hash::SHA256::compress(const byte* input, size_t blocks) noexcept
 {
-	constexpr word K[64] = {
-		0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
-		0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
-		0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
-		0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
-		0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
-		0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
-		0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
-		0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
-	};
-
-	word W[64];
-	word a, b, c, d, e, f, g, h;
-
-	for (int t = 0; t <= 15; t++)
-		W[t] = byte_to_word<endian::big, word>(this->M + t * sizeof(word));
-	for (int t = 16; t <= 63; t++)
-		W[t] = sigma1(W[t - 2]) + W[t - 7] + sigma0(W[t - 15]) + W[t - 16];
-
-	a = this->H[0];
-	b = this->H[1];
-	c = this->H[2];
-	d = this->H[3];
-	e = this->H[4];
-	f = this->H[5];
-	g = this->H[6];
-	h = this->H[7];
-
-	for (int t = 0; t <= 63; t++)
-	{
-		word T1 = h + Sigma1(e) + Ch(e, f, g) + K[t] + W[t];
-		word T2 = Sigma0(a) + Maj(a, b, c);
-		h = g;
-		g = f;
-		f = e;
-		e = d + T1;
-		d = c;
-		c = b;
-		b = a;
-		a = T1 + T2;
-	}
-
-	this->H[0] += a;
-	this->H[1] += b;
-	this->H[2] += c;
-	this->H[3] += d;
-	this->H[4] += e;
-	this->H[5] += f;
-	this->H[6] += g;
-	this->H[7] += h;
+	static const sha256_compress_function f = select_sha256_compress();
+	f(this->H, input, blocks);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -261,53 +398,275 @@ void crypto::hash::SHA224::final(byte* output) noexcept
 
 namespace
 {
-	uint64_t Sigma0(uint64_t x) noexcept
+	using sha256_multi_compress_function = void(*)(uint32_t* H, const byte* const* input, int lanes, size_t blocks) noexcept;
+
+	//one message at a time with the single stream compression
+	void sha256_multi_compress_serial(uint32_t* H, const byte* const* input, int lanes, size_t blocks) noexcept
 	{
-		return rotr(x, 28) ^ rotr(x, 34) ^ rotr(x, 39);
+		static const sha256_compress_function compress = select_sha256_compress();
+		for (int i = 0; i < lanes; i++)
+		{
+			uint32_t state[8];
+			for (int j = 0; j < 8; j++)
+				state[j] = H[j * crypto::hash::SHA256_multi::max_lanes + i];
+			compress(state, input[i], blocks);
+			for (int j = 0; j < 8; j++)
+				H[j * crypto::hash::SHA256_multi::max_lanes + i] = state[j];
+		}
 	}
 
-	uint64_t Sigma1(uint64_t x) noexcept
+#if defined(utils_x86)
+	//the SHA-256 rounds on vectors of width lanes, inlined into the functions compiled for AVX2 and AVX-512
+	template<typename V, int width>
+	__attribute__((always_inline)) inline void sha256_multi_rounds(uint32_t* H, const byte* const* input, size_t blocks) noexcept
 	{
-		return rotr(x, 14) ^ rotr(x, 18) ^ rotr(x, 41);
+		V* state = reinterpret_cast<V*>(H);
+		constexpr int stride = crypto::hash::SHA256_multi::max_lanes / width;
+
+		for (size_t n = 0; n < blocks; n++)
+		{
+			V W[64];
+
+			for (int t = 0; t <= 15; t++)
+				for (int i = 0; i < width; i++)
+					W[t][i] = byte_to_word<endian::big, uint32_t>(input[i] + n * crypto::hash::SHA256_multi::block_size + t * sizeof(uint32_t));
+			for (int t = 16; t <= 63; t++)
+			{
+				V s0 = (W[t - 15] >> 7 | W[t - 15] << 25) ^ (W[t - 15] >> 18 | W[t - 15] << 14) ^ W[t - 15] >> 3;
+				V s1 = (W[t - 2] >> 17 | W[t - 2] << 15) ^ (W[t - 2] >> 19 | W[t - 2] << 13) ^ W[t - 2] >> 10;
+				W[t] = s1 + W[t - 7] + s0 + W[t - 16];
+			}
+
+			V a = state[0 * stride], b = state[1 * stride], c = state[2 * stride], d = state[3 * stride];
+			V e = state[4 * stride], f = state[5 * stride], g = state[6 * stride], h = state[7 * stride];
+
+			for (int t = 0; t <= 63; t++)
+			{
+				V T1 = h + ((e >> 6 | e << 26) ^ (e >> 11 | e << 21) ^ (e >> 25 | e << 7)) + ((e & f) ^ (~e & g)) + crypto::hash::SHA256::K[t] + W[t];
+				V T2 = ((a >> 2 | a << 30) ^ (a >> 13 | a << 19) ^ (a >> 22 | a << 10)) + ((a & b) ^ (a & c) ^ (b & c));
+				h = g;
+				g = f;
+				f = e;
+				e = d + T1;
+				d = c;
+				c = b;
+				b = a;
+				a = T1 + T2;
+			}
+
+			state[0 * stride] += a;
+			state[1 * stride] += b;
+			state[2 * stride] += c;
+			state[3 * stride] += d;
+			state[4 * stride] += e;
+			state[5 * stride] += f;
+			state[6 * stride] += g;
+			state[7 * stride] += h;
+		}
 	}
 
-	uint64_t sigma0(uint64_t x) noexcept
+	//written with vector extensions like the SHA-512 schedule, lanes past the last message hash a copy of the first one
+	typedef uint32_t uint32x8_t __attribute__((vector_size(32)));
+	typedef uint32_t uint32x16_t __attribute__((vector_size(64)));
+
+	__attribute__((target("avx2")))
+	void sha256_multi_compress_avx2(uint32_t* H, const byte* const* input, int lanes, size_t blocks) noexcept
 	{
-		return rotr(x, 1) ^ rotr(x, 8) ^ (x >> 7);
+		constexpr int width = 8;
+		for (int i = 0; i < lanes; i += width)
+		{
+			const byte* p[width];
+			for (int j = 0; j < width; j++)
+				p[j] = input[i + j < lanes ? i + j : 0];
+			sha256_multi_rounds<uint32x8_t, width>(H + i, p, blocks);
+		}
 	}
 
-	uint64_t sigma1(uint64_t x) noexcept
+	__attribute__((target("avx512f")))
+	void sha256_multi_compress_avx512(uint32_t* H, const byte* const* input, int lanes, size_t blocks) noexcept
 	{
-		return rotr(x, 19) ^ rotr(x, 61) ^ (x >> 6);
+		constexpr int width = 16;
+		const byte* p[width];
+		for (int j = 0; j < width; j++)
+			p[j] = input[j < lanes ? j : 0];
+		sha256_multi_rounds<uint32x16_t, width>(H, p, blocks);
 	}
-}
+#endif
 
-crypto::hash::SHA512::SHA512() noexcept : H{ 0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1, 0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179 }, M_length(0), total_length(0) {}
+	sha256_multi_compress_function select_sha256_multi_compress() noexcept
+	{
+#if defined(utils_x86)
+		const auto& feature = utils::cpu_feature::get();
+		if (feature.avx512f)
+			return sha256_multi_compress_avx512;
+		//8 lanes of AVX2 are slower than the SHA extensions one message at a time
+		if (feature.avx2 && !(feature.sha && feature.sse41))
+			return sha256_multi_compress_avx2;
+#endif
+		return sha256_multi_compress_serial;
+	}
 
-crypto::hash::SHA512::SHA512(std::initializer_list<word> H) noexcept : SHA512()
+	//the last one or two blocks of a message, returns the number of blocks
+	int sha256_pad(const byte* tail, int tail_length, uint64_t total_length, byte* output) noexcept
+	{
+		constexpr int block_size = crypto::hash::SHA256_multi::block_size;
+		const int blocks = tail_length + 1 + sizeof(total_length) > block_size ? 2 : 1;
+
+		std::copy(tail, tail + tail_length, output);
+		output[tail_length] = 0x80;
+		std::fill(output + tail_length + 1, output + blocks * block_size - sizeof(total_length), 0);
+		word_to_byte<endian::big>(total_length * 8, output + blocks * block_size - sizeof(total_length));
+		return blocks;
+	}
+}
+
+crypto::hash::SHA256_multi::SHA256_multi(int lanes) noexcept : lanes(lanes), M_length(0), total_length(0)
 {
-	std::copy(H.begin(), H.end(), this->H);
+	constexpr word initial[8] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+	for (int j = 0; j < 8; j++)
+		std::fill(this->H + j * max_lanes, this->H + (j + 1) * max_lanes, initial[j]);
 }
 
-crypto::hash::SHA512::SHA512(const byte* input, size_t length, byte* output) noexcept : SHA512()
+crypto::hash::SHA256_multi::SHA256_multi(int lanes, const byte* const* input, size_t length, byte* const* output) noexcept : SHA256_multi(lanes)
 {
 	this->update(input, length);
 	this->final(output);
 }
 
-void crypto::hash::SHA512::update(const byte* input, size_t length) noexcept
+void crypto::hash::SHA256_multi::update(const byte* const* input, size_t length) noexcept
 {
-	::update<block_size>(input, length, this->M, this->M_length, this->total_length, [&]() { this->compress(); });
+	const byte* p[max_lanes];
+	size_t offset = 0;
+	this->total_length += length;
+
+	if (this->M_length)
+	{
+		int outlen = (this->M_length + length < block_size) ? length : block_size - this->M_length;
+		for (int i = 0; i < this->lanes; i++)
+			std::copy(input[i], input[i] + outlen, this->M[i] + this->M_length);
+
+		this->M_length += outlen;
+		offset = outlen;
+		length -= outlen;
+
+		if (this->M_length < block_size)
+			return;
+		for (int i = 0; i < this->lanes; i++)
+			p[i] = this->M[i];
+		this->compress(p, 1);
+		this->M_length = 0;
+	}
+
+	if (size_t blocks = length / block_size)
+	{
+		for (int i = 0; i < this->lanes; i++)
+			p[i] = input[i] + offset;
+		this->compress(p, blocks);
+		offset += blocks * block_size;
+		length -= blocks * block_size;
+	}
+
+	for (int i = 0; i < this->lanes; i++)
+		std::copy(input[i] + offset, input[i] + offset + length, this->M[i]);
+	this->M_length = static_cast<int>(length);
 }
 
-void crypto::hash::SHA512::final(byte* output) noexcept
+void crypto::hash::SHA256_multi::final(byte* const* output) noexcept
 {
-	::final<block_size>(output, this->H, this->M, this->M_length, this->total_length, [&]() { this->compress(); });
+	byte pad[max_lanes][2 * block_size];
+	const byte* p[max_lanes];
+	int blocks = 0;
+	for (int i = 0; i < this->lanes; i++)
+	{
+		blocks = sha256_pad(this->M[i], this->M_length, this->total_length, pad[i]);
+		p[i] = pad[i];
+	}
+	this->compress(p, blocks);
+
+	for (int i = 0; i < this->lanes; i++)
+		for (int j = 0; j < 8; j++)
+			word_to_byte<endian::big>(this->H[j * max_lanes + i], output[i] + j * sizeof(word));
 }
 
-void crypto::hash::SHA512::compress() noexcept
+void crypto::hash::SHA256_multi::hash(size_t n, const byte* const* input, const size_t* length, byte* const* output) noexcept
 {
-	constexpr word K[80] = {
+	for (size_t group = 0; group < n; group += max_lanes)
+	{
+		const int lanes = static_cast<int>(std::min<size_t>(n - group, max_lanes));
+		const byte* const* input_group = input + group;
+		SHA256_multi multi(lanes);
+
+		//every lane runs the whole blocks they all have, then each steps through the rest of its data and its padding
+		byte pad[max_lanes][2 * block_size];
+		size_t data_blocks[max_lanes], total_blocks[max_lanes];
+		size_t common = length[group] / block_size, longest = 0;
+		for (int i = 0; i < lanes; i++)
+		{
+			data_blocks[i] = length[group + i] / block_size;
+			total_blocks[i] = data_blocks[i] + sha256_pad(input_group[i] + data_blocks[i] * block_size, length[group + i] % block_size, length[group + i], pad[i]);
+			common = std::min(common, data_blocks[i]);
+			longest = std::max(longest, total_blocks[i]);
+		}
+		if (common)
+			multi.compress(input_group, common);
+
+		for (size_t k = common; k < longest; k++)
+		{
+			const byte* p[max_lanes];
+			for (int i = 0; i < lanes; i++)
+				if (k < data_blocks[i])
+					p[i] = input_group[i] + k * block_size;
+				else if (k < total_blocks[i])
+					p[i] = pad[i] + (k - data_blocks[i]) * block_size;
+				else
+					p[i] = pad[i];
+
+			word saved[8 * max_lanes];
+			std::copy(multi.H, multi.H + 8 * max_lanes, saved);
+			multi.compress(p, 1);
+			for (int i = 0; i < lanes; i++)
+				if (k >= total_blocks[i])
+					for (int j = 0; j < 8; j++)
+						multi.H[j * max_lanes + i] = saved[j * max_lanes + i];
+		}
+
+		for (int i = 0; i < lanes; i++)
+			for (int j = 0; j < 8; j++)
+				word_to_byte<endian::big>(multi.H[j * max_lanes + i], output[group + i] + j * sizeof(word));
+	}
+}
+
+void crypto::hash::SHA256_multi::compress(const byte* const* input, size_t blocks) noexcept
+{
+	static const sha256_multi_compress_function f = select_sha256_multi_compress();
+	f(this->H, input, this->lanes, blocks);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+namespace
+{
+	uint64_t Sigma0(uint64_t x) noexcept
+	{
+		return rotr(x, 28) ^ rotr(x, 34) ^ rotr(x, 39);
+	}
+
+	uint64_t Sigma1(uint64_t x) noexcept
+	{
+		return rotr(x, 14) ^ rotr(x, 18) ^ rotr(x, 41);
+	}
+
+	uint64_t sigma0(uint64_t x) noexcept
+	{
+		return rotr(x, 1) ^ rotr(x, 8) ^ (x >> 7);
+	}
+
+	uint64_t sigma1(uint64_t x) noexcept
+	{
+		return rotr(x, 19) ^ rotr(x, 61) ^ (x >> 6);
+	}
+
+	constexpr uint64_t sha512_K[80] = {
 		0x428a2f98d728ae22, 0x7137449123ef65cd, 0xb5c0fbcfec4d3b2f, 0xe9b5dba58189dbbc,
 		0x3956c25bf348b538, 0x59f111f1b605d019, 0x923f82a4af194f9b, 0xab1c5ed5da6d8118,
 		0xd807aa98a3030242, 0x12835b0145706fbe, 0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2,
@@ -330,45 +689,189 @@ void crypto::hash::SHA512::compress() noexcept
 		0x4cc5d4becb3e42b6, 0x597f299cfc657e2a, 0x5fcb6fab3ad6faec, 0x6c44198c4a475817,
 	};
 
-	word W[80];
-	word a, b, c, d, e, f, g, h;
-
-	for (int t = 0; t <= 15; t++)
-		W[t] = byte_to_word<endian::big, word>(this->M + t * sizeof(word));
-	for (int t = 16; t <= 79; t++)
-		W[t] = sigma1(W[t - 2]) + W[t - 7] + sigma0(W[t - 15]) + W[t - 16];
-
-	a = this->H[0];
-	b = this->H[1];
-	c = this->H[2];
-	d = this->H[3];
-	e = this->H[4];
-	f = this->H[5];
-	g = this->H[6];
-	h = this->H[7];
-
-	for (int t = 0; t <= 79; t++)
-	{
-		word T1 = h + Sigma1(e) + Ch(e, f, g) + K[t] + W[t];
-		word T2 = Sigma0(a) + Maj(a, b, c);
-		h = g;
-		g = f;
-		f = e;
-		e = d + T1;
-		d = c;
-		c = b;
-		b = a;
-		a = T1 + T2;
-	}
-
-	this->H[0] += a;
-	this->H[1] += b;
-	this->H[2] += c;
-	this->H[3] += d;
-	this->H[4] += e;
-	this->H[5] += f;
-	this->H[6] += g;
-	this->H[7] += h;
+	//the rounds of one block, WK[t] = W[t] + K[t] with a stride of lanes words
+	template<int lanes>
+	void sha512_rounds(uint64_t* H, const uint64_t* WK) noexcept
+	{
+		uint64_t a, b, c, d, e, f, g, h;
+
+		a = H[0];
+		b = H[1];
+		c = H[2];
+		d = H[3];
+		e = H[4];
+		f = H[5];
+		g = H[6];
+		h = H[7];
+
+		for (int t = 0; t <= 79; t++)
+		{
+			uint64_t T1 = h + Sigma1(e) + Ch(e, f, g) + WK[t * lanes];
+			uint64_t T2 = Sigma0(a) + Maj(a, b, c);
+			h = g;
+			g = f;
+			f = e;
+			e = d + T1;
+			d = c;
+			c = b;
+			b = a;
+			a = T1 + T2;
+		}
+
+		H[0] += a;
+		H[1] += b;
+		H[2] += c;
+		H[3] += d;
+		H[4] += e;
+		H[5] += f;
+		H[6] += g;
+		H[7] += h;
+	}
+
+	void sha512_compress_generic(uint64_t* H, const byte* input, size_t blocks) noexcept
+	{
+		for (; blocks; blocks--, input += crypto::hash::SHA512::block_size)
+		{
+			uint64_t W[80];
+
+			for (int t = 0; t <= 15; t++)
+				W[t] = byte_to_word<endian::big, uint64_t>(input + t * sizeof(uint64_t));
+			for (int t = 16; t <= 79; t++)
+				W[t] = sigma1(W[t - 2]) + W[t - 7] + sigma0(W[t - 15]) + W[t - 16];
+			for (int t = 0; t <= 79; t++)
+				W[t] += sha512_K[t];
+
+			sha512_rounds<1>(H, W);
+		}
+	}
+
+#if defined(utils_x86)
+	//the rounds of a block depend on each other, but the message schedules of several blocks don't.
+	//each 64-bit lane expands the schedule of its own block, then the rounds run block by block.
+
+	__attribute__((target("avx2")))
+	__m256i rotr_avx2(__m256i x, int n) noexcept
+	{
+		return _mm256_or_si256(_mm256_srli_epi64(x, n), _mm256_slli_epi64(x, 64 - n));
+	}
+
+	__attribute__((target("avx2")))
+	void sha512_compress_avx2(uint64_t* H, const byte* input, size_t blocks) noexcept
+	{
+		constexpr int lanes = 4;
+		const __m256i bswap = _mm256_set_epi64x(0x08090a0b0c0d0e0f, 0x0001020304050607, 0x08090a0b0c0d0e0f, 0x0001020304050607);
+		alignas(32) uint64_t WK[80 * lanes];
+
+		for (; blocks >= lanes; blocks -= lanes, input += lanes * crypto::hash::SHA512::block_size)
+		{
+			__m256i W[80];
+
+			//4 words of each block, transposed so lane i holds block i
+			for (int t = 0; t <= 15; t += 4)
+			{
+				__m256i r[lanes];
+				for (int i = 0; i < lanes; i++)
+					r[i] = _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i * crypto::hash::SHA512::block_size + t * 8)), bswap);
+				__m256i t0 = _mm256_unpacklo_epi64(r[0], r[1]);
+				__m256i t1 = _mm256_unpackhi_epi64(r[0], r[1]);
+				__m256i t2 = _mm256_unpacklo_epi64(r[2], r[3]);
+				__m256i t3 = _mm256_unpackhi_epi64(r[2], r[3]);
+				W[t] = _mm256_permute2x128_si256(t0, t2, 0x20);
+				W[t + 1] = _mm256_permute2x128_si256(t1, t3, 0x20);
+				W[t + 2] = _mm256_permute2x128_si256(t0, t2, 0x31);
+				W[t + 3] = _mm256_permute2x128_si256(t1, t3, 0x31);
+			}
+			for (int t = 16; t <= 79; t++)
+			{
+				__m256i s0 = _mm256_xor_si256(_mm256_xor_si256(rotr_avx2(W[t - 15], 1), rotr_avx2(W[t - 15], 8)), _mm256_srli_epi64(W[t - 15], 7));
+				__m256i s1 = _mm256_xor_si256(_mm256_xor_si256(rotr_avx2(W[t - 2], 19), rotr_avx2(W[t - 2], 61)), _mm256_srli_epi64(W[t - 2], 6));
+				W[t] = _mm256_add_epi64(_mm256_add_epi64(s1, W[t - 7]), _mm256_add_epi64(s0, W[t - 16]));
+			}
+			for (int t = 0; t <= 79; t++)
+				_mm256_store_si256(reinterpret_cast<__m256i*>(WK + t * lanes), _mm256_add_epi64(W[t], _mm256_set1_epi64x(sha512_K[t])));
+
+			for (int i = 0; i < lanes; i++)
+				sha512_rounds<lanes>(H, WK + i);
+		}
+
+		sha512_compress_generic(H, input, blocks);
+	}
+
+	//written with vector extensions, the AVX-512 intrinsics make GCC 12 warn about _mm512_undefined_epi32()
+	typedef uint64_t uint64x8_t __attribute__((vector_size(64)));
+
+	__attribute__((target("avx512f")))
+	void sha512_compress_avx512(uint64_t* H, const byte* input, size_t blocks) noexcept
+	{
+		constexpr int lanes = 8;
+		alignas(64) uint64_t WK[80 * lanes];
+
+		for (; blocks >= lanes; blocks -= lanes, input += lanes * crypto::hash::SHA512::block_size)
+		{
+			uint64x8_t W[80];
+
+			for (int t = 0; t <= 15; t++)
+				for (int i = 0; i < lanes; i++)
+					W[t][i] = byte_to_word<endian::big, uint64_t>(input + i * crypto::hash::SHA512::block_size + t * 8);
+			for (int t = 16; t <= 79; t++)
+			{
+				uint64x8_t s0 = (W[t - 15] >> 1 | W[t - 15] << 63) ^ (W[t - 15] >> 8 | W[t - 15] << 56) ^ W[t - 15] >> 7;
+				uint64x8_t s1 = (W[t - 2] >> 19 | W[t - 2] << 45) ^ (W[t - 2] >> 61 | W[t - 2] << 3) ^ W[t - 2] >> 6;
+				W[t] = s1 + W[t - 7] + s0 + W[t - 16];
+			}
+			for (int t = 0; t <= 79; t++)
+				*reinterpret_cast<uint64x8_t*>(WK + t * lanes) = W[t] + sha512_K[t];
+
+			for (int i = 0; i < lanes; i++)
+				sha512_rounds<lanes>(H, WK + i);
+		}
+
+		sha512_compress_avx2(H, input, blocks);
+	}
+#endif
+
+	using sha512_compress_function = void(*)(uint64_t* H, const byte* input, size_t blocks) noexcept;
+
+	sha512_compress_function select_sha512_compress() noexcept
+	{
+#if defined(utils_x86)
+		const auto& feature = utils::cpu_feature::get();
+		if (feature.avx512f)
+			return sha512_compress_avx512;
+		if (feature.avx2)
+			return sha512_compress_avx2;
+#endif
+		return sha512_compress_generic;
+	}
+}
+
+crypto::hash::SHA512::SHA512() noexcept : H{ 0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1, 0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179 }, M_length(0), total_length(0) {}
+
+crypto::hash::SHA512::SHA512(std::initializer_list<word> H) noexcept : SHA512()
+{
+	std::copy(H.begin(), H.end(), this->H);
+}
+
+crypto::hash::SHA512::SHA512(const byte* input, size_t length, byte* output) noexcept : SHA512()
+{
+	this->update(input, length);
+	this->final(output);
+}
+
+void crypto::hash::SHA512::update(const byte* input, size_t length) noexcept
+{
+	::update<block_size>(input, length, this->M, this->M_length, this->total_length, [&](const byte* p, size_t blocks) { this->compress(p, blocks); });
+}
+
+void crypto::hash::SHA512::final(byte* output) noexcept
+{
+	::final<block_size>(output, this->H, this->M, this->M_length, this->total_length, [&](const byte* p, size_t blocks) { this->compress(p, blocks); });
+}
+
+void crypto::hash::SHA512::compress(const byte* input, size_t blocks) noexcept
+{
+	static const sha512_compress_function f = select_sha512_compress();
+	f(this->H, input, blocks);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6,6 +6,12 @@
 
 //FIPS 180-4
 
+namespace crypto::cipher
+{
+	template<typename Cipher>
+	class CTR_HMAC_SHA256;
+}
+
 namespace crypto::hash
 {
 	class SHA1
@@ -23,7 +29,8 @@ namespace crypto::hash
 	private:
 		typedef uint32_t word;
 
-		void compress() noexcept;
+		//uses the SHA extensions where supported
+		void compress(const byte* input, size_t blocks) noexcept;
 
 		word H[5];
 		byte M[block_size];
@@ -43,13 +50,29 @@ namespace crypto::hash
 		static constexpr int block_size = 64;
 		static constexpr int output_size = 32;
 
+		//the round constants, also used by SHA256_multi and the stitched kernels
+		alignas(16) static constexpr uint32_t K[64] = {
+			0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+			0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+			0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+			0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+			0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+			0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+			0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+			0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+		};
+
 	protected:
 		typedef uint32_t word;
 
 		SHA256(std::initializer_list<word> H) noexcept;
 
 	private:
-		void compress() noexcept;
+		template<typename>
+		friend class cipher::CTR_HMAC_SHA256;
+
+		//uses the SHA extensions where supported
+		void compress(const byte* input, size_t blocks) noexcept;
 
 		word H[8];
 		byte M[block_size];
@@ -68,6 +91,38 @@ namespace crypto::hash
 		static constexpr int output_size = 28;
 	};
 
+	//hashes up to max_lanes independent messages in lockstep, lane i of the vector registers holds message i.
+	//uses AVX-512 (16 lanes) or AVX2 (8 lanes) where supported, otherwise the messages are hashed one by one
+	class SHA256_multi
+	{
+	public:
+		explicit SHA256_multi(int lanes) noexcept;
+		SHA256_multi(int lanes, const byte* const* input, size_t length, byte* const* output) noexcept;
+
+		//input[i] is the next length bytes of message i, every message grows by the same length
+		void update(const byte* const* input, size_t length) noexcept;
+		void final(byte* const* output) noexcept;
+
+		//n messages of any length, a lane sits idle once its message is done until the longest one in its group is
+		static void hash(size_t n, const byte* const* input, const size_t* length, byte* const* output) noexcept;
+
+		static constexpr int block_size = 64;
+		static constexpr int output_size = 32;
+		static constexpr int max_lanes = 16;
+
+	private:
+		typedef uint32_t word;
+
+		void compress(const byte* const* input, size_t blocks) noexcept;
+
+		//word j of message i is H[j * max_lanes + i]
+		alignas(64) word H[8 * max_lanes];
+		byte M[max_lanes][block_size];
+		int lanes;
+		int M_length;
+		uint64_t total_length;
+	};
+
 	class SHA512
 	{
 	public:
@@ -86,7 +141,8 @@ namespace crypto::hash
 		SHA512(std::initializer_list<word> H) noexcept;
 
 	private:
-		void compress() noexcept;
+		//expands the message schedules of several blocks at once with AVX2 or AVX-512 where supported
+		void compress(const byte* input, size_t blocks) noexcept;
 
 		word H[8];
 		byte M[block_size];
@@ -0,0 +1,484 @@
+#include"SHA3.h"
+#include<algorithm>
+#include<utils/bit.h>
+#include<utils/cpu.h>
+
+using namespace crypto;
+using utils::endian;
+using utils::byte_to_word;
+using utils::word_to_byte;
+
+namespace
+{
+	constexpr uint64_t RC[24] = {
+		0x0000000000000001, 0x0000000000008082, 0x800000000000808a, 0x8000000080008000,
+		0x000000000000808b, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+		0x000000000000008a, 0x0000000000000088, 0x0000000080008009, 0x000000008000000a,
+		0x000000008000808b, 0x800000000000008b, 0x8000000000008089, 0x8000000000008003,
+		0x8000000000008002, 0x8000000000000080, 0x000000000000800a, 0x800000008000000a,
+		0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008,
+	};
+
+	//rho offsets of lane x + 5 * y
+	constexpr int rho[25] = {
+		0, 1, 62, 28, 27,
+		36, 44, 6, 55, 20,
+		3, 10, 43, 25, 39,
+		41, 45, 15, 21, 8,
+		18, 2, 61, 56, 14,
+	};
+
+	//V is uint64_t, or a vector whose lane i holds the state i. the result is written to out,
+	//as returning a vector from a function without its target changes the ABI
+	template<typename V>
+	__attribute__((always_inline)) inline void rotl(V& out, const V& x, int n) noexcept
+	{
+		out = n ? x << n | x >> (64 - n) : x;
+	}
+
+	//FIPS 202 3.3, Keccak-f[1600] with the steps theta, rho, pi, chi and iota
+	template<typename V>
+	__attribute__((always_inline)) inline void keccak_f(V* A) noexcept
+	{
+		for (int round = 0; round < 24; round++)
+		{
+			V C[5], B[25];
+			for (int x = 0; x < 5; x++)
+				C[x] = A[x] ^ A[x + 5] ^ A[x + 10] ^ A[x + 15] ^ A[x + 20];
+			for (int x = 0; x < 5; x++)
+			{
+				V D;
+				rotl(D, C[(x + 1) % 5], 1);
+				D ^= C[(x + 4) % 5];
+				for (int y = 0; y < 25; y += 5)
+					A[x + y] ^= D;
+			}
+
+			for (int x = 0; x < 5; x++)
+				for (int y = 0; y < 5; y++)
+					rotl(B[y + 5 * ((2 * x + 3 * y) % 5)], A[x + 5 * y], rho[x + 5 * y]);
+
+			for (int y = 0; y < 25; y += 5)
+				for (int x = 0; x < 5; x++)
+					A[x + y] = B[x + y] ^ (~B[(x + 1) % 5 + y] & B[(x + 2) % 5 + y]);
+
+			A[0] ^= RC[round];
+		}
+	}
+
+	void keccak_f_serial(uint64_t* A) noexcept
+	{
+		keccak_f(A);
+	}
+
+	//SP 800-185 2.3.1, returns the length of the encoding
+	int left_encode(uint64_t x, byte* output) noexcept
+	{
+		int n = 1;
+		while (n < 8 && x >> (8 * n))
+			n++;
+		output[0] = static_cast<byte>(n);
+		for (int i = 0; i < n; i++)
+			output[1 + i] = static_cast<byte>(x >> (8 * (n - 1 - i)));
+		return n + 1;
+	}
+
+	int right_encode(uint64_t x, byte* output) noexcept
+	{
+		int n = 1;
+		while (n < 8 && x >> (8 * n))
+			n++;
+		for (int i = 0; i < n; i++)
+			output[i] = static_cast<byte>(x >> (8 * (n - 1 - i)));
+		output[n] = static_cast<byte>(n);
+		return n + 1;
+	}
+
+	//absorbs encode_string(S) and returns its length
+	template<typename Sponge>
+	size_t absorb_string(Sponge& sponge, const byte* S, size_t S_length) noexcept
+	{
+		byte temp[9];
+		const int n = left_encode(static_cast<uint64_t>(S_length) * 8, temp);
+		sponge.update(temp, n);
+		sponge.update(S, S_length);
+		return n + S_length;
+	}
+
+	//the zeros of bytepad() after length bytes
+	template<typename Sponge>
+	void absorb_zero_pad(Sponge& sponge, size_t length, int w) noexcept
+	{
+		constexpr byte zero[crypto::hash::cSHAKE256::block_size] = {};
+		if (length % w)
+			sponge.update(zero, w - length % w);
+	}
+
+	//-------------------------------------------------------------------------------------------------
+
+	//SHAKE256 of width messages of leaf_bytes each, one after another at input, into 64 bytes each
+	constexpr int shake256_rate = crypto::hash::SHAKE256::block_size;
+	constexpr int leaf_size = crypto::hash::ParallelHash256::leaf_size;
+
+	using shake256_leaves_function = void(*)(const byte* input, size_t leaf_bytes, byte* output) noexcept;
+
+#if defined(utils_x86)
+	//the states of the messages are interleaved, lane i of every vector is a lane of the state of message i
+	template<typename V, int width>
+	__attribute__((always_inline)) inline void shake256_lanes(const byte* input, size_t leaf_bytes, byte* output) noexcept
+	{
+		V A[25] = {};
+		auto absorb = [&](const byte* p, size_t stride)
+		{
+			for (int j = 0; j < shake256_rate / 8; j++)
+				for (int i = 0; i < width; i++)
+					A[j][i] ^= byte_to_word<endian::little, uint64_t>(p + i * stride + j * sizeof(uint64_t));
+			keccak_f(A);
+		};
+
+		const size_t blocks = leaf_bytes / shake256_rate;
+		for (size_t k = 0; k < blocks; k++)
+			absorb(input + k * shake256_rate, leaf_bytes);
+
+		const size_t rest = leaf_bytes % shake256_rate;
+		byte pad[width][shake256_rate] = {};
+		for (int i = 0; i < width; i++)
+		{
+			std::copy(input + i * leaf_bytes + blocks * shake256_rate, input + i * leaf_bytes + leaf_bytes, pad[i]);
+			pad[i][rest] ^= 0x1f;
+			pad[i][shake256_rate - 1] ^= 0x80;
+		}
+		absorb(pad[0], shake256_rate);
+
+		for (int i = 0; i < width; i++)
+			for (int j = 0; j < leaf_size / 8; j++)
+				word_to_byte<endian::little>(A[j][i], output + i * leaf_size + j * sizeof(uint64_t));
+	}
+
+	typedef uint64_t uint64x4_t __attribute__((vector_size(32)));
+	typedef uint64_t uint64x8_t __attribute__((vector_size(64)));
+
+	__attribute__((target("avx2")))
+	void shake256_leaves_avx2(const byte* input, size_t leaf_bytes, byte* output) noexcept
+	{
+		shake256_lanes<uint64x4_t, 4>(input, leaf_bytes, output);
+	}
+
+	__attribute__((target("avx512f")))
+	void shake256_leaves_avx512(const byte* input, size_t leaf_bytes, byte* output) noexcept
+	{
+		shake256_lanes<uint64x8_t, 8>(input, leaf_bytes, output);
+	}
+#endif
+
+	void shake256_leaves_serial(const byte* input, size_t leaf_bytes, byte* output) noexcept
+	{
+		crypto::hash::SHAKE256(input, leaf_bytes, output, leaf_size);
+	}
+
+	struct shake256_leaves_kernel
+	{
+		shake256_leaves_function f;
+		int width;
+	};
+
+	shake256_leaves_kernel select_shake256_leaves() noexcept
+	{
+#if defined(utils_x86)
+		const auto& feature = utils::cpu_feature::get();
+		if (feature.avx512f)
+			return { shake256_leaves_avx512, 8 };
+		if (feature.avx2)
+			return { shake256_leaves_avx2, 4 };
+#endif
+		return { shake256_leaves_serial, 1 };
+	}
+
+	void shake256_leaves(const byte* input, size_t n, size_t leaf_bytes, byte* output) noexcept
+	{
+		static const shake256_leaves_kernel kernel = select_shake256_leaves();
+		for (; n >= static_cast<size_t>(kernel.width); n -= kernel.width)
+		{
+			kernel.f(input, leaf_bytes, output);
+			input += kernel.width * leaf_bytes;
+			output += kernel.width * leaf_size;
+		}
+		for (; n; n--, input += leaf_bytes, output += leaf_size)
+			shake256_leaves_serial(input, leaf_bytes, output);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+
+crypto::hash::keccak::keccak(int rate, byte suffix) noexcept : A{}, rate(rate), position(0), suffix(suffix), squeezing(false) {}
+
+void crypto::hash::keccak::update(const byte* input, size_t length) noexcept
+{
+	for (; length && this->position; input++, length--)
+	{
+		this->A[this->position / 8] ^= static_cast<uint64_t>(*input) << (8 * (this->position % 8));
+		if (++this->position == this->rate)
+		{
+			keccak_f_serial(this->A);
+			this->position = 0;
+		}
+	}
+
+	for (; length >= static_cast<size_t>(this->rate); input += this->rate, length -= this->rate)
+	{
+		for (int j = 0; j < this->rate / 8; j++)
+			this->A[j] ^= byte_to_word<endian::little, uint64_t>(input + j * sizeof(uint64_t));
+		keccak_f_serial(this->A);
+	}
+
+	for (; length; input++, length--, this->position++)
+		this->A[this->position / 8] ^= static_cast<uint64_t>(*input) << (8 * (this->position % 8));
+}
+
+void crypto::hash::keccak::squeeze(byte* output, size_t length) noexcept
+{
+	if (!this->squeezing)
+	{
+		this->A[this->position / 8] ^= static_cast<uint64_t>(this->suffix) << (8 * (this->position % 8));
+		this->A[(this->rate - 1) / 8] ^= static_cast<uint64_t>(0x80) << (8 * ((this->rate - 1) % 8));
+		keccak_f_serial(this->A);
+		this->position = 0;
+		this->squeezing = true;
+	}
+
+	for (; length; output++, length--, this->position++)
+	{
+		if (this->position == this->rate)
+		{
+			keccak_f_serial(this->A);
+			this->position = 0;
+		}
+		*output = static_cast<byte>(this->A[this->position / 8] >> (8 * (this->position % 8)));
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+
+crypto::hash::SHA3_256::SHA3_256() noexcept : sponge(block_size, 0x06) {}
+
+crypto::hash::SHA3_256::SHA3_256(const byte* input, size_t length, byte* output) noexcept : SHA3_256()
+{
+	this->update(input, length);
+	this->final(output);
+}
+
+void crypto::hash::SHA3_256::update(const byte* input, size_t length) noexcept
+{
+	this->sponge.update(input, length);
+}
+
+void crypto::hash::SHA3_256::final(byte* output) noexcept
+{
+	this->sponge.squeeze(output, output_size);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+crypto::hash::SHA3_512::SHA3_512() noexcept : sponge(block_size, 0x06) {}
+
+crypto::hash::SHA3_512::SHA3_512(const byte* input, size_t length, byte* output) noexcept : SHA3_512()
+{
+	this->update(input, length);
+	this->final(output);
+}
+
+void crypto::hash::SHA3_512::update(const byte* input, size_t length) noexcept
+{
+	this->sponge.update(input, length);
+}
+
+void crypto::hash::SHA3_512::final(byte* output) noexcept
+{
+	this->sponge.squeeze(output, output_size);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+crypto::hash::SHAKE256::SHAKE256() noexcept : sponge(block_size, 0x1f) {}
+
+crypto::hash::SHAKE256::SHAKE256(const byte* input, size_t length, byte* output, size_t output_length) noexcept : SHAKE256()
+{
+	this->update(input, length);
+	this->final(output, output_length);
+}
+
+void crypto::hash::SHAKE256::update(const byte* input, size_t length) noexcept
+{
+	this->sponge.update(input, length);
+}
+
+void crypto::hash::SHAKE256::final(byte* output, size_t length) noexcept
+{
+	this->sponge.squeeze(output, length);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+//SP 800-185 3.3, bytepad(encode_string(N) || encode_string(S), 136) goes first
+crypto::hash::cSHAKE256::cSHAKE256(const byte* N, size_t N_length, const byte* S, size_t S_length) noexcept : sponge(block_size, N_length || S_length ? 0x04 : 0x1f)
+{
+	if (!N_length && !S_length)
+		return;
+
+	byte temp[9];
+	size_t length = left_encode(block_size, temp);
+	this->sponge.update(temp, length);
+	length += absorb_string(this->sponge, N, N_length);
+	length += absorb_string(this->sponge, S, S_length);
+	absorb_zero_pad(this->sponge, length, block_size);
+}
+
+void crypto::hash::cSHAKE256::update(const byte* input, size_t length) noexcept
+{
+	this->sponge.update(input, length);
+}
+
+void crypto::hash::cSHAKE256::final(byte* output, size_t length) noexcept
+{
+	this->sponge.squeeze(output, length);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+namespace
+{
+	constexpr byte parallel_hash_name[] = { 'P', 'a', 'r', 'a', 'l', 'l', 'e', 'l', 'H', 'a', 's', 'h' };
+	constexpr byte kmac_name[] = { 'K', 'M', 'A', 'C' };
+}
+
+//SP 800-185 6.3, left_encode(B) goes first and every block adds its leaf
+crypto::hash::ParallelHash256::ParallelHash256(size_t block_size, size_t output_size, const byte* S, size_t S_length) noexcept : root(parallel_hash_name, sizeof(parallel_hash_name), S, S_length), leaf_length(0), leaf_count(0), block_size(block_size), output_size(output_size)
+{
+	byte temp[9];
+	this->root.update(temp, left_encode(block_size, temp));
+}
+
+crypto::hash::ParallelHash256::ParallelHash256(size_t block_size, const byte* input, size_t length, byte* output, size_t output_size, const byte* S, size_t S_length) noexcept : ParallelHash256(block_size, output_size, S, S_length)
+{
+	this->update(input, length);
+	this->final(output);
+}
+
+void crypto::hash::ParallelHash256::update(const byte* input, size_t length) noexcept
+{
+	if (this->leaf_length)
+	{
+		size_t outlen = std::min(length, this->block_size - this->leaf_length);
+		this->leaf.update(input, outlen);
+		this->leaf_length += outlen;
+		input += outlen;
+		length -= outlen;
+
+		if (this->leaf_length < this->block_size)
+			return;
+		this->absorb_leaf();
+	}
+
+	//the leaves of whole blocks go to the root in groups
+	constexpr size_t group = 16;
+	for (size_t n = length / this->block_size; n;)
+	{
+		byte hashes[group * leaf_size];
+		const size_t count = std::min(n, group);
+		shake256_leaves(input, count, this->block_size, hashes);
+		this->root.update(hashes, count * leaf_size);
+		this->leaf_count += count;
+		input += count * this->block_size;
+		length -= count * this->block_size;
+		n -= count;
+	}
+
+	this->leaf.update(input, length);
+	this->leaf_length = length;
+}
+
+//the leaves hashed by other threads go to the root like the ones of update()
+void crypto::hash::ParallelHash256::update(const leaves& piece) noexcept
+{
+	if (!piece.hashed_length || this->leaf_length || this->leaf_count * this->block_size != piece.offset)
+	{
+		this->update(piece.input, piece.length);
+		return;
+	}
+
+	this->root.update(piece.hashes.data(), piece.hashes.size());
+	this->leaf_count += piece.hashes.size() / leaf_size;
+	this->update(piece.input + piece.hashed_length, piece.length - piece.hashed_length);
+}
+
+void crypto::hash::ParallelHash256::final(byte* output) noexcept
+{
+	if (this->leaf_length)
+		this->absorb_leaf();
+
+	byte temp[9];
+	this->root.update(temp, right_encode(this->leaf_count, temp));
+	this->root.update(temp, right_encode(static_cast<uint64_t>(this->output_size) * 8, temp));
+	this->root.final(output, this->output_size);
+}
+
+void crypto::hash::ParallelHash256::absorb_leaf() noexcept
+{
+	byte hash[leaf_size];
+	this->leaf.final(hash, leaf_size);
+	this->root.update(hash, leaf_size);
+	this->leaf = SHAKE256();
+	this->leaf_length = 0;
+	this->leaf_count++;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+crypto::hash::ParallelHash256::leaves::leaves(const ParallelHash256& hash, const byte* input, size_t length, uint64_t offset) : input(input), length(length), offset(offset), hashed_length(0)
+{
+	if (offset % hash.block_size)
+		return;
+
+	const size_t n = length / hash.block_size;
+	this->hashes.resize(n * leaf_size);
+	shake256_leaves(input, n, hash.block_size, this->hashes.data());
+	this->hashed_length = n * hash.block_size;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+crypto::MAC::KMAC256::KMAC256(size_t output_size, const byte* S, size_t S_length) noexcept : sponge(kmac_name, sizeof(kmac_name), S, S_length), output_size(output_size) {}
+
+crypto::MAC::KMAC256::KMAC256(const byte* key, size_t keylen, size_t output_size, const byte* S, size_t S_length) noexcept : KMAC256(output_size, S, S_length)
+{
+	this->init(key, keylen);
+}
+
+crypto::MAC::KMAC256::KMAC256(const byte* key, size_t keylen, const byte* input, size_t length, byte* output, size_t output_size, const byte* S, size_t S_length) noexcept : KMAC256(key, keylen, output_size, S, S_length)
+{
+	this->update(input, length);
+	this->final(output);
+}
+
+//SP 800-185 4.3, bytepad(encode_string(K), 136) goes first
+void crypto::MAC::KMAC256::init(const byte* key, size_t keylen) noexcept
+{
+	constexpr int block_size = hash::cSHAKE256::block_size;
+	byte temp[9];
+	size_t length = left_encode(block_size, temp);
+	this->sponge.update(temp, length);
+	length += absorb_string(this->sponge, key, keylen);
+	absorb_zero_pad(this->sponge, length, block_size);
+}
+
+void crypto::MAC::KMAC256::update(const byte* input, size_t length) noexcept
+{
+	this->sponge.update(input, length);
+}
+
+void crypto::MAC::KMAC256::final(byte* output) noexcept
+{
+	byte temp[9];
+	this->sponge.update(temp, right_encode(static_cast<uint64_t>(this->output_size) * 8, temp));
+	this->sponge.final(output, this->output_size);
+}
\ No newline at end of file
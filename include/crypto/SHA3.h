@@ -0,0 +1,157 @@
+#ifndef crypto_SHA3_h
+#define crypto_SHA3_h
+#include"define.h"
+#include<vector>
+
+//FIPS 202 and SP 800-185
+
+namespace crypto::hash
+{
+	//the sponge of Keccak-f[1600], rate bytes are absorbed per permutation.
+	//suffix holds the domain bits that start the padding
+	class keccak
+	{
+	public:
+		keccak(int rate, byte suffix) noexcept;
+
+		void update(const byte* input, size_t length) noexcept;
+		//the first call pads the input, the next ones continue the output
+		void squeeze(byte* output, size_t length) noexcept;
+
+	private:
+		uint64_t A[25];
+		int rate;
+		int position;
+		byte suffix;
+		bool squeezing;
+	};
+
+	class SHA3_256
+	{
+	public:
+		SHA3_256() noexcept;
+		SHA3_256(const byte* input, size_t length, byte* output) noexcept;
+
+		void update(const byte* input, size_t length) noexcept;
+		void final(byte* output) noexcept;
+
+		static constexpr int block_size = 136;
+		static constexpr int output_size = 32;
+
+	private:
+		keccak sponge;
+	};
+
+	class SHA3_512
+	{
+	public:
+		SHA3_512() noexcept;
+		SHA3_512(const byte* input, size_t length, byte* output) noexcept;
+
+		void update(const byte* input, size_t length) noexcept;
+		void final(byte* output) noexcept;
+
+		static constexpr int block_size = 72;
+		static constexpr int output_size = 64;
+
+	private:
+		keccak sponge;
+	};
+
+	//final() may be called repeatedly to extend the output
+	class SHAKE256
+	{
+	public:
+		SHAKE256() noexcept;
+		SHAKE256(const byte* input, size_t length, byte* output, size_t output_length) noexcept;
+
+		void update(const byte* input, size_t length) noexcept;
+		void final(byte* output, size_t length) noexcept;
+
+		static constexpr int block_size = 136;
+
+	private:
+		keccak sponge;
+	};
+
+	//the function name N and customization S are byte strings, with both empty it is SHAKE256
+	class cSHAKE256
+	{
+	public:
+		cSHAKE256(const byte* N, size_t N_length, const byte* S, size_t S_length) noexcept;
+
+		void update(const byte* input, size_t length) noexcept;
+		void final(byte* output, size_t length) noexcept;
+
+		static constexpr int block_size = 136;
+
+	private:
+		keccak sponge;
+	};
+
+	//the input is split into blocks of block_size bytes, which are hashed with SHAKE256 into leaves of 64 bytes.
+	//the leaves of whole blocks are hashed in the lanes of AVX2 or AVX-512 where supported
+	class ParallelHash256
+	{
+	public:
+		class leaves;
+
+		ParallelHash256(size_t block_size, size_t output_size = 64, const byte* S = nullptr, size_t S_length = 0) noexcept;
+		ParallelHash256(size_t block_size, const byte* input, size_t length, byte* output, size_t output_size = 64, const byte* S = nullptr, size_t S_length = 0) noexcept;
+
+		void update(const byte* input, size_t length) noexcept;
+		void update(const leaves& piece) noexcept;
+		void final(byte* output) noexcept;
+
+		static constexpr int leaf_size = 64;
+
+	private:
+		void absorb_leaf() noexcept;
+
+		cSHAKE256 root;
+		SHAKE256 leaf;
+		size_t leaf_length;
+		uint64_t leaf_count;
+		size_t block_size;
+		size_t output_size;
+	};
+
+	//the whole blocks of a piece of the message hashed on any thread, update() takes the pieces in message order.
+	//offset is the position of input in the message, pieces that don't start at a block are left to update()
+	class ParallelHash256::leaves
+	{
+	public:
+		leaves(const ParallelHash256& hash, const byte* input, size_t length, uint64_t offset);
+
+	private:
+		friend class ParallelHash256;
+
+		const byte* input;
+		size_t length;
+		uint64_t offset;
+		std::vector<byte> hashes;
+		size_t hashed_length;
+	};
+}
+
+namespace crypto::MAC
+{
+	//SP 800-185 section 4, output_size bytes with the customization S. init() is called once, before update()
+	class KMAC256
+	{
+	public:
+		KMAC256(size_t output_size = 64, const byte* S = nullptr, size_t S_length = 0) noexcept;
+		KMAC256(const byte* key, size_t keylen, size_t output_size = 64, const byte* S = nullptr, size_t S_length = 0) noexcept;
+		KMAC256(const byte* key, size_t keylen, const byte* input, size_t length, byte* output, size_t output_size = 64, const byte* S = nullptr, size_t S_length = 0) noexcept;
+
+		void init(const byte* key, size_t keylen) noexcept;
+		void update(const byte* input, size_t length) noexcept;
+		void final(byte* output) noexcept;
+
+	private:
+		hash::cSHAKE256 sponge;
+		size_t output_size;
+	};
+}
+
+#endif
\ No newline at end of file
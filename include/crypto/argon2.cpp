@@ -8,6 +8,7 @@
 #include<future>
 #include"blake2.h"
 #include<utils/bit.h>
+#include<utils/thread_pool.h>
 
 //assuming mutex and condition_variable don't throw exceptions
 
@@ -386,7 +387,7 @@ namespace
 		{
 			mutex.lock();
 			for (uint32_t lane = 0; lane < instance.lanes; lane++)
-				vec[lane] = std::async(std::launch::async, f, lane);
+				vec[lane] = utils::thread_pool::global().async([&f, lane]() { f(lane); });
 		}
 		catch (...)
 		{
@@ -1,6 +1,12 @@
 #include"blake2.h"
+#include<utility>
 #include<algorithm>
 #include<utils/bit.h>
+#include<utils/cpu.h>
+
+#if defined(utils_x86)
+#include<immintrin.h>
+#endif
 
 using namespace crypto;
 using utils::endian;
@@ -9,6 +15,20 @@ using utils::word_to_byte;
 
 namespace
 {
+	//rfc 2.7
+	constexpr byte sigma[10][16] = {
+		{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+		{ 14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3 },
+		{ 11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4 },
+		{ 7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8 },
+		{ 9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13 },
+		{ 2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9 },
+		{ 12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11 },
+		{ 13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10 },
+		{ 6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5 },
+		{ 10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0 },
+	};
+
 	//rfc 3.1
 	template<const auto& parameter, typename word>
 	void mixing(word* v, int a, int b, int c, int d, word x, word y) noexcept
@@ -25,21 +45,8 @@ namespace
 
 	//rfc 3.2
 	template<const auto& parameter, typename word, typename T>
-	void compress(word* h, byte* b, T& total_length, bool last) noexcept
-	{
-		constexpr byte sigma[10][16] = {
-			{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
-			{ 14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3 },
-			{ 11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4 },
-			{ 7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8 },
-			{ 9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13 },
-			{ 2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9 },
-			{ 12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11 },
-			{ 13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10 },
-			{ 6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5 },
-			{ 10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0 },
-		};
-
+	void compress(word* h, const byte* b, T& total_length, bool last, bool last_node = false) noexcept
+	{
 		word v[16], m[16];
 
 		std::copy(h, h + 8, v);
@@ -48,6 +55,8 @@ namespace
 		v[13] ^= static_cast<word>(utils::high_bits<utils::bit_size<T> / 2>(total_length));
 		if (last)
 			v[14] = ~v[14];
+		if (last_node)
+			v[15] = ~v[15];
 
 		for (int i = 0; i < 16; i++)
 			m[i] = byte_to_word<endian::little, word>(b + i * sizeof(word));
@@ -68,6 +77,18 @@ namespace
 			h[i] ^= v[i] ^ v[i + 8];
 	}
 
+	//the counter grows by a block before each block is compressed, except the last block whose length the caller has added
+	template<const auto& parameter, int block_size, typename word, typename T>
+	void compress_generic(word* h, const byte* input, size_t blocks, T& total_length, bool last) noexcept
+	{
+		for (; blocks; blocks--, input += block_size)
+		{
+			if (!last)
+				total_length += block_size;
+			compress<parameter>(h, input, total_length, last);
+		}
+	}
+
 	//-------------------------------------------------------------------------------------------------
 
 	template<int block_size, typename word>
@@ -82,25 +103,37 @@ namespace
 		}
 	}
 
-	template<int block_size, typename T, typename F>
-	void update(const byte* input, size_t length, byte* b, int& b_length, T& total_length, F&& compress) noexcept
+	//the last block must be compressed by final(), so at least one byte stays buffered.
+	//compress(input, blocks) is handed the whole blocks before it directly.
+	template<int block_size, typename F>
+	void update(const byte* input, size_t length, byte* b, int& b_length, F&& compress) noexcept
 	{
-		while (length)
-		{
-			if (b_length == block_size)
-			{
-				total_length += b_length;
-				compress();
-				b_length = 0;
-			}
+		if (!length)
+			return;
 
-			int outlen = (b_length + length < block_size) ? length : block_size - b_length;
+		if (b_length)
+		{
+			//b_length is block_size after init() with a key
+			size_t outlen = std::min<size_t>(length, block_size - b_length);
 			std::copy(input, input + outlen, b + b_length);
 
 			b_length += outlen;
 			input += outlen;
 			length -= outlen;
+
+			if (!length)
+				return;
+			compress(b, 1);
+			b_length = 0;
 		}
+
+		size_t blocks = (length - 1) / block_size;
+		compress(input, blocks);
+		input += blocks * block_size;
+		length -= blocks * block_size;
+
+		std::copy(input, input + length, b);
+		b_length = static_cast<int>(length);
 	}
 
 	template<int block_size, typename word, typename T, typename F>
@@ -127,6 +160,204 @@ namespace
 	constexpr blake2_parameter<uint64_t> blake2b_parameter = { { 0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1, 0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179 }, 12, { 32, 24, 16, 63 } };
 	constexpr blake2_parameter<uint32_t> blake2s_parameter = { { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 }, 10, { 16, 12, 8, 7 } };
 
+	//-------------------------------------------------------------------------------------------------
+
+	using blake2b_compress_function = void(*)(uint64_t* h, const byte* input, size_t blocks, utils::uint128_t& total_length, bool last) noexcept;
+	using blake2s_compress_function = void(*)(uint32_t* h, const byte* input, size_t blocks, uint64_t& total_length, bool last) noexcept;
+
+#if defined(utils_x86)
+	//the 4x4 state is kept as 4 rows, the column step mixes the rows lane by lane,
+	//then b, c and d are rotated so that the diagonal step is a column step too.
+	//the message words of every round are picked with the round number known at compile time.
+
+	template<int r>
+	__attribute__((target("avx2")))
+	inline void blake2b_round_avx2(__m256i& a, __m256i& b, __m256i& c, __m256i& d, const uint64_t* m) noexcept
+	{
+		const __m256i rotr24 = _mm256_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10, 3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+		const __m256i rotr16 = _mm256_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9, 2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+		constexpr const byte* s = sigma[r % 10];
+		const __m256i m0 = _mm256_set_epi64x(m[s[6]], m[s[4]], m[s[2]], m[s[0]]);
+		const __m256i m1 = _mm256_set_epi64x(m[s[7]], m[s[5]], m[s[3]], m[s[1]]);
+		const __m256i m2 = _mm256_set_epi64x(m[s[14]], m[s[12]], m[s[10]], m[s[8]]);
+		const __m256i m3 = _mm256_set_epi64x(m[s[15]], m[s[13]], m[s[11]], m[s[9]]);
+
+		a = _mm256_add_epi64(_mm256_add_epi64(a, b), m0);
+		d = _mm256_shuffle_epi32(_mm256_xor_si256(d, a), 0xb1);
+		c = _mm256_add_epi64(c, d);
+		b = _mm256_shuffle_epi8(_mm256_xor_si256(b, c), rotr24);
+		a = _mm256_add_epi64(_mm256_add_epi64(a, b), m1);
+		d = _mm256_shuffle_epi8(_mm256_xor_si256(d, a), rotr16);
+		c = _mm256_add_epi64(c, d);
+		b = _mm256_xor_si256(b, c);
+		b = _mm256_or_si256(_mm256_srli_epi64(b, 63), _mm256_add_epi64(b, b));
+
+		b = _mm256_permute4x64_epi64(b, 0x39);
+		c = _mm256_permute4x64_epi64(c, 0x4e);
+		d = _mm256_permute4x64_epi64(d, 0x93);
+
+		a = _mm256_add_epi64(_mm256_add_epi64(a, b), m2);
+		d = _mm256_shuffle_epi32(_mm256_xor_si256(d, a), 0xb1);
+		c = _mm256_add_epi64(c, d);
+		b = _mm256_shuffle_epi8(_mm256_xor_si256(b, c), rotr24);
+		a = _mm256_add_epi64(_mm256_add_epi64(a, b), m3);
+		d = _mm256_shuffle_epi8(_mm256_xor_si256(d, a), rotr16);
+		c = _mm256_add_epi64(c, d);
+		b = _mm256_xor_si256(b, c);
+		b = _mm256_or_si256(_mm256_srli_epi64(b, 63), _mm256_add_epi64(b, b));
+
+		b = _mm256_permute4x64_epi64(b, 0x93);
+		c = _mm256_permute4x64_epi64(c, 0x4e);
+		d = _mm256_permute4x64_epi64(d, 0x39);
+	}
+
+	template<size_t... r>
+	__attribute__((target("avx2")))
+	inline void blake2b_rounds_avx2(__m256i& a, __m256i& b, __m256i& c, __m256i& d, const uint64_t* m, std::index_sequence<r...>) noexcept
+	{
+		(blake2b_round_avx2<r>(a, b, c, d, m), ...);
+	}
+
+	__attribute__((target("avx2")))
+	void blake2b_compress_avx2(uint64_t* h, const byte* input, size_t blocks, utils::uint128_t& total_length, bool last) noexcept
+	{
+		constexpr int block_size = crypto::MAC::blake2b::block_size;
+		const __m256i iv0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blake2b_parameter.IV));
+		const __m256i iv1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blake2b_parameter.IV + 4));
+		__m256i h0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(h));
+		__m256i h1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(h + 4));
+
+		for (; blocks; blocks--, input += block_size)
+		{
+			if (!last)
+				total_length += block_size;
+
+			uint64_t m[16];
+			for (int i = 0; i < 16; i++)
+				m[i] = byte_to_word<endian::little, uint64_t>(input + i * sizeof(uint64_t));
+
+			__m256i a = h0, b = h1, c = iv0;
+			__m256i d = _mm256_xor_si256(iv1, _mm256_set_epi64x(0, last ? -1 : 0, static_cast<uint64_t>(utils::high_bits<64>(total_length)), static_cast<uint64_t>(utils::low_bits<64>(total_length))));
+			blake2b_rounds_avx2(a, b, c, d, m, std::make_index_sequence<blake2b_parameter.r>());
+
+			h0 = _mm256_xor_si256(h0, _mm256_xor_si256(a, c));
+			h1 = _mm256_xor_si256(h1, _mm256_xor_si256(b, d));
+		}
+
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(h), h0);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(h + 4), h1);
+	}
+
+	template<int r>
+	__attribute__((target("sse4.1")))
+	inline void blake2s_round_sse41(__m128i& a, __m128i& b, __m128i& c, __m128i& d, const uint32_t* m) noexcept
+	{
+		const __m128i rotr16 = _mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+		const __m128i rotr8 = _mm_setr_epi8(1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12);
+		constexpr const byte* s = sigma[r % 10];
+		const __m128i m0 = _mm_set_epi32(m[s[6]], m[s[4]], m[s[2]], m[s[0]]);
+		const __m128i m1 = _mm_set_epi32(m[s[7]], m[s[5]], m[s[3]], m[s[1]]);
+		const __m128i m2 = _mm_set_epi32(m[s[14]], m[s[12]], m[s[10]], m[s[8]]);
+		const __m128i m3 = _mm_set_epi32(m[s[15]], m[s[13]], m[s[11]], m[s[9]]);
+
+		a = _mm_add_epi32(_mm_add_epi32(a, b), m0);
+		d = _mm_shuffle_epi8(_mm_xor_si128(d, a), rotr16);
+		c = _mm_add_epi32(c, d);
+		b = _mm_xor_si128(b, c);
+		b = _mm_or_si128(_mm_srli_epi32(b, 12), _mm_slli_epi32(b, 20));
+		a = _mm_add_epi32(_mm_add_epi32(a, b), m1);
+		d = _mm_shuffle_epi8(_mm_xor_si128(d, a), rotr8);
+		c = _mm_add_epi32(c, d);
+		b = _mm_xor_si128(b, c);
+		b = _mm_or_si128(_mm_srli_epi32(b, 7), _mm_slli_epi32(b, 25));
+
+		b = _mm_shuffle_epi32(b, 0x39);
+		c = _mm_shuffle_epi32(c, 0x4e);
+		d = _mm_shuffle_epi32(d, 0x93);
+
+		a = _mm_add_epi32(_mm_add_epi32(a, b), m2);
+		d = _mm_shuffle_epi8(_mm_xor_si128(d, a), rotr16);
+		c = _mm_add_epi32(c, d);
+		b = _mm_xor_si128(b, c);
+		b = _mm_or_si128(_mm_srli_epi32(b, 12), _mm_slli_epi32(b, 20));
+		a = _mm_add_epi32(_mm_add_epi32(a, b), m3);
+		d = _mm_shuffle_epi8(_mm_xor_si128(d, a), rotr8);
+		c = _mm_add_epi32(c, d);
+		b = _mm_xor_si128(b, c);
+		b = _mm_or_si128(_mm_srli_epi32(b, 7), _mm_slli_epi32(b, 25));
+
+		b = _mm_shuffle_epi32(b, 0x93);
+		c = _mm_shuffle_epi32(c, 0x4e);
+		d = _mm_shuffle_epi32(d, 0x39);
+	}
+
+	template<size_t... r>
+	__attribute__((target("sse4.1")))
+	inline void blake2s_rounds_sse41(__m128i& a, __m128i& b, __m128i& c, __m128i& d, const uint32_t* m, std::index_sequence<r...>) noexcept
+	{
+		(blake2s_round_sse41<r>(a, b, c, d, m), ...);
+	}
+
+	__attribute__((target("sse4.1")))
+	void blake2s_compress_sse41(uint32_t* h, const byte* input, size_t blocks, uint64_t& total_length, bool last) noexcept
+	{
+		constexpr int block_size = crypto::MAC::blake2s::block_size;
+		const __m128i iv0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(blake2s_parameter.IV));
+		const __m128i iv1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(blake2s_parameter.IV + 4));
+		__m128i h0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(h));
+		__m128i h1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(h + 4));
+
+		for (; blocks; blocks--, input += block_size)
+		{
+			if (!last)
+				total_length += block_size;
+
+			uint32_t m[16];
+			for (int i = 0; i < 16; i++)
+				m[i] = byte_to_word<endian::little, uint32_t>(input + i * sizeof(uint32_t));
+
+			__m128i a = h0, b = h1, c = iv0;
+			__m128i d = _mm_xor_si128(iv1, _mm_set_epi32(0, last ? -1 : 0, static_cast<uint32_t>(total_length >> 32), static_cast<uint32_t>(total_length)));
+			blake2s_rounds_sse41(a, b, c, d, m, std::make_index_sequence<blake2s_parameter.r>());
+
+			h0 = _mm_xor_si128(h0, _mm_xor_si128(a, c));
+			h1 = _mm_xor_si128(h1, _mm_xor_si128(b, d));
+		}
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(h), h0);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(h + 4), h1);
+	}
+#endif
+
+	blake2b_compress_function select_blake2b_compress() noexcept
+	{
+#if defined(utils_x86)
+		if (utils::cpu_feature::get().avx2)
+			return blake2b_compress_avx2;
+#endif
+		return compress_generic<blake2b_parameter, crypto::MAC::blake2b::block_size>;
+	}
+
+	blake2s_compress_function select_blake2s_compress() noexcept
+	{
+#if defined(utils_x86)
+		if (utils::cpu_feature::get().sse41)
+			return blake2s_compress_sse41;
+#endif
+		return compress_generic<blake2s_parameter, crypto::MAC::blake2s::block_size>;
+	}
+
+	void blake2b_compress(uint64_t* h, const byte* input, size_t blocks, utils::uint128_t& total_length, bool last) noexcept
+	{
+		static const blake2b_compress_function f = select_blake2b_compress();
+		f(h, input, blocks, total_length, last);
+	}
+
+	void blake2s_compress(uint32_t* h, const byte* input, size_t blocks, uint64_t& total_length, bool last) noexcept
+	{
+		static const blake2s_compress_function f = select_blake2s_compress();
+		f(h, input, blocks, total_length, last);
+	}
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -151,13 +382,13 @@ void crypto::MAC::blake2b::init(const byte* key, int keylen) noexcept
 
 void crypto::MAC::blake2b::update(const byte* input, size_t length) noexcept
 {
-	auto compress = [&]() { ::compress<blake2b_parameter>(this->h, this->b, this->total_length, false); };
-	::update<block_size>(input, length, this->b, this->b_length, this->total_length, compress);
+	auto compress = [&](const byte* p, size_t blocks) { blake2b_compress(this->h, p, blocks, this->total_length, false); };
+	::update<block_size>(input, length, this->b, this->b_length, compress);
 }
 
 void crypto::MAC::blake2b::final(byte* output) noexcept
 {
-	auto compress = [&]() { ::compress<blake2b_parameter>(this->h, this->b, this->total_length, true); };
+	auto compress = [&]() { blake2b_compress(this->h, this->b, 1, this->total_length, true); };
 	::final<block_size>(output, this->h, this->b, this->b_length, this->output_size, this->total_length, compress);
 }
 
@@ -183,18 +414,366 @@ void crypto::MAC::blake2s::init(const byte* key, int keylen) noexcept
 
 void crypto::MAC::blake2s::update(const byte* input, size_t length) noexcept
 {
-	auto compress = [&]() { ::compress<blake2s_parameter>(this->h, this->b, this->total_length, false); };
-	::update<block_size>(input, length, this->b, this->b_length, this->total_length, compress);
+	auto compress = [&](const byte* p, size_t blocks) { blake2s_compress(this->h, p, blocks, this->total_length, false); };
+	::update<block_size>(input, length, this->b, this->b_length, compress);
 }
 
 void crypto::MAC::blake2s::final(byte* output) noexcept
 {
-	auto compress = [&]() { ::compress<blake2s_parameter>(this->h, this->b, this->total_length, true); };
+	auto compress = [&]() { blake2s_compress(this->h, this->b, 1, this->total_length, true); };
 	::final<block_size>(output, this->h, this->b, this->b_length, this->output_size, this->total_length, compress);
 }
 
 //-------------------------------------------------------------------------------------------------
 
+namespace
+{
+	//parameter block of a node in the tree of depth 2 used by BLAKE2bp and BLAKE2sp, leaf_length is 0
+	template<typename word>
+	void tree_parameter(word* h, int output_size, int keylen, int fanout, int node_offset, int node_depth, int inner_size) noexcept
+	{
+		h[0] ^= output_size ^ (keylen << 8) ^ (fanout << 16) ^ (2 << 24);
+		if constexpr (sizeof(word) == 8)
+		{
+			h[1] ^= node_offset;
+			h[2] ^= node_depth ^ (inner_size << 8);
+		}
+		else
+		{
+			h[2] ^= node_offset;
+			h[3] ^= (node_depth << 16) ^ (inner_size << 24);
+		}
+	}
+
+	//every leaf compresses its block of each stripe, the leaves share the counter
+	template<typename word, typename T, typename F>
+	void compress_leaves_serial(word* h, int leaves, int block_size, const byte* input, size_t stripes, T& total_length, F&& compress) noexcept
+	{
+		for (int i = 0; i < leaves; i++)
+		{
+			word state[8];
+			T counter = total_length;
+			for (int j = 0; j < 8; j++)
+				state[j] = h[j * leaves + i];
+			for (size_t k = 0; k < stripes; k++)
+				compress(state, input + (k * leaves + i) * block_size, 1, counter, false);
+			for (int j = 0; j < 8; j++)
+				h[j * leaves + i] = state[j];
+		}
+		total_length += static_cast<T>(stripes * block_size);
+	}
+
+#if defined(utils_x86)
+	//lane i of every vector holds leaf i, written with vector extensions like the SHA-256 lanes
+	template<const auto& parameter, typename V, typename word>
+	__attribute__((always_inline)) inline void mixing_leaves(V* v, int a, int b, int c, int d, const V& x, const V& y) noexcept
+	{
+		constexpr int bits = sizeof(word) * 8;
+		v[a] = v[a] + v[b] + x;
+		v[d] = (v[d] ^ v[a]) >> parameter.R[0] | (v[d] ^ v[a]) << (bits - parameter.R[0]);
+		v[c] = v[c] + v[d];
+		v[b] = (v[b] ^ v[c]) >> parameter.R[1] | (v[b] ^ v[c]) << (bits - parameter.R[1]);
+		v[a] = v[a] + v[b] + y;
+		v[d] = (v[d] ^ v[a]) >> parameter.R[2] | (v[d] ^ v[a]) << (bits - parameter.R[2]);
+		v[c] = v[c] + v[d];
+		v[b] = (v[b] ^ v[c]) >> parameter.R[3] | (v[b] ^ v[c]) << (bits - parameter.R[3]);
+	}
+
+	template<const auto& parameter, typename V, typename word, int leaves, int block_size, typename T>
+	__attribute__((always_inline)) inline void compress_leaves_vector(word* h, const byte* input, size_t stripes, T& total_length) noexcept
+	{
+		V* state = reinterpret_cast<V*>(h);
+		for (; stripes; stripes--, input += leaves * block_size)
+		{
+			total_length += block_size;
+
+			V m[16], v[16] = {};
+			for (int j = 0; j < 16; j++)
+				for (int i = 0; i < leaves; i++)
+					m[j][i] = byte_to_word<endian::little, word>(input + i * block_size + j * sizeof(word));
+
+			for (int j = 0; j < 8; j++)
+			{
+				v[j] = state[j];
+				v[j + 8] = V{} + parameter.IV[j];
+			}
+			v[12] ^= static_cast<word>(utils::low_bits<utils::bit_size<T> / 2>(total_length));
+			v[13] ^= static_cast<word>(utils::high_bits<utils::bit_size<T> / 2>(total_length));
+
+			for (int r = 0; r < parameter.r; r++)
+			{
+				const byte* s = sigma[r % 10];
+				mixing_leaves<parameter, V, word>(v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+				mixing_leaves<parameter, V, word>(v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+				mixing_leaves<parameter, V, word>(v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+				mixing_leaves<parameter, V, word>(v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+				mixing_leaves<parameter, V, word>(v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+				mixing_leaves<parameter, V, word>(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+				mixing_leaves<parameter, V, word>(v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+				mixing_leaves<parameter, V, word>(v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+			}
+
+			for (int j = 0; j < 8; j++)
+				state[j] ^= v[j] ^ v[j + 8];
+		}
+	}
+
+	typedef uint64_t uint64x4_t __attribute__((vector_size(32)));
+	typedef uint32_t uint32x8_t __attribute__((vector_size(32)));
+
+	__attribute__((target("avx2")))
+	void blake2bp_compress_avx2(uint64_t* h, const byte* input, size_t stripes, utils::uint128_t& total_length) noexcept
+	{
+		compress_leaves_vector<blake2b_parameter, uint64x4_t, uint64_t, crypto::MAC::blake2bp::leaves, crypto::MAC::blake2bp::block_size>(h, input, stripes, total_length);
+	}
+
+	__attribute__((target("avx2")))
+	void blake2sp_compress_avx2(uint32_t* h, const byte* input, size_t stripes, uint64_t& total_length) noexcept
+	{
+		compress_leaves_vector<blake2s_parameter, uint32x8_t, uint32_t, crypto::MAC::blake2sp::leaves, crypto::MAC::blake2sp::block_size>(h, input, stripes, total_length);
+	}
+#endif
+
+	void blake2bp_compress_serial(uint64_t* h, const byte* input, size_t stripes, utils::uint128_t& total_length) noexcept
+	{
+		compress_leaves_serial(h, crypto::MAC::blake2bp::leaves, crypto::MAC::blake2bp::block_size, input, stripes, total_length, blake2b_compress);
+	}
+
+	void blake2sp_compress_serial(uint32_t* h, const byte* input, size_t stripes, uint64_t& total_length) noexcept
+	{
+		compress_leaves_serial(h, crypto::MAC::blake2sp::leaves, crypto::MAC::blake2sp::block_size, input, stripes, total_length, blake2s_compress);
+	}
+
+	using blake2bp_compress_function = void(*)(uint64_t* h, const byte* input, size_t stripes, utils::uint128_t& total_length) noexcept;
+	using blake2sp_compress_function = void(*)(uint32_t* h, const byte* input, size_t stripes, uint64_t& total_length) noexcept;
+
+	blake2bp_compress_function select_blake2bp_compress() noexcept
+	{
+#if defined(utils_x86)
+		if (utils::cpu_feature::get().avx2)
+			return blake2bp_compress_avx2;
+#endif
+		return blake2bp_compress_serial;
+	}
+
+	blake2sp_compress_function select_blake2sp_compress() noexcept
+	{
+#if defined(utils_x86)
+		if (utils::cpu_feature::get().avx2)
+			return blake2sp_compress_avx2;
+#endif
+		return blake2sp_compress_serial;
+	}
+
+	//-------------------------------------------------------------------------------------------------
+
+	template<typename word, int leaves>
+	void init_leaves(const byte* key, int keylen, word* h, byte* key_block, bool& key_pending, int output_size) noexcept
+	{
+		constexpr int block_size = 16 * sizeof(word);
+		for (int i = 0; i < leaves; i++)
+		{
+			word leaf[8] = {};
+			tree_parameter(leaf, output_size, keylen, leaves, i, 0, 8 * sizeof(word));
+			for (int j = 0; j < 8; j++)
+				h[j * leaves + i] ^= leaf[j];
+		}
+
+		key_pending = keylen;
+		std::copy(key, key + keylen, key_block);
+		std::fill(key_block + keylen, key_block + block_size, 0);
+	}
+
+	//a stripe is one block for every leaf. a stripe is compressed once more than 2 stripes are pending,
+	//so the last block of every leaf stays buffered for final(). the key block goes first to every leaf.
+	template<typename word, int leaves, typename F>
+	void update_leaves(const byte* input, size_t length, byte* b, int& b_length, const byte* key_block, bool& key_pending, F&& compress) noexcept
+	{
+		constexpr int block_size = 16 * sizeof(word);
+		constexpr size_t stripe_size = leaves * block_size;
+		if (b_length + length <= 2 * stripe_size)
+		{
+			std::copy(input, input + length, b + b_length);
+			b_length += static_cast<int>(length);
+			return;
+		}
+
+		if (key_pending)
+		{
+			byte stripe[stripe_size];
+			for (int i = 0; i < leaves; i++)
+				std::copy(key_block, key_block + block_size, stripe + i * block_size);
+			compress(stripe, 1);
+			key_pending = false;
+		}
+
+		//leave between 1 and 2 stripes pending, the buffer is topped up to whole stripes first
+		const size_t stripes = (b_length + length - stripe_size - 1) / stripe_size;
+		const size_t fill = (stripe_size - b_length % stripe_size) % stripe_size;
+		std::copy(input, input + fill, b + b_length);
+		input += fill;
+		length -= fill;
+		const size_t buffered = (b_length + fill) / stripe_size;
+
+		if (stripes < buffered)
+		{
+			compress(b, 1);
+			std::copy(b + stripe_size, b + 2 * stripe_size, b);
+			std::copy(input, input + length, b + stripe_size);
+			b_length = static_cast<int>(stripe_size + length);
+			return;
+		}
+
+		compress(b, buffered);
+		compress(input, stripes - buffered);
+		input += (stripes - buffered) * stripe_size;
+		length -= (stripes - buffered) * stripe_size;
+
+		std::copy(input, input + length, b);
+		b_length = static_cast<int>(length);
+	}
+
+	//each leaf finishes its pending blocks, then the root hashes the leaf hashes
+	template<const auto& parameter, typename word, int leaves, typename T>
+	void final_leaves(byte* output, word* h, const byte* b, int b_length, const byte* key_block, bool key_pending, int keylen, int output_size, const T& total_length) noexcept
+	{
+		constexpr int block_size = 16 * sizeof(word);
+		constexpr int inner_size = 8 * sizeof(word);
+		byte inner[leaves * inner_size];
+
+		for (int i = 0; i < leaves; i++)
+		{
+			word state[8];
+			T counter = total_length;
+			for (int j = 0; j < 8; j++)
+				state[j] = h[j * leaves + i];
+
+			const byte* blocks[3];
+			int lengths[3];
+			int n = 0;
+			if (key_pending)
+			{
+				blocks[n] = key_block;
+				lengths[n++] = block_size;
+			}
+			for (int offset = i * block_size; offset < b_length; offset += leaves * block_size)
+			{
+				blocks[n] = b + offset;
+				lengths[n++] = std::min(block_size, b_length - offset);
+			}
+
+			for (int k = 0; k + 1 < n; k++)
+			{
+				counter += block_size;
+				compress<parameter>(state, blocks[k], counter, false);
+			}
+
+			byte last[block_size] = {};
+			if (n)
+			{
+				std::copy(blocks[n - 1], blocks[n - 1] + lengths[n - 1], last);
+				counter += lengths[n - 1];
+			}
+			compress<parameter>(state, last, counter, true, i == leaves - 1);
+
+			for (int j = 0; j < 8; j++)
+				word_to_byte<endian::little>(state[j], inner + i * inner_size + j * sizeof(word));
+		}
+
+		word root[8];
+		T counter = 0;
+		std::copy(parameter.IV, parameter.IV + 8, root);
+		tree_parameter(root, output_size, keylen, leaves, 0, 1, inner_size);
+		for (int k = 0; k < leaves * inner_size / block_size; k++)
+		{
+			const bool last = k == leaves * inner_size / block_size - 1;
+			counter += block_size;
+			compress<parameter>(root, inner + k * block_size, counter, last, last);
+		}
+
+		byte temp[8 * sizeof(word)];
+		for (int i = 0; i < 8; i++)
+			word_to_byte<endian::little>(root[i], temp + i * sizeof(word));
+		std::copy(temp, temp + output_size, output);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+
+crypto::MAC::blake2bp::blake2bp(int output_size) noexcept : b_length(0), key_pending(false), keylen(0), output_size(output_size), total_length(0)
+{
+	for (int j = 0; j < 8; j++)
+		std::fill(this->h + j * leaves, this->h + (j + 1) * leaves, blake2b_parameter.IV[j]);
+}
+
+crypto::MAC::blake2bp::blake2bp(const byte* key, int keylen, int output_size) noexcept : blake2bp(output_size)
+{
+	this->init(key, keylen);
+}
+
+crypto::MAC::blake2bp::blake2bp(const byte* key, int keylen, const byte* input, size_t length, byte* output, int output_size) noexcept : blake2bp(key, keylen, output_size)
+{
+	this->update(input, length);
+	this->final(output);
+}
+
+void crypto::MAC::blake2bp::init(const byte* key, int keylen) noexcept
+{
+	this->keylen = keylen;
+	::init_leaves<word, leaves>(key, keylen, this->h, this->key, this->key_pending, this->output_size);
+}
+
+void crypto::MAC::blake2bp::update(const byte* input, size_t length) noexcept
+{
+	static const blake2bp_compress_function f = select_blake2bp_compress();
+	auto compress = [&](const byte* p, size_t stripes) { f(this->h, p, stripes, this->total_length); };
+	::update_leaves<word, leaves>(input, length, this->b, this->b_length, this->key, this->key_pending, compress);
+}
+
+void crypto::MAC::blake2bp::final(byte* output) noexcept
+{
+	::final_leaves<blake2b_parameter, word, leaves>(output, this->h, this->b, this->b_length, this->key, this->key_pending, this->keylen, this->output_size, this->total_length);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+crypto::MAC::blake2sp::blake2sp(int output_size) noexcept : b_length(0), key_pending(false), keylen(0), output_size(output_size), total_length(0)
+{
+	for (int j = 0; j < 8; j++)
+		std::fill(this->h + j * leaves, this->h + (j + 1) * leaves, blake2s_parameter.IV[j]);
+}
+
+crypto::MAC::blake2sp::blake2sp(const byte* key, int keylen, int output_size) noexcept : blake2sp(output_size)
+{
+	this->init(key, keylen);
+}
+
+crypto::MAC::blake2sp::blake2sp(const byte* key, int keylen, const byte* input, size_t length, byte* output, int output_size) noexcept : blake2sp(key, keylen, output_size)
+{
+	this->update(input, length);
+	this->final(output);
+}
+
+void crypto::MAC::blake2sp::init(const byte* key, int keylen) noexcept
+{
+	this->keylen = keylen;
+	::init_leaves<word, leaves>(key, keylen, this->h, this->key, this->key_pending, this->output_size);
+}
+
+void crypto::MAC::blake2sp::update(const byte* input, size_t length) noexcept
+{
+	static const blake2sp_compress_function f = select_blake2sp_compress();
+	auto compress = [&](const byte* p, size_t stripes) { f(this->h, p, stripes, this->total_length); };
+	::update_leaves<word, leaves>(input, length, this->b, this->b_length, this->key, this->key_pending, compress);
+}
+
+void crypto::MAC::blake2sp::final(byte* output) noexcept
+{
+	::final_leaves<blake2s_parameter, word, leaves>(output, this->h, this->b, this->b_length, this->key, this->key_pending, this->keylen, this->output_size, this->total_length);
+}
+
+//-------------------------------------------------------------------------------------------------
+
 crypto::hash::blake2b::blake2b(int output_size) noexcept : MAC::blake2b(nullptr, 0, output_size) {}
 
 crypto::hash::blake2b::blake2b(const byte* input, size_t length, byte* output, int output_size) noexcept : MAC::blake2b(nullptr, 0, input, length, output, output_size) {}
@@ -54,6 +54,67 @@ namespace crypto::MAC
 		int output_size;
 		uint64_t total_length;
 	};
+
+	//BLAKE2bp and BLAKE2sp from the BLAKE2 paper, the input blocks are dealt to the leaves in turn
+	//and a root node hashes the leaf hashes. the leaves run in the lanes of AVX2 where supported.
+
+	//0 <= keylen <= 64, 1 <= output_size <= 64
+	class blake2bp
+	{
+	public:
+		blake2bp(int output_size = 64) noexcept;
+		blake2bp(const byte* key, int keylen, int output_size = 64) noexcept;
+		blake2bp(const byte* key, int keylen, const byte* input, size_t length, byte* output, int output_size = 64) noexcept;
+
+		void init(const byte* key, int keylen) noexcept;
+		void update(const byte* input, size_t length) noexcept;
+		void final(byte* output) noexcept;
+
+		static constexpr int block_size = 128;
+		static constexpr int leaves = 4;
+
+	private:
+		typedef uint64_t word;
+
+		//word j of leaf i is h[j * leaves + i], the leaves share the counter
+		alignas(32) word h[8 * leaves];
+		byte b[2 * leaves * block_size];
+		byte key[block_size];
+		int b_length;
+		bool key_pending;
+		int keylen;
+		int output_size;
+		utils::uint128_t total_length;
+	};
+
+	//0 <= keylen <= 32, 1 <= output_size <= 32
+	class blake2sp
+	{
+	public:
+		blake2sp(int output_size = 32) noexcept;
+		blake2sp(const byte* key, int keylen, int output_size = 32) noexcept;
+		blake2sp(const byte* key, int keylen, const byte* input, size_t length, byte* output, int output_size = 32) noexcept;
+
+		void init(const byte* key, int keylen) noexcept;
+		void update(const byte* input, size_t length) noexcept;
+		void final(byte* output) noexcept;
+
+		static constexpr int block_size = 64;
+		static constexpr int leaves = 8;
+
+	private:
+		typedef uint32_t word;
+
+		//word j of leaf i is h[j * leaves + i], the leaves share the counter
+		alignas(32) word h[8 * leaves];
+		byte b[2 * leaves * block_size];
+		byte key[block_size];
+		int b_length;
+		bool key_pending;
+		int keylen;
+		int output_size;
+		uint64_t total_length;
+	};
 }
 
 namespace crypto::hash
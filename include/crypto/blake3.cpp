@@ -0,0 +1,543 @@
+#include"blake3.h"
+#include<algorithm>
+#include<utils/bit.h>
+#include<utils/cpu.h>
+
+using namespace crypto;
+using utils::endian;
+using utils::byte_to_word;
+using utils::word_to_byte;
+
+namespace
+{
+	constexpr uint32_t IV[8] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+
+	//the message permutation applied before every round
+	constexpr byte schedule[7][16] = {
+		{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+		{ 2, 6, 3, 10, 7, 0, 4, 13, 1, 11, 12, 5, 9, 14, 15, 8 },
+		{ 3, 4, 10, 12, 13, 2, 7, 14, 6, 5, 9, 0, 11, 15, 8, 1 },
+		{ 10, 7, 12, 9, 14, 3, 13, 15, 4, 0, 11, 2, 5, 8, 1, 6 },
+		{ 12, 13, 9, 11, 15, 10, 14, 8, 7, 2, 5, 3, 0, 1, 6, 4 },
+		{ 9, 14, 11, 5, 8, 12, 15, 1, 13, 3, 0, 10, 2, 6, 4, 7 },
+		{ 11, 15, 5, 0, 1, 9, 8, 6, 14, 10, 2, 12, 3, 4, 7, 13 },
+	};
+
+	enum flag
+	{
+		chunk_start = 1 << 0,
+		chunk_end = 1 << 1,
+		parent = 1 << 2,
+		root = 1 << 3,
+		keyed_hash = 1 << 4,
+	};
+
+	constexpr int block_size = crypto::MAC::blake3::block_size;
+	constexpr int chunk_size = crypto::MAC::blake3::chunk_size;
+	constexpr int cv_size = 32;
+
+	void mixing(uint32_t* v, int a, int b, int c, int d, uint32_t x, uint32_t y) noexcept
+	{
+		v[a] = v[a] + v[b] + x;
+		v[d] = utils::rotr(v[d] ^ v[a], 16);
+		v[c] = v[c] + v[d];
+		v[b] = utils::rotr(v[b] ^ v[c], 12);
+		v[a] = v[a] + v[b] + y;
+		v[d] = utils::rotr(v[d] ^ v[a], 8);
+		v[c] = v[c] + v[d];
+		v[b] = utils::rotr(v[b] ^ v[c], 7);
+	}
+
+	void compress(uint32_t* v, const uint32_t* cv, const byte* block, int block_length, uint64_t counter, int flags) noexcept
+	{
+		uint32_t m[16];
+		for (int i = 0; i < 16; i++)
+			m[i] = byte_to_word<endian::little, uint32_t>(block + i * sizeof(uint32_t));
+
+		std::copy(cv, cv + 8, v);
+		std::copy(IV, IV + 4, v + 8);
+		v[12] = static_cast<uint32_t>(counter);
+		v[13] = static_cast<uint32_t>(counter >> 32);
+		v[14] = block_length;
+		v[15] = flags;
+
+		for (const auto& s : schedule)
+		{
+			mixing(v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+			mixing(v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+			mixing(v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+			mixing(v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+			mixing(v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+			mixing(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+			mixing(v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+			mixing(v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+		}
+	}
+
+	void compress_cv(uint32_t* cv, const byte* block, int block_length, uint64_t counter, int flags) noexcept
+	{
+		uint32_t v[16];
+		compress(v, cv, block, block_length, counter, flags);
+		for (int i = 0; i < 8; i++)
+			cv[i] = v[i] ^ v[i + 8];
+	}
+
+	//the last block of a chunk or a parent, before it is known whether it's the root
+	struct node_output
+	{
+		uint32_t cv[8];
+		byte block[block_size];
+		int block_length;
+		uint64_t counter;
+		int flags;
+
+		void chaining_value(byte* output) const noexcept
+		{
+			uint32_t h[8];
+			std::copy(this->cv, this->cv + 8, h);
+			compress_cv(h, this->block, this->block_length, this->counter, this->flags);
+			for (int i = 0; i < 8; i++)
+				word_to_byte<endian::little>(h[i], output + i * sizeof(uint32_t));
+		}
+
+		//the XOF counts the output blocks instead of the chunks
+		void root_bytes(byte* output, size_t length) const noexcept
+		{
+			for (uint64_t counter = 0; length; counter++)
+			{
+				uint32_t v[16];
+				byte temp[2 * cv_size];
+				compress(v, this->cv, this->block, this->block_length, counter, this->flags | root);
+				for (int i = 0; i < 8; i++)
+				{
+					word_to_byte<endian::little>(v[i] ^ v[i + 8], temp + i * sizeof(uint32_t));
+					word_to_byte<endian::little>(v[i + 8] ^ this->cv[i], temp + (i + 8) * sizeof(uint32_t));
+				}
+
+				const size_t outlen = std::min<size_t>(length, sizeof(temp));
+				std::copy(temp, temp + outlen, output);
+				output += outlen;
+				length -= outlen;
+			}
+		}
+	};
+
+	node_output parent_output(const byte* left_and_right, const uint32_t* key, int flags) noexcept
+	{
+		node_output output;
+		std::copy(key, key + 8, output.cv);
+		std::copy(left_and_right, left_and_right + block_size, output.block);
+		output.block_length = block_size;
+		output.counter = 0;
+		output.flags = flags | parent;
+		return output;
+	}
+
+	//the buffered last block of a chunk, zero padded
+	node_output chunk_output(const uint32_t* cv, const byte* block, int block_length, int blocks_compressed, uint64_t counter, int flags) noexcept
+	{
+		node_output output;
+		std::copy(cv, cv + 8, output.cv);
+		std::copy(block, block + block_length, output.block);
+		std::fill(output.block + block_length, output.block + block_size, 0);
+		output.block_length = block_length;
+		output.counter = counter;
+		output.flags = flags | chunk_end | (blocks_compressed ? 0 : chunk_start);
+		return output;
+	}
+
+	//-------------------------------------------------------------------------------------------------
+
+	//inputs of blocks whole blocks each, input i runs with counter + i if increment. flags_start is added to the
+	//first block and flags_end to the last one, the chaining values are written one after another to output
+	using hash_lanes_function = void(*)(const byte* const* input, int blocks, const uint32_t* key, uint64_t counter, bool increment, int flags, int flags_start, int flags_end, byte* output) noexcept;
+
+	void hash_lanes_serial(const byte* const* input, int blocks, const uint32_t* key, uint64_t counter, bool, int flags, int flags_start, int flags_end, byte* output) noexcept
+	{
+		uint32_t cv[8];
+		std::copy(key, key + 8, cv);
+		for (int k = 0; k < blocks; k++)
+			compress_cv(cv, input[0] + k * block_size, block_size, counter, flags | (k == 0 ? flags_start : 0) | (k == blocks - 1 ? flags_end : 0));
+		for (int i = 0; i < 8; i++)
+			word_to_byte<endian::little>(cv[i], output + i * sizeof(uint32_t));
+	}
+
+#if defined(utils_x86)
+	//lane i of every vector holds input i, written with vector extensions like the BLAKE2bp leaves
+	template<typename V>
+	__attribute__((always_inline)) inline void mixing_lanes(V* v, int a, int b, int c, int d, const V& x, const V& y) noexcept
+	{
+		v[a] = v[a] + v[b] + x;
+		v[d] = (v[d] ^ v[a]) >> 16 | (v[d] ^ v[a]) << 16;
+		v[c] = v[c] + v[d];
+		v[b] = (v[b] ^ v[c]) >> 12 | (v[b] ^ v[c]) << 20;
+		v[a] = v[a] + v[b] + y;
+		v[d] = (v[d] ^ v[a]) >> 8 | (v[d] ^ v[a]) << 24;
+		v[c] = v[c] + v[d];
+		v[b] = (v[b] ^ v[c]) >> 7 | (v[b] ^ v[c]) << 25;
+	}
+
+	template<typename V, int width>
+	__attribute__((always_inline)) inline void hash_lanes(const byte* const* input, int blocks, const uint32_t* key, uint64_t counter, bool increment, int flags, int flags_start, int flags_end, byte* output) noexcept
+	{
+		V h[8], counter_low = {}, counter_high = {};
+		for (int j = 0; j < 8; j++)
+			h[j] = V{} + key[j];
+		for (int i = 0; i < width; i++)
+		{
+			const uint64_t lane_counter = counter + (increment ? i : 0);
+			counter_low[i] = static_cast<uint32_t>(lane_counter);
+			counter_high[i] = static_cast<uint32_t>(lane_counter >> 32);
+		}
+
+		for (int k = 0; k < blocks; k++)
+		{
+			const uint32_t block_flags = flags | (k == 0 ? flags_start : 0) | (k == blocks - 1 ? flags_end : 0);
+
+			V m[16], v[16] = {};
+			for (int j = 0; j < 16; j++)
+				for (int i = 0; i < width; i++)
+					m[j][i] = byte_to_word<endian::little, uint32_t>(input[i] + k * block_size + j * sizeof(uint32_t));
+
+			for (int j = 0; j < 8; j++)
+				v[j] = h[j];
+			for (int j = 0; j < 4; j++)
+				v[j + 8] = V{} + IV[j];
+			v[12] = counter_low;
+			v[13] = counter_high;
+			v[14] = V{} + static_cast<uint32_t>(block_size);
+			v[15] = V{} + block_flags;
+
+			for (const auto& s : schedule)
+			{
+				mixing_lanes(v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+				mixing_lanes(v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+				mixing_lanes(v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+				mixing_lanes(v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+				mixing_lanes(v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+				mixing_lanes(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+				mixing_lanes(v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+				mixing_lanes(v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+			}
+
+			for (int j = 0; j < 8; j++)
+				h[j] = v[j] ^ v[j + 8];
+		}
+
+		for (int i = 0; i < width; i++)
+			for (int j = 0; j < 8; j++)
+				word_to_byte<endian::little>(h[j][i], output + i * cv_size + j * sizeof(uint32_t));
+	}
+
+	typedef uint32_t uint32x4_t __attribute__((vector_size(16)));
+	typedef uint32_t uint32x8_t __attribute__((vector_size(32)));
+	typedef uint32_t uint32x16_t __attribute__((vector_size(64)));
+
+	__attribute__((target("sse4.1")))
+	void hash_lanes_sse41(const byte* const* input, int blocks, const uint32_t* key, uint64_t counter, bool increment, int flags, int flags_start, int flags_end, byte* output) noexcept
+	{
+		hash_lanes<uint32x4_t, 4>(input, blocks, key, counter, increment, flags, flags_start, flags_end, output);
+	}
+
+	__attribute__((target("avx2")))
+	void hash_lanes_avx2(const byte* const* input, int blocks, const uint32_t* key, uint64_t counter, bool increment, int flags, int flags_start, int flags_end, byte* output) noexcept
+	{
+		hash_lanes<uint32x8_t, 8>(input, blocks, key, counter, increment, flags, flags_start, flags_end, output);
+	}
+
+	__attribute__((target("avx512f")))
+	void hash_lanes_avx512(const byte* const* input, int blocks, const uint32_t* key, uint64_t counter, bool increment, int flags, int flags_start, int flags_end, byte* output) noexcept
+	{
+		hash_lanes<uint32x16_t, 16>(input, blocks, key, counter, increment, flags, flags_start, flags_end, output);
+	}
+#endif
+
+	struct hash_lanes_kernel
+	{
+		hash_lanes_function f;
+		int width;
+	};
+
+	hash_lanes_kernel select_hash_lanes() noexcept
+	{
+#if defined(utils_x86)
+		const auto& feature = utils::cpu_feature::get();
+		if (feature.avx512f)
+			return { hash_lanes_avx512, 16 };
+		if (feature.avx2)
+			return { hash_lanes_avx2, 8 };
+		if (feature.sse41)
+			return { hash_lanes_sse41, 4 };
+#endif
+		return { hash_lanes_serial, 1 };
+	}
+
+	void hash_many(const byte* const* input, size_t n, int blocks, const uint32_t* key, uint64_t counter, bool increment, int flags, int flags_start, int flags_end, byte* output) noexcept
+	{
+		static const hash_lanes_kernel kernel = select_hash_lanes();
+		for (; n >= static_cast<size_t>(kernel.width); n -= kernel.width)
+		{
+			kernel.f(input, blocks, key, counter, increment, flags, flags_start, flags_end, output);
+			input += kernel.width;
+			output += kernel.width * cv_size;
+			counter += increment ? kernel.width : 0;
+		}
+		for (; n; n--)
+		{
+			hash_lanes_serial(input++, blocks, key, counter, increment, flags, flags_start, flags_end, output);
+			output += cv_size;
+			counter += increment ? 1 : 0;
+		}
+	}
+
+	//the chaining value of chunks whole chunks, a power of two starting at chunk counter.
+	//up to max_lanes chunks are hashed side by side and their parents level by level
+	void subtree_cv(const byte* input, uint64_t chunks, const uint32_t* key, uint64_t counter, int flags, byte* output) noexcept
+	{
+		constexpr int max_lanes = 16;
+		if (chunks > max_lanes)
+		{
+			byte children[2 * cv_size];
+			subtree_cv(input, chunks / 2, key, counter, flags, children);
+			subtree_cv(input + chunks / 2 * chunk_size, chunks / 2, key, counter + chunks / 2, flags, children + cv_size);
+			parent_output(children, key, flags).chaining_value(output);
+			return;
+		}
+
+		const byte* p[max_lanes] = {};
+		byte cv[2][max_lanes * cv_size];
+		for (uint64_t i = 0; i < chunks; i++)
+			p[i] = input + i * chunk_size;
+		hash_many(p, chunks, chunk_size / block_size, key, counter, true, flags, chunk_start, chunk_end, cv[0]);
+
+		int level = 0;
+		for (; chunks > 1; chunks /= 2, level ^= 1)
+		{
+			for (uint64_t i = 0; i < chunks / 2; i++)
+				p[i] = cv[level] + i * 2 * cv_size;
+			hash_many(p, chunks / 2, 1, key, 0, false, flags | parent, 0, 0, cv[level ^ 1]);
+		}
+		std::copy(cv[level], cv[level] + cv_size, output);
+	}
+
+	//the largest power of two not above n, n > 0
+	uint64_t floor_power_of_2(uint64_t n) noexcept
+	{
+		while (n & (n - 1))
+			n &= n - 1;
+		return n;
+	}
+
+	int popcount(uint64_t n) noexcept
+	{
+		int result = 0;
+		for (; n; n &= n - 1)
+			result++;
+		return result;
+	}
+
+	//the biggest subtree that starts at counter and fits in chunks
+	uint64_t subtree_chunks(uint64_t counter, uint64_t chunks) noexcept
+	{
+		uint64_t result = floor_power_of_2(chunks);
+		while (counter & (result - 1))
+			result /= 2;
+		return result;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+
+crypto::MAC::blake3::blake3(const byte* key, int output_size) noexcept : output_size(output_size)
+{
+	this->init(key);
+}
+
+crypto::MAC::blake3::blake3(const byte* key, const byte* input, size_t length, byte* output, int output_size) noexcept : blake3(key, output_size)
+{
+	this->update(input, length);
+	this->final(output);
+}
+
+void crypto::MAC::blake3::init(const byte* key) noexcept
+{
+	if (key)
+	{
+		for (int i = 0; i < 8; i++)
+			this->key[i] = byte_to_word<endian::little, word>(key + i * sizeof(word));
+		this->flags = keyed_hash;
+	}
+	else
+	{
+		std::copy(IV, IV + 8, this->key);
+		this->flags = 0;
+	}
+
+	this->stack_length = 0;
+	this->reset_chunk(0);
+}
+
+//a chunk is finished only once more input follows it, so the last chunk is always left for final().
+//the whole subtrees before it are hashed straight from input
+void crypto::MAC::blake3::update(const byte* input, size_t length) noexcept
+{
+	if (!length)
+		return;
+
+	if (int filled = this->chunk_length())
+	{
+		size_t outlen = std::min<size_t>(length, chunk_size - filled);
+		this->chunk_update(input, outlen);
+		input += outlen;
+		length -= outlen;
+
+		if (!length)
+			return;
+		this->finish_chunk();
+	}
+
+	while (length > chunk_size)
+	{
+		const uint64_t chunks = subtree_chunks(this->chunk_counter, (length - 1) / chunk_size);
+		byte cv[cv_size];
+		subtree_cv(input, chunks, this->key, this->chunk_counter, this->flags, cv);
+		this->push_cv(cv, this->chunk_counter);
+		this->reset_chunk(this->chunk_counter + chunks);
+		input += chunks * chunk_size;
+		length -= chunks * chunk_size;
+	}
+
+	this->chunk_update(input, length);
+	this->merge_stack(this->chunk_counter);
+}
+
+//the subtrees hashed by other threads are pushed like the ones of update(), then the kept chunk is hashed here
+void crypto::MAC::blake3::update(const subtree& piece) noexcept
+{
+	const uint64_t position = this->chunk_counter * chunk_size + this->chunk_length();
+	if (!piece.nodes || position != piece.offset)
+	{
+		this->update(piece.input, piece.length);
+		return;
+	}
+
+	if (this->chunk_length())
+		this->finish_chunk();
+	for (int i = 0; i < piece.nodes; i++)
+	{
+		this->push_cv(piece.cv[i], this->chunk_counter);
+		this->reset_chunk(this->chunk_counter + piece.chunks[i]);
+	}
+	this->update(piece.input + piece.hashed_length, piece.length - piece.hashed_length);
+}
+
+//the root is the last chunk when there is only one, otherwise the parent of the last two subtrees
+void crypto::MAC::blake3::final(byte* output) noexcept
+{
+	node_output node = chunk_output(this->cv, this->block, this->block_length, this->blocks_compressed, this->chunk_counter, this->flags);
+	for (int i = this->stack_length - 1; i >= 0; i--)
+	{
+		byte children[2 * cv_size];
+		std::copy(this->stack[i], this->stack[i] + cv_size, children);
+		node.chaining_value(children + cv_size);
+		node = parent_output(children, this->key, this->flags);
+	}
+	node.root_bytes(output, this->output_size);
+}
+
+int crypto::MAC::blake3::chunk_length() const noexcept
+{
+	return this->blocks_compressed * block_size + this->block_length;
+}
+
+//the last block of the chunk stays buffered, it's compressed with chunk_end by finish_chunk() or final()
+void crypto::MAC::blake3::chunk_update(const byte* input, size_t length) noexcept
+{
+	if (!length)
+		return;
+
+	if (this->block_length)
+	{
+		int outlen = (this->block_length + length < block_size) ? length : block_size - this->block_length;
+		std::copy(input, input + outlen, this->block + this->block_length);
+
+		this->block_length += outlen;
+		input += outlen;
+		length -= outlen;
+
+		if (!length)
+			return;
+		compress_cv(this->cv, this->block, block_size, this->chunk_counter, this->flags | (this->blocks_compressed ? 0 : chunk_start));
+		this->blocks_compressed++;
+		this->block_length = 0;
+	}
+
+	for (; length > block_size; input += block_size, length -= block_size)
+	{
+		compress_cv(this->cv, input, block_size, this->chunk_counter, this->flags | (this->blocks_compressed ? 0 : chunk_start));
+		this->blocks_compressed++;
+	}
+
+	std::copy(input, input + length, this->block);
+	this->block_length = static_cast<int>(length);
+}
+
+//pushes the full chunk and starts the next one
+void crypto::MAC::blake3::finish_chunk() noexcept
+{
+	byte cv[cv_size];
+	chunk_output(this->cv, this->block, this->block_length, this->blocks_compressed, this->chunk_counter, this->flags).chaining_value(cv);
+	this->push_cv(cv, this->chunk_counter);
+	this->reset_chunk(this->chunk_counter + 1);
+}
+
+void crypto::MAC::blake3::reset_chunk(uint64_t counter) noexcept
+{
+	std::copy(this->key, this->key + 8, this->cv);
+	this->block_length = 0;
+	this->blocks_compressed = 0;
+	this->chunk_counter = counter;
+}
+
+//the subtree of counter is pushed after merging the finished subtrees before it
+void crypto::MAC::blake3::push_cv(const byte* cv, uint64_t counter) noexcept
+{
+	this->merge_stack(counter);
+	std::copy(cv, cv + cv_size, this->stack[this->stack_length++]);
+}
+
+//merges the top of the stack until it holds one subtree for every bit set in chunks.
+//the merge is lazy, the last two subtrees wait for more input in case they make the root
+void crypto::MAC::blake3::merge_stack(uint64_t chunks) noexcept
+{
+	while (this->stack_length > popcount(chunks))
+	{
+		this->stack_length--;
+		parent_output(this->stack[this->stack_length - 1], this->key, this->flags).chaining_value(this->stack[this->stack_length - 1]);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+
+crypto::MAC::blake3::subtree::subtree(const blake3& hash, const byte* input, size_t length, uint64_t offset) noexcept : input(input), length(length), offset(offset), nodes(0), hashed_length(0)
+{
+	if (offset % chunk_size || length <= chunk_size)
+		return;
+
+	uint64_t counter = offset / chunk_size;
+	for (uint64_t whole = (length - 1) / chunk_size; whole;)
+	{
+		const uint64_t chunks = subtree_chunks(counter, whole);
+		subtree_cv(input + this->hashed_length, chunks, hash.key, counter, hash.flags, this->cv[this->nodes]);
+		this->chunks[this->nodes++] = chunks;
+		this->hashed_length += chunks * chunk_size;
+		counter += chunks;
+		whole -= chunks;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+
+crypto::hash::blake3::blake3(int output_size) noexcept : MAC::blake3(nullptr, output_size) {}
+
+crypto::hash::blake3::blake3(const byte* input, size_t length, byte* output, int output_size) noexcept : MAC::blake3(nullptr, input, length, output, output_size) {}
\ No newline at end of file
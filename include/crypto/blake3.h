@@ -0,0 +1,91 @@
+#ifndef crypto_blake3_h
+#define crypto_blake3_h
+#include"define.h"
+
+//BLAKE3 specification, the keyed_hash mode as a MAC and the hash mode
+
+namespace crypto::MAC
+{
+	//the input is split into chunks of 1024 bytes, which are hashed in the lanes of SSE4.1, AVX2 or AVX-512
+	//where supported and then merged as a binary tree. key is nullptr in the hash mode.
+	//output_size >= 1, outputs longer than 32 bytes are extended with the XOF
+	class blake3
+	{
+	public:
+		class subtree;
+
+		blake3(const byte* key, int output_size = 32) noexcept;
+		blake3(const byte* key, const byte* input, size_t length, byte* output, int output_size = 32) noexcept;
+
+		void init(const byte* key) noexcept;
+		void update(const byte* input, size_t length) noexcept;
+		void update(const subtree& piece) noexcept;
+		void final(byte* output) noexcept;
+
+		static constexpr int key_size = 32;
+		static constexpr int block_size = 64;
+		static constexpr int chunk_size = 1024;
+
+	private:
+		typedef uint32_t word;
+
+		int chunk_length() const noexcept;
+		void chunk_update(const byte* input, size_t length) noexcept;
+		void finish_chunk() noexcept;
+		void reset_chunk(uint64_t counter) noexcept;
+		void push_cv(const byte* cv, uint64_t counter) noexcept;
+		void merge_stack(uint64_t chunks) noexcept;
+
+		word key[8];
+		int flags;
+
+		//the chunk being hashed, its last block stays buffered for final()
+		word cv[8];
+		byte block[block_size];
+		int block_length;
+		int blocks_compressed;
+		uint64_t chunk_counter;
+
+		//the chaining values of the finished subtrees, one for every bit set in chunk_counter
+		byte stack[54][32];
+		int stack_length;
+
+		int output_size;
+	};
+
+	//the whole chunks of a piece of the message hashed on any thread, update() takes the pieces in message order.
+	//offset is the position of input in the message, pieces at an offset that isn't a multiple of chunk_size
+	//are left to update(). the last chunk of the piece is kept for update(), so a subtree is never the root
+	class blake3::subtree
+	{
+	public:
+		subtree(const blake3& hash, const byte* input, size_t length, uint64_t offset) noexcept;
+
+	private:
+		friend class blake3;
+
+		static constexpr int max_nodes = 128;
+
+		const byte* input;
+		size_t length;
+		uint64_t offset;
+
+		//node i covers chunks[i] chunks, a power of two aligned to its position
+		byte cv[max_nodes][32];
+		uint64_t chunks[max_nodes];
+		int nodes;
+		size_t hashed_length;
+	};
+}
+
+namespace crypto::hash
+{
+	class blake3 : public MAC::blake3
+	{
+	public:
+		blake3(int output_size = 32) noexcept;
+		blake3(const byte* input, size_t length, byte* output, int output_size = 32) noexcept;
+	};
+}
+
+#endif
\ No newline at end of file
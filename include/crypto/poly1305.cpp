@@ -29,45 +29,62 @@ void crypto::MAC::poly1305::init(const byte* key) noexcept
 	this->s = byte_to_word<endian::little, uint128_t>(key + sizeof(uint128_t));
 }
 
+//the final block is padded by final(), so at least one byte stays buffered.
+//the whole blocks before it are compressed directly from input.
 void crypto::MAC::poly1305::update(const byte* input, size_t length) noexcept
 {
-	while (length)
-	{
-		if (this->length == this->block_size)
-		{
-			this->compress();
-			this->length = 0;
-		}
+	if (!length)
+		return;
 
+	if (this->length)
+	{
 		int outlen = (this->length + length < this->block_size) ? length : this->block_size - this->length;
 		std::copy(input, input + outlen, this->block + this->length);
 
 		this->length += outlen;
 		input += outlen;
 		length -= outlen;
+
+		if (!length)
+			return;
+		this->compress(this->block, 1, 1);
+		this->length = 0;
 	}
-}
 
-void crypto::MAC::poly1305::final(byte* output) noexcept
-{
-	this->compress();
-	this->acc += this->s;
-	word_to_byte<endian::little>(this->acc.low, output);
+	size_t blocks = (length - 1) / this->block_size;
+	this->compress(input, blocks, 1);
+	input += blocks * this->block_size;
+	length -= blocks * this->block_size;
+
+	std::copy(input, input + length, this->block);
+	this->length = static_cast<int>(length);
 }
 
-void crypto::MAC::poly1305::compress() noexcept
+void crypto::MAC::poly1305::final(byte* output) noexcept
 {
 	if (this->length == this->block_size)
-		this->acc.high++;
+		this->compress(this->block, 1, 1);
 	else
 	{
 		this->block[this->length] = 0x01;
 		std::fill(this->block + this->length + 1, this->block + this->block_size, 0);
+		this->compress(this->block, 1, 0);
 	}
 
-	this->acc += byte_to_word<endian::little, uint128_t>(this->block);
-	this->acc *= this->r;
-	this->modulo_p();
+	this->acc += this->s;
+	word_to_byte<endian::little>(this->acc.low, output);
+}
+
+//high_bit is added above the 128 bits of every block, 1 for whole blocks and 0 for a padded one
+void crypto::MAC::poly1305::compress(const byte* input, size_t blocks, int high_bit) noexcept
+{
+	for (; blocks; blocks--, input += this->block_size)
+	{
+		this->acc.high += high_bit;
+		this->acc += byte_to_word<endian::little, uint128_t>(input);
+		this->acc *= this->r;
+		this->modulo_p();
+	}
 }
 
 void crypto::MAC::poly1305::modulo_p() noexcept
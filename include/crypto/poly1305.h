@@ -35,7 +35,7 @@ namespace crypto::MAC
 			utils::uint128_t low;
 		};
 
-		void compress() noexcept;
+		void compress(const byte* input, size_t blocks, int high_bit) noexcept;
 		void modulo_p() noexcept;
 
 		byte block[block_size];
@@ -170,8 +170,10 @@ namespace
 }
 
 #else
+#include"stitch.h"
 #include<crypto/AES.h>
 #include<crypto/CTR_mode.h>
+#include<crypto/CTR_HMAC_SHA256.h>
 #include<crypto/chacha20.h>
 #include<utils/bit.h>
 #include<utils/uint128.h>
@@ -215,6 +217,20 @@ namespace
 			return std::unique_ptr<cipher>(new aes_ctr<Cipher>(*this));
 		}
 
+		bool pairs_with(mac& m) const noexcept override
+		{
+			return hmac_sha256_state(m) && crypto::cipher::CTR_HMAC_SHA256<Cipher>::supported();
+		}
+
+		void encrypt_with(mac& m, byte* data, size_t length, bool decrypt) override
+		{
+			auto& state = *hmac_sha256_state(m);
+			if (decrypt)
+				crypto::cipher::CTR_HMAC_SHA256<Cipher>::decrypt(this->impl, state, data, length);
+			else
+				crypto::cipher::CTR_HMAC_SHA256<Cipher>::encrypt(this->impl, state, data, length);
+		}
+
 	private:
 		static constexpr int key_size = crypto::cipher::CTR<Cipher>::key_size + crypto::cipher::CTR<Cipher>::counter_size;
 		static constexpr int block_size = crypto::cipher::CTR<Cipher>::block_size;
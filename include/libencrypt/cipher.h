@@ -5,6 +5,8 @@
 
 namespace libencrypt
 {
+	class mac;
+
 	enum class cipher_algorithm
 	{
 		aes_128_ctr,
@@ -24,6 +26,12 @@ namespace libencrypt
 		virtual void encrypt(const byte* in, byte* out, size_t count) = 0;
 		virtual std::unique_ptr<cipher> copy() const = 0;
 
+		//some ciphers run in one pass with a MAC of the ciphertext, AES-CTR with HMAC-SHA256 where AES-NI and the SHA extensions
+		//are supported. encrypt_with() is only called when pairs_with() is true for m, it encrypts length bytes of data in place
+		//from the counter of set_counter(), a multiple of 64, and updates m. with decrypt m takes data before it is decrypted
+		virtual bool pairs_with(mac&) const noexcept { return false; }
+		virtual void encrypt_with(mac&, byte*, size_t, bool) {}
+
 		const int key_size;
 		const int block_size;
 	};
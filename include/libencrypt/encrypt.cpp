@@ -10,9 +10,18 @@
 #include<exception>
 #include<stdexcept>
 #include<cstring>
+#include<string>
+#include<deque>
+#include<map>
+#include<limits>
+#include"system.h"
+#include<utils/bit.h>
+#include<utils/thread_pool.h>
 
 //assuming mutex and condition_variable don't throw exceptions
 //encrypt format = [salt] || ciphertext || mac
+//volume format = salt || nonce || index || count || stripe size || ciphertext || mac
+//shard format = salt || nonce || offset || last || ciphertext || mac
 
 using namespace libencrypt;
 
@@ -40,51 +49,224 @@ namespace
 
 	//-------------------------------------------------------------------------------------------------
 
-	class input_management
+	//with pipeline_option::drop_cache, the page cache is trimmed every cache_window bytes
+	constexpr uint64_t cache_window = 1 << 23;
+
+	//page-aligned chunk buffers shared by every call, so the steady state makes no allocations.
+	//idle buffers above max_idle_size bytes or max_idle_count buffers are freed.
+	class buffer_pool
 	{
 	public:
-		input_management(std::FILE* input) noexcept : input(input), good(true), position(0) {}
+		class buffer
+		{
+		public:
+			buffer(buffer_pool& pool, byte* data, size_t size, bool huge_pages) noexcept : pool(&pool), ptr(data), size(size), huge_pages(huge_pages) {}
+			buffer(const buffer&) = delete;
+			buffer& operator=(const buffer&) = delete;
 
-		size_t raw_read(byte* data, size_t count)
+			buffer(buffer&& other) noexcept : pool(other.pool), ptr(other.ptr), size(other.size), huge_pages(other.huge_pages)
+			{
+				other.ptr = nullptr;
+			}
+
+			buffer& operator=(buffer&& other) noexcept
+			{
+				std::swap(this->pool, other.pool);
+				std::swap(this->ptr, other.ptr);
+				std::swap(this->size, other.size);
+				std::swap(this->huge_pages, other.huge_pages);
+				return *this;
+			}
+
+			~buffer()
+			{
+				if (this->ptr)
+					this->pool->put(this->ptr, this->size, this->huge_pages);
+			}
+
+			byte* data() const noexcept
+			{
+				return this->ptr;
+			}
+
+			//a buffer of the same size from the same pool
+			buffer sibling() const
+			{
+				return this->pool->get(this->size, this->huge_pages);
+			}
+
+			//frees the memory instead of returning it to the pool
+			void discard() noexcept
+			{
+				if (this->ptr)
+					free_pages(this->ptr, this->size);
+				this->ptr = nullptr;
+			}
+
+		private:
+			buffer_pool* pool;
+			byte* ptr;
+			size_t size;
+			bool huge_pages;
+		};
+
+		buffer_pool() : idle_size(0)
 		{
-			if (!this->good)
-				return 0;
+			this->idle.reserve(max_idle_count);
+		}
+		buffer_pool(const buffer_pool&) = delete;
+		buffer_pool& operator=(const buffer_pool&) = delete;
+
+		~buffer_pool()
+		{
+			for (const auto& i : this->idle)
+				free_pages(i.data, i.size);
+		}
 
-			size_t read_size = std::fread(data, sizeof(byte), count, this->input);
-			if (std::ferror(this->input))
+		buffer get(size_t size, bool huge_pages)
+		{
 			{
-				this->good = false;
-				throw std::runtime_error("libencrypt::input_management::raw_read error");
+				std::scoped_lock lock(this->mutex);
+				auto it = std::find_if(this->idle.begin(), this->idle.end(), [&](const entry& i) { return i.size == size && i.huge_pages == huge_pages; });
+				if (it != this->idle.end())
+				{
+					byte* data = it->data;
+					this->idle_size -= size;
+					this->idle.erase(it);
+					return buffer(*this, data, size, huge_pages);
+				}
 			}
 
-			return read_size;
+			return buffer(*this, allocate_pages(size, huge_pages), size, huge_pages);
 		}
 
-		size_t read(byte* data, size_t count)
+		//frees the idle buffers
+		void trim() noexcept
+		{
+			std::scoped_lock lock(this->mutex);
+			for (const auto& i : this->idle)
+				free_pages(i.data, i.size);
+			this->idle.clear();
+			this->idle_size = 0;
+		}
+
+		static buffer_pool& global()
+		{
+			static buffer_pool pool;
+			return pool;
+		}
+
+		static constexpr size_t max_idle_size = 1 << 26;
+		static constexpr size_t max_idle_count = 64;
+
+	private:
+		struct entry
+		{
+			byte* data;
+			size_t size;
+			bool huge_pages;
+		};
+
+		void put(byte* data, size_t size, bool huge_pages) noexcept
+		{
+			{
+				std::scoped_lock lock(this->mutex);
+				if (this->idle_size + size <= max_idle_size && this->idle.size() < max_idle_count)
+				{
+					this->idle.push_back({ data, size, huge_pages });
+					this->idle_size += size;
+					return;
+				}
+			}
+
+			free_pages(data, size);
+		}
+
+		std::mutex mutex;
+		std::vector<entry> idle;
+		size_t idle_size;
+	};
+
+	//-------------------------------------------------------------------------------------------------
+
+	class input_management
+	{
+	public:
+		input_management(std::FILE* input, size_t chunk_size, bool huge_pages, bool drop_cache) : chunk_size(chunk_size), input(input), fd(-1), good(true), huge_pages(huge_pages), drop_cache(drop_cache && is_seekable(input)), position(0), reserve_size(0), uncached_size(0), dropped_size(0), limit(std::numeric_limits<uint64_t>::max())
+		{
+			if (this->drop_cache)
+				advise_sequential(input);
+		}
+
+		//reads fd directly into the chunks, without stdio buffering
+		input_management(int input, size_t chunk_size, bool huge_pages, bool drop_cache) : chunk_size(chunk_size), input(nullptr), fd(input), good(true), huge_pages(huge_pages), drop_cache(drop_cache && is_seekable(input)), position(0), reserve_size(0), uncached_size(0), dropped_size(0), limit(std::numeric_limits<uint64_t>::max())
+		{
+			if (this->drop_cache)
+				advise_sequential(input);
+		}
+
+		size_t raw_read(byte* data, size_t count)
 		{
 			if (!this->good)
 				return 0;
 
+			count = static_cast<size_t>(std::min<uint64_t>(count, this->limit));
+			size_t read_size;
 			try
 			{
-				this->buf = this->reserve;
-				this->buf.resize(this->reserve.size() + count);
-				size_t read_size = this->raw_read(this->buf.data() + this->reserve.size(), count);
-				std::copy(this->buf.data(), this->buf.data() + read_size, data);
-				std::copy(this->buf.data() + read_size, this->buf.data() + read_size + this->reserve.size(), this->reserve.data());
-				return read_size;
+				read_size = this->input ? std::fread(data, sizeof(byte), count, this->input) : read_file(this->fd, data, count);
+				if (this->input && std::ferror(this->input))
+					throw std::runtime_error("libencrypt::input_management::raw_read error");
 			}
 			catch (...)
 			{
 				this->good = false;
 				throw;
 			}
+
+			this->limit -= read_size;
+			this->uncached_size += read_size;
+			if (this->drop_cache && this->uncached_size >= cache_window)
+			{
+				this->input ? drop_read_cache(this->input, this->dropped_size) : drop_read_cache(this->fd, this->dropped_size);
+				this->uncached_size = 0;
+			}
+			return read_size;
+		}
+
+		//data must have room for count + max_reserve_size bytes, the reserve is rotated through its tail
+		size_t read_chunk(byte* data, size_t count)
+		{
+			if (!this->good)
+				return 0;
+
+			std::copy(this->reserve, this->reserve + this->reserve_size, data);
+			size_t read_size = this->raw_read(data + this->reserve_size, count);
+			std::copy(data + read_size, data + read_size + this->reserve_size, this->reserve);
+			return read_size;
+		}
+
+		size_t read(byte* data, size_t count)
+		{
+			byte buf[256 + max_reserve_size];
+			size_t result = 0;
+			while (count)
+			{
+				size_t read_size = this->read_chunk(buf, std::min<size_t>(count, 256));
+				std::copy(buf, buf + read_size, data);
+				result += read_size;
+				if (read_size < std::min<size_t>(count, 256))
+					break;
+				data += read_size;
+				count -= read_size;
+			}
+			return result;
 		}
 
-		size_t sync_read(byte* data, uint64_t& position)
+		size_t sync_read(byte* data, size_t count, uint64_t& position)
 		{
 			std::scoped_lock lock(this->mutex);
-			size_t read_size = this->read(data, this->max_read_size);
+			size_t read_size = this->read_chunk(data, count);
 			position = this->position;
 			this->position += read_size;
 			return read_size;
@@ -92,48 +274,103 @@ namespace
 
 		void init_reserve(size_t reserve_size)
 		{
-			this->reserve.resize(reserve_size);
-			this->raw_read(this->reserve.data(), reserve_size);
-			if (std::feof(this->input))
+			if (reserve_size > max_reserve_size)
+				throw std::runtime_error("libencrypt::input_management::init_reserve reserve size too large");
+			this->reserve_size = reserve_size;
+			if (this->raw_read(this->reserve, reserve_size) != reserve_size)
 				throw std::runtime_error("libencrypt::input_management::init_reserve error");
 		}
 
 		const byte* read_reserve() noexcept
 		{
-			return this->reserve.data();
+			return this->reserve;
+		}
+
+		//the input ends after length more bytes
+		void set_limit(uint64_t length) noexcept
+		{
+			this->limit = length;
 		}
 
-		static constexpr int max_read_size = 1 << 20;
+		//a chunk buffer with room for the reserve
+		buffer_pool::buffer get_buffer()
+		{
+			return buffer_pool::global().get(this->chunk_size + max_reserve_size, this->huge_pages);
+		}
+
+		//the trailing MACs, at most two 64-bytes tags
+		static constexpr int max_reserve_size = 128;
+
+		const size_t chunk_size;
 
 	private:
 		std::FILE* input;
+		int fd;
 		bool good;
+		bool huge_pages;
+		bool drop_cache;
 		uint64_t position;
 		std::mutex mutex;
-		std::vector<byte> reserve;
-		std::vector<byte> buf;
+		byte reserve[max_reserve_size];
+		size_t reserve_size;
+		uint64_t uncached_size;
+		//the page cache before this offset has been dropped
+		uint64_t dropped_size;
+		uint64_t limit;
 	};
 
 	class output_management
 	{
 	public:
-		output_management(std::FILE* output) noexcept : output(output), position(0) {}
+		output_management(std::FILE* output, bool drop_cache) : output(output), fd(-1), splice(false), good(true), drop_cache(drop_cache && is_seekable(output)), position(0), written_size(0), uncached_size(0), dropped_size(0) {}
+
+		//writes to fd without stdio buffering, the chunks are spliced into a pipe where supported
+		output_management(int output, bool drop_cache) : output(nullptr), fd(output), splice(is_pipe(output)), good(true), drop_cache(drop_cache && is_seekable(output)), position(0), written_size(0), uncached_size(0), dropped_size(0) {}
+
+		output_management(const output_management&) = delete;
+		output_management& operator=(const output_management&) = delete;
 
 		bool write(const byte* data, size_t count)
 		{
-			if (std::ferror(this->output))
+			if (!this->good)
 				return false;
 
-			std::fwrite(data, sizeof(byte), count, this->output);
-			if (std::ferror(this->output))
-				throw std::runtime_error("libencrypt::output_management::write error");
+			try
+			{
+				if (this->output)
+				{
+					std::fwrite(data, sizeof(byte), count, this->output);
+					if (std::ferror(this->output))
+						throw std::runtime_error("libencrypt::output_management::write error");
+				}
+				else
+					write_file(this->fd, data, count);
+			}
+			catch (...)
+			{
+				this->good = false;
+				throw;
+			}
 
+			this->written_size += count;
+			this->uncached_size += count;
+			if (this->drop_cache && this->uncached_size >= cache_window)
+			{
+				this->output ? write_behind(this->output, cache_window, this->dropped_size) : write_behind(this->fd, cache_window, this->dropped_size);
+				this->uncached_size = 0;
+			}
 			return true;
 		}
 
+		//bytes written so far
+		uint64_t size() const noexcept
+		{
+			return this->written_size;
+		}
+
 		bool sync_write(const byte* data, size_t count, uint64_t position)
 		{
-			scoped_condition_variable cv(this->mutex, this->condition_variable, [&]() { return this->position == position || std::ferror(this->output); });
+			scoped_condition_variable cv(this->mutex, this->condition_variable, [&]() { return this->position == position || !this->good; });
 			if (!this->write(data, count))
 				return false;
 
@@ -141,11 +378,64 @@ namespace
 			return true;
 		}
 
+		//after the last write of the output, the writes still waiting for their turn and the later ones return false
+		void close()
+		{
+			scoped_condition_variable cv(this->mutex, this->condition_variable, []() { return true; });
+			this->good = false;
+		}
+
+		//when splicing, the pages of buf move into the pipe and buf is replaced by another buffer.
+		//the spliced buffer is freed, never reused: a reader that splices or tees the data on keeps referencing
+		//the pages after the pipe looks drained, and the next chunk would overwrite data already handed downstream
+		bool sync_write(buffer_pool::buffer& buf, size_t count, uint64_t position)
+		{
+			if (!this->splice)
+				return this->sync_write(buf.data(), count, position);
+
+			scoped_condition_variable cv(this->mutex, this->condition_variable, [&]() { return this->position == position || !this->good; });
+			if (!this->good)
+				return false;
+
+			buffer_pool::buffer next = buf.sibling();
+			try
+			{
+				this->splice = splice_pages(this->fd, buf.data(), count);
+			}
+			catch (...)
+			{
+				this->good = false;
+				throw;
+			}
+			if (!this->splice)
+			{
+				if (!this->write(buf.data(), count))
+					return false;
+				this->position += count;
+				return true;
+			}
+
+			this->written_size += count;
+			this->position += count;
+			buf.discard();
+			buf = std::move(next);
+			return true;
+		}
+
 	private:
+
 		std::FILE* output;
+		int fd;
+		bool splice;
+		bool good;
+		bool drop_cache;
 		uint64_t position;
+		uint64_t written_size;
 		std::mutex mutex;
 		std::condition_variable condition_variable;
+		uint64_t uncached_size;
+		//the output before this offset has been written back and dropped from the page cache
+		uint64_t dropped_size;
 	};
 
 	class cipher_management
@@ -167,13 +457,15 @@ namespace
 			return result;
 		}
 
+		static constexpr int tile_size = 4096;
+
 		std::vector<std::unique_ptr<cipher>> ciphers;
-		std::vector<byte> buf;
+		byte tile[tile_size];
 
 	public:
 		cipher_management(const std::vector<cipher_algorithm>& cipher_list) : ciphers(this->get_ciphers(cipher_list)), key_size(this->get_key_size()) {}
 
-		cipher_management(const cipher_management& other) : buf(), key_size(other.key_size)
+		cipher_management(const cipher_management& other) : key_size(other.key_size)
 		{
 			for (const auto& i : other.ciphers)
 				this->ciphers.push_back(i->copy());
@@ -188,18 +480,58 @@ namespace
 			}
 		}
 
-		//assert(position % i->block_size == 0)
+		//if position % i->block_size != 0 or length % i->block_size != 0, only data[0, length) is accessed.
+		//the ciphers write the keystream to out before reading in, so data goes through a tile that stays in L1
 		void encrypt(byte* data, size_t length, uint64_t position)
 		{
 			for (auto& i : this->ciphers)
 			{
-				i->set_counter(position / i->block_size);
-				this->buf.resize((length / i->block_size + static_cast<bool>(length % i->block_size)) * i->block_size);
-				i->encrypt(data, this->buf.data(), length / i->block_size + static_cast<bool>(length % i->block_size));
-				std::copy(this->buf.data(), this->buf.data() + length, data);
+				const size_t block_size = i->block_size;
+				byte* p = data;
+				size_t remain = length;
+				i->set_counter(position / block_size);
+
+				auto partial_block = [&](size_t offset)
+				{
+					const size_t size = std::min(remain, block_size - offset);
+					std::copy(p, p + size, this->tile + offset);
+					i->encrypt(this->tile, this->tile + block_size, 1);
+					std::copy(this->tile + block_size + offset, this->tile + block_size + offset + size, p);
+					p += size;
+					remain -= size;
+				};
+
+				if (position % block_size)
+					partial_block(position % block_size);
+				while (remain >= block_size)
+				{
+					const size_t count = std::min<size_t>(remain, tile_size) / block_size;
+					i->encrypt(p, this->tile, count);
+					std::copy(this->tile, this->tile + count * block_size, p);
+					p += count * block_size;
+					remain -= count * block_size;
+				}
+				if (remain)
+					partial_block(0);
 			}
 		}
 
+		bool pairs_with(mac& m) const noexcept
+		{
+			return this->ciphers.size() == 1 && this->ciphers[0]->pairs_with(m);
+		}
+
+		//position is a multiple of 64 and m has taken the data before it, the whole 64-byte blocks are encrypted
+		//in one pass with m. returns their length
+		size_t encrypt_with(mac& m, byte* data, size_t length, uint64_t position, bool decrypt)
+		{
+			constexpr size_t block_size = 64;
+			auto& i = this->ciphers[0];
+			i->set_counter(position / i->block_size);
+			i->encrypt_with(m, data, length / block_size * block_size, decrypt);
+			return length / block_size * block_size;
+		}
+
 		const int key_size;
 	};
 
@@ -248,7 +580,69 @@ namespace
 			}
 		}
 
+		void update(const byte* data, size_t length)
+		{
+			for (auto& i : this->macs)
+				i->update(data, length);
+		}
+
+		std::vector<std::unique_ptr<mac::prepared>> prepare(const byte* data, size_t length, uint64_t position)
+		{
+			std::vector<std::unique_ptr<mac::prepared>> result;
+			for (auto& i : this->macs)
+				result.push_back(i->prepare(data, length, position));
+			return result;
+		}
+
+		void update(const byte* data, size_t length, const std::vector<std::unique_ptr<mac::prepared>>& prepared)
+		{
+			for (size_t i = 0; i < this->macs.size(); i++)
+				this->macs[i]->update_prepared(data, length, prepared[i].get());
+		}
+
+		//the part of the update that doesn't depend on the earlier chunks runs before waiting for the turn
 		bool sync_update(const byte* data, size_t length, uint64_t position)
+		{
+			std::vector<std::unique_ptr<mac::prepared>> prepared;
+			std::exception_ptr ptr;
+			try
+			{
+				prepared = this->prepare(data, length, position);
+			}
+			catch (...)
+			{
+				ptr = std::current_exception();
+			}
+
+			scoped_condition_variable cv(this->mutex, this->condition_variable, [&]() { return this->position == position || !this->good; });
+			if (!this->good)
+				return false;
+
+			try
+			{
+				if (ptr)
+					std::rethrow_exception(ptr);
+				this->update(data, length, prepared);
+			}
+			catch (...)
+			{
+				this->good = false;
+				throw;
+			}
+
+			this->position += length;
+			return true;
+		}
+
+		//a single cipher and a single MAC that run in one pass, AES-CTR and HMAC-SHA256
+		bool stitched(const cipher_management& ciphers) noexcept
+		{
+			return this->macs.size() == 1 && ciphers.pairs_with(*this->macs[0]);
+		}
+
+		//when stitched(), the chunk is encrypted, or decrypted, and hashed in one pass over the cache during the turn,
+		//instead of going through the cipher on its own before or after it
+		bool sync_encrypt(cipher_management& ciphers, byte* data, size_t length, uint64_t position, bool decrypt)
 		{
 			scoped_condition_variable cv(this->mutex, this->condition_variable, [&]() { return this->position == position || !this->good; });
 			if (!this->good)
@@ -256,8 +650,12 @@ namespace
 
 			try
 			{
-				for (auto& i : this->macs)
-					i->update(data, length);
+				const size_t done = position % 64 ? 0 : ciphers.encrypt_with(*this->macs[0], data, length, position, decrypt);
+				if (decrypt)
+					this->update(data + done, length - done);
+				ciphers.encrypt(data + done, length - done, position + done);
+				if (!decrypt)
+					this->update(data + done, length - done);
 			}
 			catch (...)
 			{
@@ -282,58 +680,324 @@ namespace
 		const int output_size;
 	};
 
-	//-------------------------------------------------------------------------------------------------
+	class digest_management
+	{
+	private:
+		static std::vector<std::unique_ptr<hash>> get_hashes(const std::vector<hash_algorithm>& hash_list)
+		{
+			std::vector<std::unique_ptr<hash>> hashes;
+			for (const auto& i : hash_list)
+				hashes.push_back(make_hash(i));
+			return hashes;
+		}
 
-	constexpr int default_salt_len = 32;
+		std::vector<std::unique_ptr<hash>> hashes;
+		bool good;
+		uint64_t position;
+		std::mutex mutex;
+		std::condition_variable condition_variable;
 
-	void init_cipher_and_mac(kdf_algorithm algorithm, const kdf_parameter& parameter, cipher_management& ciphers, mac_management& macs)
-	{
-		std::vector<byte> key(ciphers.key_size + macs.key_size);
-		kdf(algorithm, parameter, { key.data(), key.size() });
-		ciphers.init(key.data());
-		macs.init(key.data() + ciphers.key_size);
-	}
+	public:
+		digest_management(const std::vector<hash_algorithm>& hash_list) : hashes(this->get_hashes(hash_list)), good(true), position(0) {}
 
-	template<typename F, typename... Args>
-	void thread_run(int threads, F&& f, Args&&... args)
-	{
-		std::atomic_bool good = true;
-		auto g = [&]()
+		void update(const byte* data, size_t length)
+		{
+			for (auto& i : this->hashes)
+				i->update(data, length);
+		}
+
+		//without hashes, the threads don't wait for each other. like the MAC, the hashes prepare before the turn
+		bool sync_update(const byte* data, size_t length, uint64_t position)
 		{
+			if (this->hashes.empty())
+				return true;
+
+			std::vector<std::unique_ptr<hash::prepared>> prepared;
+			std::exception_ptr ptr;
 			try
 			{
-				f(args..., good);
+				for (auto& i : this->hashes)
+					prepared.push_back(i->prepare(data, length, position));
 			}
 			catch (...)
 			{
-				good = false;
+				ptr = std::current_exception();
+			}
+
+			scoped_condition_variable cv(this->mutex, this->condition_variable, [&]() { return this->position == position || !this->good; });
+			if (!this->good)
+				return false;
+
+			try
+			{
+				if (ptr)
+					std::rethrow_exception(ptr);
+				for (size_t i = 0; i < this->hashes.size(); i++)
+					this->hashes[i]->update_prepared(data, length, prepared[i].get());
+			}
+			catch (...)
+			{
+				this->good = false;
 				throw;
 			}
-		};
 
-		std::vector<std::future<void>> vec(threads);
-		try
-		{
-			for (auto& i : vec)
-				i = std::async(std::launch::async, g);
+			this->position += length;
+			return true;
 		}
-		catch (...)
+
+		std::vector<std::vector<byte>> final()
 		{
-			good = false;
-			for (const auto& i : vec)
-				if (i.valid())
-					i.wait();
-			throw;
+			std::vector<std::vector<byte>> result;
+			for (auto& i : this->hashes)
+			{
+				result.emplace_back(i->output_size);
+				i->final(result.back().data());
+			}
+			return result;
 		}
+	};
 
-		for (const auto& i : vec)
-			i.wait();
-		for (auto& i : vec)
-			i.get();
-	}
+	//the digests of digest_option, the chunks are hashed in input order like the MAC
+	struct stream_digests
+	{
+		stream_digests() : stream_digests(digest_option()) {}
+		stream_digests(const digest_option& option) : plaintext(option.plaintext), ciphertext(option.ciphertext) {}
 
-	template<typename F, typename G>
-	void try_catch(F&& f, G&& g)
+		digest_management plaintext;
+		digest_management ciphertext;
+	};
+
+	//-------------------------------------------------------------------------------------------------
+
+	constexpr int default_salt_len = 32;
+	constexpr int first_read_size = 1 << 16;
+
+	void init_cipher_and_mac(kdf_algorithm algorithm, const kdf_parameter& parameter, cipher_management& ciphers, mac_management& macs)
+	{
+		std::vector<byte> key(ciphers.key_size + macs.key_size);
+		kdf(algorithm, parameter, { key.data(), key.size() });
+		ciphers.init(key.data());
+		macs.init(key.data() + ciphers.key_size);
+	}
+
+	//the batch, volume and shard formats derive their keys from a batch_key with HKDF, info tells the formats apart
+	void init_cipher_and_mac(const batch_key& key, const_array salt, const_array info, cipher_management& ciphers, mac_management& macs)
+	{
+		std::vector<byte> subkey(ciphers.key_size + macs.key_size);
+		derive_subkey(key.key(), salt, info, { subkey.data(), subkey.size() });
+		ciphers.init(subkey.data());
+		macs.init(subkey.data() + ciphers.key_size);
+	}
+
+	void init_cipher_and_mac(const batch_key& key, const byte* nonce, cipher_management& ciphers, mac_management& macs)
+	{
+		constexpr byte info[] = { 'l', 'i', 'b', 'e', 'n', 'c', 'r', 'y', 'p', 't', ' ', 'b', 'a', 't', 'c', 'h' };
+		init_cipher_and_mac(key, { nonce, batch_key::nonce_size }, { info, sizeof(info) }, ciphers, macs);
+	}
+
+	//streams favour latency, the chunk is about the size of L2.
+	//seekable files favour throughput, the chunks of all threads together are about the size of L3.
+	template<typename File>
+	size_t get_chunk_size(const pipeline_option& option, File input, int threads)
+	{
+		constexpr size_t alignment = 64;
+		constexpr size_t default_size = 1 << 20;
+		if (option.chunk_size)
+		{
+			if (option.chunk_size % alignment)
+				throw std::runtime_error("libencrypt::get_chunk_size chunk size must be a multiple of 64");
+			return option.chunk_size;
+		}
+
+		size_t size;
+		if (!is_seekable(input))
+			size = cache_size(2) ? std::clamp<size_t>(cache_size(2), 1 << 16, 1 << 20) : default_size;
+		else
+			size = cache_size(3) ? std::clamp<size_t>(cache_size(3) / threads, 1 << 20, 1 << 23) : default_size;
+		return size / alignment * alignment;
+	}
+
+	//what the pipeline runs with, after fitting into option.max_memory
+	struct pipeline_plan
+	{
+		size_t chunk_size;
+		int threads;
+		uint64_t memory;
+		std::vector<int> cpus;
+	};
+
+	//the KDF finishes before the pipeline starts, so the peak is the larger of the two.
+	//under max_memory the chunk shrinks first, down to 4 KiB, then the number of chunks in flight, each thread holds one.
+	template<typename File>
+	pipeline_plan make_plan(const pipeline_option& option, File input, int threads, uint64_t kdf_memory)
+	{
+		constexpr uint64_t page_size = 1 << 12;
+		constexpr uint64_t alignment = 64;
+		constexpr uint64_t min_chunk_size = 1 << 12;
+		//the ciphers and MACs of a thread
+		constexpr uint64_t thread_overhead = sizeof(cipher_management) + (1 << 12);
+		//the first chunk on the stack and the stdio buffers
+		constexpr uint64_t fixed_memory = first_read_size + (1 << 16);
+
+		auto thread_memory = [](uint64_t chunk_size) { return (chunk_size + input_management::max_reserve_size + page_size - 1) / page_size * page_size + thread_overhead; };
+		auto total_memory = [&](uint64_t chunk_size, int threads) { return std::max(kdf_memory, threads * thread_memory(chunk_size)) + fixed_memory; };
+
+		pipeline_plan plan = { get_chunk_size(option, input, threads), threads, 0, {} };
+		if (option.max_memory)
+		{
+			const uint64_t floor = std::min<uint64_t>(plan.chunk_size, min_chunk_size);
+			const uint64_t least = total_memory(floor, 1);
+			if (least > option.max_memory)
+				throw std::runtime_error("libencrypt::make_plan max_memory is less than the expected peak of " + std::to_string(least) + " bytes");
+
+			const uint64_t budget = option.max_memory - fixed_memory;
+			if (threads * thread_memory(plan.chunk_size) > budget)
+			{
+				const uint64_t pages = (budget / threads > thread_overhead) ? (budget / threads - thread_overhead) / page_size * page_size : 0;
+				const uint64_t chunk_size = pages > input_management::max_reserve_size ? (pages - input_management::max_reserve_size) / alignment * alignment : 0;
+				if (chunk_size >= floor)
+					plan.chunk_size = chunk_size;
+				else
+				{
+					plan.chunk_size = floor;
+					plan.threads = static_cast<int>(std::min<uint64_t>(threads, budget / thread_memory(floor)));
+				}
+			}
+		}
+
+		plan.memory = total_memory(plan.chunk_size, plan.threads);
+		return plan;
+	}
+
+	template<typename File>
+	pipeline_plan prepare_pipeline(const pipeline_option& option, File input, int threads, uint64_t kdf_memory)
+	{
+		pipeline_plan plan = make_plan(option, input, threads, kdf_memory);
+		if (option.max_memory)
+			buffer_pool::global().trim();
+		if (option.affinity != thread_affinity::none)
+			plan.cpus = cpu_list(option.affinity == thread_affinity::physical_cores);
+		return plan;
+	}
+
+	//shared by every pipeline of the process, so pipelines running at the same time, like the files of a batch
+	//or the clients of an agent, are spread over the CPUs instead of all starting at the first one
+	class cpu_pool
+	{
+	public:
+		//takes the CPU of cpus with the fewest threads pinned to it, the earliest on a tie. -1 if cpus is empty
+		class lease
+		{
+		public:
+			explicit lease(const std::vector<int>& cpus) : cpu(global().acquire(cpus)) {}
+			lease(const lease&) = delete;
+			lease& operator=(const lease&) = delete;
+
+			~lease()
+			{
+				global().release(this->cpu);
+			}
+
+			const int cpu;
+		};
+
+		static cpu_pool& global()
+		{
+			static cpu_pool pool;
+			return pool;
+		}
+
+	private:
+		int acquire(const std::vector<int>& cpus)
+		{
+			if (cpus.empty())
+				return -1;
+
+			std::scoped_lock lock(this->mutex);
+			int cpu = cpus[0];
+			for (int i : cpus)
+				if (this->threads[i] < this->threads[cpu])
+					cpu = i;
+			this->threads[cpu]++;
+			return cpu;
+		}
+
+		void release(int cpu) noexcept
+		{
+			if (cpu < 0)
+				return;
+
+			std::scoped_lock lock(this->mutex);
+			auto it = this->threads.find(cpu);
+			if (!--it->second)
+				this->threads.erase(it);
+		}
+
+		std::mutex mutex;
+		//threads pinned to each CPU
+		std::map<int, int> threads;
+	};
+
+	//every thread is pinned to a CPU of cpus from cpu_pool while it runs f
+	template<typename F, typename... Args>
+	void thread_run(int threads, const std::vector<int>& cpus, F&& f, Args&&... args)
+	{
+		std::atomic_bool good = true;
+		auto g = [&]()
+		{
+			cpu_pool::lease cpu(cpus);
+			scoped_affinity affinity(cpu.cpu);
+			try
+			{
+				f(args..., good);
+			}
+			catch (...)
+			{
+				good = false;
+				throw;
+			}
+		};
+
+		std::vector<std::future<void>> vec(threads);
+		try
+		{
+			for (auto& i : vec)
+				i = utils::thread_pool::global().async(g);
+		}
+		catch (...)
+		{
+			good = false;
+			for (const auto& i : vec)
+				if (i.valid())
+					i.wait();
+			throw;
+		}
+
+		for (const auto& i : vec)
+			i.wait();
+		for (auto& i : vec)
+			i.get();
+	}
+
+	//runs g on the pool while f runs on the calling thread
+	template<typename F, typename G>
+	void run_concurrently(F&& f, G&& g)
+	{
+		std::future<void> future = utils::thread_pool::global().async(std::forward<G>(g));
+		try
+		{
+			f();
+		}
+		catch (...)
+		{
+			future.wait();
+			throw;
+		}
+		future.get();
+	}
+
+	template<typename F, typename G>
+	void try_catch(F&& f, G&& g)
 	{
 		try
 		{
@@ -363,6 +1027,30 @@ namespace
 
 	//-------------------------------------------------------------------------------------------------
 
+	struct first_chunk
+	{
+		byte data[first_read_size + input_management::max_reserve_size];
+		size_t size;
+		uint64_t position;
+	};
+
+	void read_first(input_management& in, first_chunk& first)
+	{
+		first.size = in.sync_read(first.data, first_read_size, first.position);
+	}
+
+	//while the KDF runs: the OS starts reading the chunks the threads take first and allocates the output,
+	//and the first chunk is read
+	template<typename File>
+	void prefetch(input_management& in, File input, File output, const pipeline_plan& plan, uint64_t extra_output_size, first_chunk& first)
+	{
+		const uint64_t input_size = remaining_size(input);
+		prefetch_file(input, first_read_size + static_cast<uint64_t>(plan.threads) * plan.chunk_size);
+		if (input_size)
+			preallocate_file(output, input_size + extra_output_size);
+		read_first(in, first);
+	}
+
 	void write_salt(output_management& out, kdf_parameter& parameter, byte* default_salt)
 	{
 		if (parameter.salt.data)
@@ -373,23 +1061,41 @@ namespace
 		parameter.salt = { default_salt, default_salt_len };
 	}
 
-	void encrypt_core(input_management& in, output_management& out, cipher_management ciphers, mac_management& macs, const std::atomic_bool& good)
+	void encrypt_core(input_management& in, output_management& out, cipher_management ciphers, mac_management& macs, stream_digests& digests, const std::atomic_bool& good)
 	{
-		std::vector<byte> buf(input_management::max_read_size);
+		auto buf = in.get_buffer();
+		const bool stitched = macs.stitched(ciphers);
 
 		uint64_t read_size, position;
 		std::exception_ptr ptr;
 		auto g = [&]() { ptr = std::current_exception(); };
 		while (good)
 		{
-			read_size = in.sync_read(buf.data(), position);
+			read_size = in.sync_read(buf.data(), in.chunk_size, position);
 			if (!read_size)
 				break;
 
-			try_catch([&]() { ciphers.encrypt(buf.data(), read_size, position); }, g);
-			try_catch([&]() { macs.sync_update(buf.data(), read_size, position); }, g);
+			try_catch([&]() { digests.plaintext.sync_update(buf.data(), read_size, position); }, g);
+			if (stitched)
+			{
+				//the chunk is still plaintext if the turn threw or another thread failed, so it must not be written
+				bool encrypted = false;
+				try_catch([&]() { encrypted = macs.sync_encrypt(ciphers, buf.data(), read_size, position, false); }, g);
+				if (!encrypted)
+				{
+					if (ptr)
+						std::rethrow_exception(ptr);
+					break;
+				}
+			}
+			else
+			{
+				try_catch([&]() { ciphers.encrypt(buf.data(), read_size, position); }, g);
+				try_catch([&]() { macs.sync_update(buf.data(), read_size, position); }, g);
+			}
+			try_catch([&]() { digests.ciphertext.sync_update(buf.data(), read_size, position); }, g);
 
-			if (!out.sync_write(buf.data(), read_size, position))
+			if (!out.sync_write(buf, read_size, position))
 				break;
 
 			if (ptr)
@@ -397,11 +1103,32 @@ namespace
 		}
 	}
 
-	void write_mac(output_management& out, mac_management& macs)
+	//the first chunk is processed on the calling thread, inputs that fit in it never start the pipeline.
+	//returns false if the input is exhausted
+	bool encrypt_first(first_chunk& first, output_management& out, cipher_management& ciphers, mac_management& macs, stream_digests& digests)
+	{
+		if (first.size)
+		{
+			digests.plaintext.sync_update(first.data, first.size, first.position);
+			if (macs.stitched(ciphers))
+				macs.sync_encrypt(ciphers, first.data, first.size, first.position, false);
+			else
+			{
+				ciphers.encrypt(first.data, first.size, first.position);
+				macs.sync_update(first.data, first.size, first.position);
+			}
+			digests.ciphertext.sync_update(first.data, first.size, first.position);
+			out.sync_write(first.data, first.size, first.position);
+		}
+		return first.size == first_read_size;
+	}
+
+	std::vector<byte> write_mac(output_management& out, mac_management& macs)
 	{
 		std::vector<byte> buf(macs.output_size);
 		macs.final(buf.data());
 		out.write(buf.data(), buf.size());
+		return buf;
 	}
 
 	//-------------------------------------------------------------------------------------------------
@@ -418,21 +1145,37 @@ namespace
 
 	void decrypt_core(input_management& in, output_management& out, cipher_management ciphers, mac_management& macs, const std::atomic_bool& good)
 	{
-		std::vector<byte> buf(input_management::max_read_size);
+		auto buf = in.get_buffer();
+		const bool stitched = macs.stitched(ciphers);
 
 		uint64_t read_size, position;
 		std::exception_ptr ptr;
 		auto g = [&]() { ptr = std::current_exception(); };
 		while (good)
 		{
-			read_size = in.sync_read(buf.data(), position);
+			read_size = in.sync_read(buf.data(), in.chunk_size, position);
 			if (!read_size)
 				break;
 
-			try_catch([&]() { macs.sync_update(buf.data(), read_size, position); }, g);
-			try_catch([&]() { ciphers.encrypt(buf.data(), read_size, position); }, g);
+			if (stitched)
+			{
+				//the chunk is unverified and only partly decrypted if the turn threw or another thread failed
+				bool decrypted = false;
+				try_catch([&]() { decrypted = macs.sync_encrypt(ciphers, buf.data(), read_size, position, true); }, g);
+				if (!decrypted)
+				{
+					if (ptr)
+						std::rethrow_exception(ptr);
+					break;
+				}
+			}
+			else
+			{
+				try_catch([&]() { macs.sync_update(buf.data(), read_size, position); }, g);
+				try_catch([&]() { ciphers.encrypt(buf.data(), read_size, position); }, g);
+			}
 
-			if (!out.sync_write(buf.data(), read_size, position))
+			if (!out.sync_write(buf, read_size, position))
 				break;
 
 			if (ptr)
@@ -440,6 +1183,22 @@ namespace
 		}
 	}
 
+	bool decrypt_first(first_chunk& first, output_management& out, cipher_management& ciphers, mac_management& macs)
+	{
+		if (first.size)
+		{
+			if (macs.stitched(ciphers))
+				macs.sync_encrypt(ciphers, first.data, first.size, first.position, true);
+			else
+			{
+				macs.sync_update(first.data, first.size, first.position);
+				ciphers.encrypt(first.data, first.size, first.position);
+			}
+			out.sync_write(first.data, first.size, first.position);
+		}
+		return first.size == first_read_size;
+	}
+
 	void read_mac(input_management& in, mac_management& macs)
 	{
 		std::vector<byte> buf(macs.output_size);
@@ -447,45 +1206,838 @@ namespace
 		if (!std::equal(buf.begin(), buf.end(), in.read_reserve()))
 			throw std::runtime_error("libencrypt::read_mac MAC verify failure");
 	}
+
+	//-------------------------------------------------------------------------------------------------
+
+	template<typename File>
+	digest_result encrypt_stream(File input, File output, kdf_algorithm algorithm, kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const digest_option& digest, const pipeline_option& option)
+	{
+		if (cipher_list.size() == 0 || cipher_list.size() > 2 || mac_list.size() == 0 || mac_list.size() > 2)
+			throw std::runtime_error("libencrypt::encrypt error algorithm list");
+		if (threads <= 0)
+			throw std::runtime_error("libencrypt::encrypt number of threads must be greater than zero");
+
+		const pipeline_plan plan = prepare_pipeline(option, input, threads, kdf_memory(algorithm, parameter));
+		input_management in(input, plan.chunk_size, option.huge_pages, option.drop_cache);
+		output_management out(output, option.drop_cache);
+		cipher_management ciphers(cipher_list);
+		mac_management macs(mac_list);
+		stream_digests digests(digest);
+
+		byte default_salt[default_salt_len];
+		first_chunk first;
+		write_salt(out, parameter, default_salt);
+		digests.ciphertext.update(default_salt, out.size());
+		run_concurrently([&]() { init_cipher_and_mac(algorithm, parameter, ciphers, macs); }, [&]() { prefetch(in, input, output, plan, macs.output_size, first); });
+		if (encrypt_first(first, out, ciphers, macs, digests))
+			thread_run(plan.threads, plan.cpus, encrypt_core, in, out, ciphers, macs, digests);
+
+		digest_result result;
+		result.mac = write_mac(out, macs);
+		digests.ciphertext.update(result.mac.data(), result.mac.size());
+		result.plaintext = digests.plaintext.final();
+		result.ciphertext = digests.ciphertext.final();
+		return result;
+	}
+
+	template<typename File>
+	void decrypt_stream(File input, File output, kdf_algorithm algorithm, kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option)
+	{
+		if (cipher_list.size() == 0 || cipher_list.size() > 2 || mac_list.size() == 0 || mac_list.size() > 2)
+			throw std::runtime_error("libencrypt::decrypt error algorithm list");
+		if (threads <= 0)
+			throw std::runtime_error("libencrypt::decrypt number of threads must be greater than zero");
+
+		const pipeline_plan plan = prepare_pipeline(option, input, threads, kdf_memory(algorithm, parameter));
+		input_management in(input, plan.chunk_size, option.huge_pages, option.drop_cache);
+		output_management out(output, option.drop_cache);
+		cipher_management ciphers(cipher_list);
+		mac_management macs(mac_list);
+		in.init_reserve(macs.output_size);
+
+		byte default_salt[default_salt_len];
+		first_chunk first;
+		read_salt(in, parameter, default_salt);
+		run_concurrently([&]() { init_cipher_and_mac(algorithm, parameter, ciphers, macs); }, [&]() { prefetch(in, input, output, plan, 0, first); });
+		if (decrypt_first(first, out, ciphers, macs))
+			thread_run(plan.threads, plan.cpus, decrypt_core, in, out, ciphers, macs);
+		read_mac(in, macs);
+	}
+
+	template<typename File>
+	void batch_encrypt_stream(File input, File output, const batch_key& key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option)
+	{
+		if (cipher_list.size() == 0 || cipher_list.size() > 2 || mac_list.size() == 0 || mac_list.size() > 2)
+			throw std::runtime_error("libencrypt::batch_encrypt error algorithm list");
+		if (threads <= 0)
+			throw std::runtime_error("libencrypt::batch_encrypt number of threads must be greater than zero");
+
+		const pipeline_plan plan = prepare_pipeline(option, input, threads, 0);
+		input_management in(input, plan.chunk_size, option.huge_pages, option.drop_cache);
+		output_management out(output, option.drop_cache);
+		cipher_management ciphers(cipher_list);
+		mac_management macs(mac_list);
+
+		byte nonce[batch_key::nonce_size];
+		random_byte(nonce, batch_key::nonce_size);
+		out.write(key.salt().data, batch_key::salt_size);
+		out.write(nonce, batch_key::nonce_size);
+		init_cipher_and_mac(key, nonce, ciphers, macs);
+		first_chunk first;
+		read_first(in, first);
+		stream_digests digests;
+		if (encrypt_first(first, out, ciphers, macs, digests))
+			thread_run(plan.threads, plan.cpus, encrypt_core, in, out, ciphers, macs, digests);
+		write_mac(out, macs);
+	}
+
+	template<typename File>
+	void batch_decrypt_stream(File input, File output, const std::function<const batch_key&(const_array salt)>& get_key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option)
+	{
+		if (cipher_list.size() == 0 || cipher_list.size() > 2 || mac_list.size() == 0 || mac_list.size() > 2)
+			throw std::runtime_error("libencrypt::batch_decrypt error algorithm list");
+		if (threads <= 0)
+			throw std::runtime_error("libencrypt::batch_decrypt number of threads must be greater than zero");
+
+		const pipeline_plan plan = prepare_pipeline(option, input, threads, 0);
+		input_management in(input, plan.chunk_size, option.huge_pages, option.drop_cache);
+		output_management out(output, option.drop_cache);
+		cipher_management ciphers(cipher_list);
+		mac_management macs(mac_list);
+		in.init_reserve(macs.output_size);
+
+		byte salt[batch_key::salt_size], nonce[batch_key::nonce_size];
+		if (in.read(salt, batch_key::salt_size) != batch_key::salt_size || in.read(nonce, batch_key::nonce_size) != batch_key::nonce_size)
+			throw std::runtime_error("libencrypt::batch_decrypt read salt error");
+		init_cipher_and_mac(get_key({ salt, batch_key::salt_size }), nonce, ciphers, macs);
+		first_chunk first;
+		read_first(in, first);
+		if (decrypt_first(first, out, ciphers, macs))
+			thread_run(plan.threads, plan.cpus, decrypt_core, in, out, ciphers, macs);
+		read_mac(in, macs);
+	}
+
+	//-------------------------------------------------------------------------------------------------
+
+	//stripe i of a striped file is stripe i / count of volume i % count
+	class volume_header
+	{
+	public:
+		volume_header() noexcept : data{} {}
+
+		volume_header(const batch_key& key, const byte* nonce, uint32_t index, uint32_t count, uint64_t stripe_size) noexcept
+		{
+			std::copy(key.salt().data, key.salt().data + batch_key::salt_size, this->data);
+			std::copy(nonce, nonce + batch_key::nonce_size, this->data + batch_key::salt_size);
+			utils::word_to_byte<utils::endian::little>(index, this->data + index_offset);
+			utils::word_to_byte<utils::endian::little>(count, this->data + count_offset);
+			utils::word_to_byte<utils::endian::little>(stripe_size, this->data + stripe_size_offset);
+		}
+
+		const_array salt() const noexcept
+		{
+			return { this->data, batch_key::salt_size };
+		}
+
+		//everything after the salt, the HKDF salt of the volume keys
+		const_array bound() const noexcept
+		{
+			return { this->data + batch_key::salt_size, size - batch_key::salt_size };
+		}
+
+		uint32_t index() const noexcept
+		{
+			return utils::byte_to_word<utils::endian::little, uint32_t>(this->data + index_offset);
+		}
+
+		uint32_t count() const noexcept
+		{
+			return utils::byte_to_word<utils::endian::little, uint32_t>(this->data + count_offset);
+		}
+
+		uint64_t stripe_size() const noexcept
+		{
+			return utils::byte_to_word<utils::endian::little, uint64_t>(this->data + stripe_size_offset);
+		}
+
+		static constexpr int index_offset = batch_key::salt_size + batch_key::nonce_size;
+		static constexpr int count_offset = index_offset + 4;
+		static constexpr int stripe_size_offset = count_offset + 4;
+		static constexpr int size = stripe_size_offset + 8;
+
+		byte data[size];
+	};
+
+	//the stripe size is used for the buffers before the MAC is checked, so it is bounded
+	volume_header read_volume_header(std::FILE* volume)
+	{
+		constexpr uint64_t max_stripe_size = 1 << 30;
+		volume_header header;
+		if (std::fread(header.data, sizeof(byte), volume_header::size, volume) != volume_header::size)
+			throw std::runtime_error("libencrypt::read_volume_header read error");
+		if (header.index() >= header.count() || !header.stripe_size() || header.stripe_size() % 64 || header.stripe_size() > max_stripe_size)
+			throw std::runtime_error("libencrypt::read_volume_header invalid header");
+		return header;
+	}
+
+	void init_cipher_and_mac(const batch_key& key, const volume_header& header, cipher_management& ciphers, mac_management& macs)
+	{
+		constexpr byte info[] = { 'l', 'i', 'b', 'e', 'n', 'c', 'r', 'y', 'p', 't', ' ', 'v', 'o', 'l', 'u', 'm', 'e' };
+		init_cipher_and_mac(key, header.bound(), { info, sizeof(info) }, ciphers, macs);
+	}
+
+	struct output_volume
+	{
+		output_volume(std::FILE* volume, const pipeline_option& option, const std::vector<mac_algorithm>& mac_list) : out(volume, option.drop_cache), macs(mac_list) {}
+
+		output_management out;
+		mac_management macs;
+	};
+
+	struct input_volume
+	{
+		input_volume(std::FILE* volume, const volume_header& header, size_t chunk_size, const pipeline_option& option, const std::vector<mac_algorithm>& mac_list) : in(volume, chunk_size, option.huge_pages, option.drop_cache), macs(mac_list), header(header)
+		{
+			this->in.init_reserve(this->macs.output_size);
+		}
+
+		//reads the next stripe of the volume once the stripes of the volume before it are read, so the reads of
+		//different volumes overlap. stripe counts the stripes of this volume
+		size_t read_stripe(byte* data, size_t size, uint64_t stripe, uint64_t& offset)
+		{
+			scoped_condition_variable cv(this->mutex, this->condition_variable, [&]() { return this->next == stripe; });
+			this->next++;
+			return this->in.sync_read(data, size, offset);
+		}
+
+		input_management in;
+		mac_management macs;
+		const volume_header header;
+
+	private:
+		std::mutex mutex;
+		std::condition_variable condition_variable;
+		uint64_t next = 0;
+	};
+
+	//the workers write to different volumes at the same time, so every volume can be on its own device
+	void striped_encrypt_core(input_management& in, std::deque<output_volume>& volumes, std::vector<cipher_management> ciphers, const std::atomic_bool& good)
+	{
+		auto buf = in.get_buffer();
+
+		uint64_t read_size, position;
+		std::exception_ptr ptr;
+		auto g = [&]() { ptr = std::current_exception(); };
+		while (good)
+		{
+			read_size = in.sync_read(buf.data(), in.chunk_size, position);
+			if (!read_size)
+				break;
+
+			const uint64_t stripe = position / in.chunk_size;
+			const size_t index = stripe % volumes.size();
+			const uint64_t offset = stripe / volumes.size() * in.chunk_size;
+			try_catch([&]() { ciphers[index].encrypt(buf.data(), read_size, offset); }, g);
+			try_catch([&]() { volumes[index].macs.sync_update(buf.data(), read_size, offset); }, g);
+
+			if (!volumes[index].out.sync_write(buf, read_size, offset))
+				break;
+
+			if (ptr)
+				std::rethrow_exception(ptr);
+		}
+	}
+
+	//the stripes are handed out in file order, after a short stripe no more are handed out and the rest of the volumes
+	//is left for read_mac to reject
+	struct stripe_order
+	{
+		std::mutex mutex;
+		uint64_t next = 0;
+		bool end = false;
+	};
+
+	//volumes is ordered by index
+	void striped_decrypt_core(const std::vector<input_volume*>& volumes, stripe_order& order, output_management& out, std::vector<cipher_management> ciphers, const std::atomic_bool& good)
+	{
+		const size_t stripe_size = volumes[0]->in.chunk_size;
+		auto buf = volumes[0]->in.get_buffer();
+
+		uint64_t stripe, offset;
+		std::exception_ptr ptr;
+		auto g = [&]() { ptr = std::current_exception(); };
+		while (good)
+		{
+			{
+				std::scoped_lock lock(order.mutex);
+				if (order.end)
+					break;
+				stripe = order.next++;
+			}
+
+			const size_t index = stripe % volumes.size();
+			const uint64_t position = stripe * stripe_size;
+			const size_t read_size = volumes[index]->read_stripe(buf.data(), stripe_size, stripe / volumes.size(), offset);
+			if (read_size < stripe_size)
+			{
+				std::scoped_lock lock(order.mutex);
+				order.end = true;
+			}
+
+			if (read_size)
+			{
+				try_catch([&]() { volumes[index]->macs.sync_update(buf.data(), read_size, offset); }, g);
+				try_catch([&]() { ciphers[index].encrypt(buf.data(), read_size, offset); }, g);
+			}
+
+			//the stripes taken before the end was known write nothing, after a short stripe the output is complete
+			if (!out.sync_write(buf, read_size, position))
+			{
+				if (read_size)
+					throw std::runtime_error("libencrypt::striped_decrypt volumes are not one complete set");
+				break;
+			}
+			if (read_size < stripe_size)
+				out.close();
+
+			if (ptr)
+				std::rethrow_exception(ptr);
+		}
+	}
+
+	//reads the rest of in into macs and checks the MAC, returns the bytes read
+	uint64_t verify_remaining(input_management& in, mac_management& macs)
+	{
+		auto buf = in.get_buffer();
+		uint64_t size = 0, position;
+		while (size_t read_size = in.sync_read(buf.data(), in.chunk_size, position))
+		{
+			macs.update(buf.data(), read_size);
+			size += read_size;
+		}
+		read_mac(in, macs);
+		return size;
+	}
+
+	//-------------------------------------------------------------------------------------------------
+
+	class shard_header
+	{
+	public:
+		shard_header() noexcept : data{} {}
+
+		shard_header(const batch_key& key, const byte* nonce, uint64_t offset, bool last) noexcept
+		{
+			std::copy(key.salt().data, key.salt().data + batch_key::salt_size, this->data);
+			std::copy(nonce, nonce + batch_key::nonce_size, this->data + batch_key::salt_size);
+			utils::word_to_byte<utils::endian::little>(offset, this->data + offset_offset);
+			this->data[last_offset] = last;
+		}
+
+		const_array salt() const noexcept
+		{
+			return { this->data, batch_key::salt_size };
+		}
+
+		//everything after the salt, the HKDF salt of the shard keys
+		const_array bound() const noexcept
+		{
+			return { this->data + batch_key::salt_size, size - batch_key::salt_size };
+		}
+
+		uint64_t offset() const noexcept
+		{
+			return utils::byte_to_word<utils::endian::little, uint64_t>(this->data + offset_offset);
+		}
+
+		bool last() const noexcept
+		{
+			return this->data[last_offset];
+		}
+
+		static constexpr int offset_offset = batch_key::salt_size + batch_key::nonce_size;
+		static constexpr int last_offset = offset_offset + 8;
+		static constexpr int size = last_offset + 1;
+
+		byte data[size];
+	};
+
+	shard_header read_shard_header(std::FILE* shard)
+	{
+		shard_header header;
+		if (std::fread(header.data, sizeof(byte), shard_header::size, shard) != shard_header::size)
+			throw std::runtime_error("libencrypt::read_shard_header read error");
+		if (header.data[shard_header::last_offset] > 1)
+			throw std::runtime_error("libencrypt::read_shard_header invalid header");
+		return header;
+	}
+
+	void init_cipher_and_mac(const batch_key& key, const shard_header& header, cipher_management& ciphers, mac_management& macs)
+	{
+		constexpr byte info[] = { 'l', 'i', 'b', 'e', 'n', 'c', 'r', 'y', 'p', 't', ' ', 's', 'h', 'a', 'r', 'd' };
+		init_cipher_and_mac(key, header.bound(), { info, sizeof(info) }, ciphers, macs);
+	}
+
+	//reads the headers and sorts the shards by offset, they must all come from one file
+	std::vector<std::pair<shard_header, std::FILE*>> sort_shards(const std::vector<std::FILE*>& shards)
+	{
+		std::vector<std::pair<shard_header, std::FILE*>> result;
+		for (const auto& i : shards)
+			result.emplace_back(read_shard_header(i), i);
+		std::stable_sort(result.begin(), result.end(), [](const auto& a, const auto& b) { return a.first.offset() < b.first.offset(); });
+
+		for (const auto& i : result)
+			if (!std::equal(i.first.data, i.first.data + batch_key::salt_size, result[0].first.data))
+				throw std::runtime_error("libencrypt::sort_shards shards are from different files");
+		return result;
+	}
+
+	//the shards, sorted by offset, must follow each other from offset zero to the last shard
+	void check_shard(const shard_header& header, uint64_t end, bool final)
+	{
+		if (header.offset() != end)
+			throw std::runtime_error("libencrypt::check_shard shards are missing or overlap");
+		if (header.last() != final)
+			throw std::runtime_error(final ? "libencrypt::check_shard the last shard is missing" : "libencrypt::check_shard shards after the last shard");
+	}
+
+	//returns the plaintext size
+	uint64_t decrypt_shard(std::FILE* input, const shard_header& header, std::FILE* output, const batch_key& key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option)
+	{
+		const pipeline_plan plan = prepare_pipeline(option, input, threads, 0);
+		input_management in(input, plan.chunk_size, option.huge_pages, option.drop_cache);
+		output_management out(output, option.drop_cache);
+		cipher_management ciphers(cipher_list);
+		mac_management macs(mac_list);
+		in.init_reserve(macs.output_size);
+
+		init_cipher_and_mac(key, header, ciphers, macs);
+		first_chunk first;
+		read_first(in, first);
+		if (decrypt_first(first, out, ciphers, macs))
+			thread_run(plan.threads, plan.cpus, decrypt_core, in, out, ciphers, macs);
+		read_mac(in, macs);
+		return out.size();
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void libencrypt::encrypt(std::FILE* input, std::FILE* output, kdf_algorithm algorithm, kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option)
+{
+	encrypt_stream(input, output, algorithm, parameter, cipher_list, mac_list, threads, {}, option);
+}
+
+void libencrypt::decrypt(std::FILE* input, std::FILE* output, kdf_algorithm algorithm, kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option)
+{
+	decrypt_stream(input, output, algorithm, parameter, cipher_list, mac_list, threads, option);
+}
+
+libencrypt::digest_result libencrypt::encrypt(std::FILE* input, std::FILE* output, kdf_algorithm algorithm, kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const digest_option& digest, const pipeline_option& option)
+{
+	return encrypt_stream(input, output, algorithm, parameter, cipher_list, mac_list, threads, digest, option);
+}
+
+void libencrypt::encrypt(int input, int output, kdf_algorithm algorithm, kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option)
+{
+	encrypt_stream(input, output, algorithm, parameter, cipher_list, mac_list, threads, {}, option);
+}
+
+void libencrypt::decrypt(int input, int output, kdf_algorithm algorithm, kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option)
+{
+	decrypt_stream(input, output, algorithm, parameter, cipher_list, mac_list, threads, option);
+}
+
+libencrypt::digest_result libencrypt::encrypt(int input, int output, kdf_algorithm algorithm, kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const digest_option& digest, const pipeline_option& option)
+{
+	return encrypt_stream(input, output, algorithm, parameter, cipher_list, mac_list, threads, digest, option);
+}
+
+uint64_t libencrypt::expected_memory(std::FILE* input, kdf_algorithm algorithm, const kdf_parameter& parameter, int threads, const pipeline_option& option)
+{
+	if (threads <= 0)
+		throw std::runtime_error("libencrypt::expected_memory number of threads must be greater than zero");
+
+	return make_plan(option, input, threads, kdf_memory(algorithm, parameter)).memory;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+libencrypt::batch_key::batch_key(kdf_algorithm algorithm, kdf_parameter& parameter)
+{
+	if (parameter.salt.data && parameter.salt.length != salt_size)
+		throw std::runtime_error("libencrypt::batch_key salt must be 32-bytes");
+
+	if (parameter.salt.data)
+	{
+		std::copy(parameter.salt.data, parameter.salt.data + salt_size, this->salt_data);
+		kdf(algorithm, parameter, { this->key_data, key_size });
+		return;
+	}
+
+	random_byte(this->salt_data, salt_size);
+	parameter.salt = { this->salt_data, salt_size };
+	try
+	{
+		kdf(algorithm, parameter, { this->key_data, key_size });
+	}
+	catch (...)
+	{
+		parameter.salt = {};
+		throw;
+	}
+	parameter.salt = {};
+}
+
+const_array libencrypt::batch_key::salt() const noexcept
+{
+	return { this->salt_data, salt_size };
+}
+
+const_array libencrypt::batch_key::key() const noexcept
+{
+	return { this->key_data, key_size };
+}
+
+void libencrypt::batch_encrypt(std::FILE* input, std::FILE* output, const batch_key& key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option)
+{
+	batch_encrypt_stream(input, output, key, cipher_list, mac_list, threads, option);
+}
+
+void libencrypt::batch_encrypt(int input, int output, const batch_key& key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option)
+{
+	batch_encrypt_stream(input, output, key, cipher_list, mac_list, threads, option);
+}
+
+void libencrypt::batch_decrypt(std::FILE* input, std::FILE* output, const batch_key& key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option)
+{
+	auto get_key = [&key](const_array salt) -> const batch_key&
+	{
+		if (!std::equal(salt.data, salt.data + salt.length, key.salt().data))
+			throw std::runtime_error("libencrypt::batch_decrypt salt mismatch");
+		return key;
+	};
+	batch_decrypt(input, output, get_key, cipher_list, mac_list, threads, option);
+}
+
+void libencrypt::batch_decrypt(std::FILE* input, std::FILE* output, const std::function<const batch_key&(const_array salt)>& get_key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option)
+{
+	batch_decrypt_stream(input, output, get_key, cipher_list, mac_list, threads, option);
+}
+
+void libencrypt::batch_decrypt(int input, int output, const batch_key& key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option)
+{
+	auto get_key = [&key](const_array salt) -> const batch_key&
+	{
+		if (!std::equal(salt.data, salt.data + salt.length, key.salt().data))
+			throw std::runtime_error("libencrypt::batch_decrypt salt mismatch");
+		return key;
+	};
+	batch_decrypt(input, output, get_key, cipher_list, mac_list, threads, option);
+}
+
+void libencrypt::batch_decrypt(int input, int output, const std::function<const batch_key&(const_array salt)>& get_key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option)
+{
+	batch_decrypt_stream(input, output, get_key, cipher_list, mac_list, threads, option);
 }
 
 //-------------------------------------------------------------------------------------------------
 
-void libencrypt::encrypt(std::FILE* input, std::FILE* output, kdf_algorithm algorithm, kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads)
+void libencrypt::striped_encrypt(std::FILE* input, const std::vector<std::FILE*>& volumes, const batch_key& key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option)
+{
+	if (cipher_list.size() == 0 || cipher_list.size() > 2 || mac_list.size() == 0 || mac_list.size() > 2)
+		throw std::runtime_error("libencrypt::striped_encrypt error algorithm list");
+	if (threads <= 0)
+		throw std::runtime_error("libencrypt::striped_encrypt number of threads must be greater than zero");
+	if (volumes.empty() || volumes.size() > std::numeric_limits<uint32_t>::max())
+		throw std::runtime_error("libencrypt::striped_encrypt error number of volumes");
+
+	const pipeline_plan plan = prepare_pipeline(option, input, threads, 0);
+	input_management in(input, plan.chunk_size, option.huge_pages, option.drop_cache);
+	std::deque<output_volume> outs;
+	std::vector<cipher_management> ciphers;
+	ciphers.reserve(volumes.size());
+
+	byte nonce[batch_key::nonce_size];
+	random_byte(nonce, batch_key::nonce_size);
+	for (size_t i = 0; i < volumes.size(); i++)
+	{
+		auto& volume = outs.emplace_back(volumes[i], option, mac_list);
+		const volume_header header(key, nonce, static_cast<uint32_t>(i), static_cast<uint32_t>(volumes.size()), plan.chunk_size);
+		init_cipher_and_mac(key, header, ciphers.emplace_back(cipher_list), volume.macs);
+		volume.out.write(header.data, volume_header::size);
+	}
+
+	thread_run(plan.threads, plan.cpus, striped_encrypt_core, in, outs, ciphers);
+	for (auto& i : outs)
+		write_mac(i.out, i.macs);
+}
+
+void libencrypt::striped_decrypt(const std::vector<std::FILE*>& volumes, std::FILE* output, const std::function<const batch_key&(const_array salt)>& get_key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option)
 {
 	if (cipher_list.size() == 0 || cipher_list.size() > 2 || mac_list.size() == 0 || mac_list.size() > 2)
-		throw std::runtime_error("libencrypt::encrypt error algorithm list");
+		throw std::runtime_error("libencrypt::striped_decrypt error algorithm list");
 	if (threads <= 0)
-		throw std::runtime_error("libencrypt::encrypt number of threads must be greater than zero");
+		throw std::runtime_error("libencrypt::striped_decrypt number of threads must be greater than zero");
+	if (volumes.empty())
+		throw std::runtime_error("libencrypt::striped_decrypt error number of volumes");
+
+	std::vector<volume_header> headers;
+	for (const auto& i : volumes)
+		headers.push_back(read_volume_header(i));
+
+	std::vector<bool> seen(volumes.size());
+	for (const auto& i : headers)
+	{
+		if (i.count() != volumes.size() || seen[i.index()] || !std::equal(i.data, i.data + volume_header::index_offset, headers[0].data) || i.stripe_size() != headers[0].stripe_size())
+			throw std::runtime_error("libencrypt::striped_decrypt volumes are not one complete set");
+		seen[i.index()] = true;
+	}
+
+	//the stripe size is fixed by the volumes, max_memory can only reduce the threads
+	pipeline_option fixed = option;
+	fixed.chunk_size = headers[0].stripe_size();
+	const pipeline_plan plan = prepare_pipeline(fixed, volumes[0], threads, 0);
+	if (plan.chunk_size != fixed.chunk_size)
+		throw std::runtime_error("libencrypt::striped_decrypt max_memory is less than one stripe");
+
+	const batch_key& key = get_key(headers[0].salt());
+	std::deque<input_volume> ins;
+	std::vector<input_volume*> ordered(volumes.size());
+	for (size_t i = 0; i < volumes.size(); i++)
+		ordered[headers[i].index()] = &ins.emplace_back(volumes[i], headers[i], plan.chunk_size, option, mac_list);
+
+	std::vector<cipher_management> ciphers;
+	ciphers.reserve(volumes.size());
+	for (auto& i : ordered)
+		init_cipher_and_mac(key, i->header, ciphers.emplace_back(cipher_list), i->macs);
+
+	output_management out(output, option.drop_cache);
+	stripe_order order;
+	thread_run(plan.threads, plan.cpus, striped_decrypt_core, ordered, order, out, ciphers);
+	for (auto& i : ins)
+		read_mac(i.in, i.macs);
+}
+
+uint32_t libencrypt::verify_volume(std::FILE* volume, const std::function<const batch_key&(const_array salt)>& get_key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list)
+{
+	constexpr size_t chunk_size = 1 << 20;
+	if (cipher_list.size() == 0 || cipher_list.size() > 2 || mac_list.size() == 0 || mac_list.size() > 2)
+		throw std::runtime_error("libencrypt::verify_volume error algorithm list");
 
-	input_management in(input);
-	output_management out(output);
+	const volume_header header = read_volume_header(volume);
+	input_volume v(volume, header, chunk_size, {}, mac_list);
 	cipher_management ciphers(cipher_list);
-	mac_management macs(mac_list);
+	init_cipher_and_mac(get_key(header.salt()), header, ciphers, v.macs);
 
-	byte default_salt[default_salt_len];
-	write_salt(out, parameter, default_salt);
-	init_cipher_and_mac(algorithm, parameter, ciphers, macs);
-	thread_run(threads, encrypt_core, in, out, ciphers, macs);
-	write_mac(out, macs);
+	verify_remaining(v.in, v.macs);
+	return header.index();
 }
 
-void libencrypt::decrypt(std::FILE* input, std::FILE* output, kdf_algorithm algorithm, kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads)
+//-------------------------------------------------------------------------------------------------
+
+void libencrypt::shard_encrypt(std::FILE* input, std::FILE* output, uint64_t offset, uint64_t length, const batch_key& key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option)
 {
 	if (cipher_list.size() == 0 || cipher_list.size() > 2 || mac_list.size() == 0 || mac_list.size() > 2)
-		throw std::runtime_error("libencrypt::decrypt error algorithm list");
+		throw std::runtime_error("libencrypt::shard_encrypt error algorithm list");
 	if (threads <= 0)
-		throw std::runtime_error("libencrypt::decrypt number of threads must be greater than zero");
+		throw std::runtime_error("libencrypt::shard_encrypt number of threads must be greater than zero");
+	if (!is_seekable(input) || !seek_file(input, offset))
+		throw std::runtime_error("libencrypt::shard_encrypt input must be a regular file");
+
+	const uint64_t available = remaining_size(input);
+	const bool last = length >= available;
+	length = std::min(length, available);
 
-	input_management in(input);
-	output_management out(output);
+	const pipeline_plan plan = prepare_pipeline(option, input, threads, 0);
+	input_management in(input, plan.chunk_size, option.huge_pages, option.drop_cache);
+	output_management out(output, option.drop_cache);
 	cipher_management ciphers(cipher_list);
 	mac_management macs(mac_list);
-	in.init_reserve(macs.output_size);
+	in.set_limit(length);
+
+	byte nonce[batch_key::nonce_size];
+	random_byte(nonce, batch_key::nonce_size);
+	const shard_header header(key, nonce, offset, last);
+	out.write(header.data, shard_header::size);
+	init_cipher_and_mac(key, header, ciphers, macs);
+	first_chunk first;
+	read_first(in, first);
+	stream_digests digests;
+	if (encrypt_first(first, out, ciphers, macs, digests))
+		thread_run(plan.threads, plan.cpus, encrypt_core, in, out, ciphers, macs, digests);
+	write_mac(out, macs);
+}
 
-	byte default_salt[default_salt_len];
-	read_salt(in, parameter, default_salt);
-	init_cipher_and_mac(algorithm, parameter, ciphers, macs);
-	thread_run(threads, decrypt_core, in, out, ciphers, macs);
-	read_mac(in, macs);
+void libencrypt::merge_shards(const std::vector<std::FILE*>& shards, std::FILE* output, const std::function<const batch_key&(const_array salt)>& get_key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option)
+{
+	if (cipher_list.size() == 0 || cipher_list.size() > 2 || mac_list.size() == 0 || mac_list.size() > 2)
+		throw std::runtime_error("libencrypt::merge_shards error algorithm list");
+	if (threads <= 0)
+		throw std::runtime_error("libencrypt::merge_shards number of threads must be greater than zero");
+	if (shards.empty())
+		throw std::runtime_error("libencrypt::merge_shards no shards");
+
+	const auto sorted = sort_shards(shards);
+	const batch_key& key = get_key(sorted[0].first.salt());
+	uint64_t end = 0;
+	for (size_t i = 0; i < sorted.size(); i++)
+	{
+		check_shard(sorted[i].first, end, i + 1 == sorted.size());
+		end += decrypt_shard(sorted[i].second, sorted[i].first, output, key, cipher_list, mac_list, threads, option);
+	}
+}
+
+void libencrypt::verify_shards(const std::vector<std::FILE*>& shards, const std::function<const batch_key&(const_array salt)>& get_key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list)
+{
+	constexpr size_t chunk_size = 1 << 20;
+	if (cipher_list.size() == 0 || cipher_list.size() > 2 || mac_list.size() == 0 || mac_list.size() > 2)
+		throw std::runtime_error("libencrypt::verify_shards error algorithm list");
+	if (shards.empty())
+		throw std::runtime_error("libencrypt::verify_shards no shards");
+
+	const auto sorted = sort_shards(shards);
+	const batch_key& key = get_key(sorted[0].first.salt());
+	uint64_t end = 0;
+	for (size_t i = 0; i < sorted.size(); i++)
+	{
+		check_shard(sorted[i].first, end, i + 1 == sorted.size());
+		input_management in(sorted[i].second, chunk_size, false, false);
+		cipher_management ciphers(cipher_list);
+		mac_management macs(mac_list);
+		in.init_reserve(macs.output_size);
+		init_cipher_and_mac(key, sorted[i].first, ciphers, macs);
+		end += verify_remaining(in, macs);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+
+class libencrypt::encryptor::impl
+{
+public:
+	impl(const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list) : ciphers(cipher_list), macs(mac_list), position(0), finished(false) {}
+
+	cipher_management ciphers;
+	mac_management macs;
+	uint64_t position;
+	bool finished;
+	//a copy of the salt of the caller or the generated one
+	std::vector<byte> salt;
+};
+
+libencrypt::encryptor::encryptor(kdf_algorithm algorithm, kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list)
+{
+	if (cipher_list.size() == 0 || cipher_list.size() > 2 || mac_list.size() == 0 || mac_list.size() > 2)
+		throw std::runtime_error("libencrypt::encryptor error algorithm list");
+
+	this->p = std::make_unique<impl>(cipher_list, mac_list);
+	if (parameter.salt.data)
+		this->p->salt.assign(parameter.salt.data, parameter.salt.data + parameter.salt.length);
+	else
+	{
+		this->p->salt.resize(default_salt_len);
+		random_byte(this->p->salt.data(), default_salt_len);
+	}
+
+	const const_array salt = parameter.salt;
+	parameter.salt = { this->p->salt.data(), this->p->salt.size() };
+	try
+	{
+		init_cipher_and_mac(algorithm, parameter, this->p->ciphers, this->p->macs);
+	}
+	catch (...)
+	{
+		parameter.salt = salt;
+		throw;
+	}
+	parameter.salt = salt;
+}
+
+libencrypt::encryptor::~encryptor() = default;
+
+void libencrypt::encryptor::update(const byte* input, byte* output, size_t length)
+{
+	if (this->p->finished)
+		throw std::runtime_error("libencrypt::encryptor::update after final");
+
+	if (input != output)
+		std::copy(input, input + length, output);
+	this->p->ciphers.encrypt(output, length, this->p->position);
+	this->p->macs.update(output, length);
+	this->p->position += length;
+}
+
+void libencrypt::encryptor::final(byte* tag)
+{
+	if (this->p->finished)
+		throw std::runtime_error("libencrypt::encryptor::final after final");
+
+	this->p->finished = true;
+	this->p->macs.final(tag);
+}
+
+const_array libencrypt::encryptor::salt() const noexcept
+{
+	return { this->p->salt.data(), this->p->salt.size() };
+}
+
+int libencrypt::encryptor::tag_size() const noexcept
+{
+	return this->p->macs.output_size;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+class libencrypt::decryptor::impl
+{
+public:
+	impl(const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list) : ciphers(cipher_list), macs(mac_list), position(0), finished(false) {}
+
+	cipher_management ciphers;
+	mac_management macs;
+	uint64_t position;
+	bool finished;
+};
+
+libencrypt::decryptor::decryptor(kdf_algorithm algorithm, const kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list)
+{
+	if (cipher_list.size() == 0 || cipher_list.size() > 2 || mac_list.size() == 0 || mac_list.size() > 2)
+		throw std::runtime_error("libencrypt::decryptor error algorithm list");
+	if (!parameter.salt.data)
+		throw std::runtime_error("libencrypt::decryptor salt must not be null");
+
+	this->p = std::make_unique<impl>(cipher_list, mac_list);
+	init_cipher_and_mac(algorithm, parameter, this->p->ciphers, this->p->macs);
+}
+
+libencrypt::decryptor::~decryptor() = default;
+
+void libencrypt::decryptor::update(const byte* input, byte* output, size_t length)
+{
+	if (this->p->finished)
+		throw std::runtime_error("libencrypt::decryptor::update after final");
+
+	this->p->macs.update(input, length);
+	if (input != output)
+		std::copy(input, input + length, output);
+	this->p->ciphers.encrypt(output, length, this->p->position);
+	this->p->position += length;
+}
+
+void libencrypt::decryptor::final(const byte* tag)
+{
+	if (this->p->finished)
+		throw std::runtime_error("libencrypt::decryptor::final after final");
+
+	this->p->finished = true;
+	std::vector<byte> buf(this->p->macs.output_size);
+	this->p->macs.final(buf.data());
+	if (!std::equal(buf.begin(), buf.end(), tag))
+		throw std::runtime_error("libencrypt::decryptor::final MAC verify failure");
+}
+
+int libencrypt::decryptor::tag_size() const noexcept
+{
+	return this->p->macs.output_size;
 }
\ No newline at end of file
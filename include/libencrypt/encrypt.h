@@ -2,18 +2,181 @@
 #define libencrypt_encrypt_h
 #include<cstdio>
 #include<vector>
+#include<memory>
+#include<functional>
 #include"define.h"
 #include"cipher.h"
 #include"mac.h"
+#include"hash.h"
 #include"kdf.h"
 
 namespace libencrypt
 {
+	enum class thread_affinity
+	{
+		none,
+		//one CPU of every physical core
+		physical_cores,
+		//every CPU, the SMT siblings after the physical cores
+		logical_cpus,
+	};
+
+	struct pipeline_option
+	{
+		//bytes each thread reads at a time, a multiple of 64. zero picks a size from the threads, the cache sizes and whether input is seekable.
+		size_t chunk_size = 0;
+
+		//back the chunk buffers with transparent huge pages where supported
+		bool huge_pages = false;
+
+		//bytes the KDF and the pipeline may use, zero is unlimited. the chunk size and the number of chunks in flight shrink to fit,
+		//throws before starting if the KDF or a single chunk doesn't fit.
+		size_t max_memory = 0;
+
+		//pins the threads to CPUs while they run a call, so a chunk stays in the cache of the core working on it.
+		//only supported on Linux
+		thread_affinity affinity = thread_affinity::none;
+
+		//keeps the page cache flat for large files: the input is read sequentially and dropped after use,
+		//the output is written back behind the writer and dropped. only supported on Linux
+		bool drop_cache = false;
+	};
+
+	//digests computed while encrypting, each chunk is hashed while it is still in the cache
+	struct digest_option
+	{
+		//digests of the input
+		std::vector<hash_algorithm> plaintext;
+
+		//digests of the whole output, salt and MAC included, the same as hashing the output file
+		std::vector<hash_algorithm> ciphertext;
+	};
+
+	struct digest_result
+	{
+		//in the order of digest_option
+		std::vector<std::vector<byte>> plaintext;
+		std::vector<std::vector<byte>> ciphertext;
+		std::vector<byte> mac;
+	};
+
 	//if salt is null, randomly generate 32-bytes and write.
-	void encrypt(std::FILE* input, std::FILE* output, kdf_algorithm algorithm, kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads);
+	void encrypt(std::FILE* input, std::FILE* output, kdf_algorithm algorithm, kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option = {});
 
 	//if salt is null, read first 32-bytes.
-	void decrypt(std::FILE* input, std::FILE* output, kdf_algorithm algorithm, kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads);
+	void decrypt(std::FILE* input, std::FILE* output, kdf_algorithm algorithm, kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option = {});
+
+	//file descriptor forms, read and written without stdio buffering.
+	//when output is a pipe on Linux, the chunks are spliced into it with vmsplice instead of being copied
+	void encrypt(int input, int output, kdf_algorithm algorithm, kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option = {});
+	void decrypt(int input, int output, kdf_algorithm algorithm, kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option = {});
+
+	//encrypt in one pass over input, also returns the digests and the MAC
+	digest_result encrypt(std::FILE* input, std::FILE* output, kdf_algorithm algorithm, kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const digest_option& digest, const pipeline_option& option = {});
+	digest_result encrypt(int input, int output, kdf_algorithm algorithm, kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const digest_option& digest, const pipeline_option& option = {});
+
+	//expected peak memory of encrypt or decrypt with these arguments, throws if it exceeds option.max_memory
+	uint64_t expected_memory(std::FILE* input, kdf_algorithm algorithm, const kdf_parameter& parameter, int threads, const pipeline_option& option = {});
+
+	//runs the KDF once for many files, each file gets its own keys derived from a random 32-bytes nonce.
+	//batch format = salt || nonce || ciphertext || mac, salt is 32-bytes
+	class batch_key
+	{
+	public:
+		//if salt is null, randomly generate 32-bytes.
+		batch_key(kdf_algorithm algorithm, kdf_parameter& parameter);
+
+		const_array salt() const noexcept;
+		const_array key() const noexcept;
+
+		static constexpr int salt_size = 32;
+		static constexpr int nonce_size = 32;
+		static constexpr int key_size = 64;
+
+	private:
+		byte salt_data[salt_size];
+		byte key_data[key_size];
+	};
+
+	void batch_encrypt(std::FILE* input, std::FILE* output, const batch_key& key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option = {});
+
+	//throws if the salt of input is not key.salt()
+	void batch_decrypt(std::FILE* input, std::FILE* output, const batch_key& key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option = {});
+
+	//get_key is called with the salt read from input, so input doesn't need to be seekable.
+	void batch_decrypt(std::FILE* input, std::FILE* output, const std::function<const batch_key&(const_array salt)>& get_key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option = {});
+
+	//file descriptor forms of the batch functions
+	void batch_encrypt(int input, int output, const batch_key& key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option = {});
+	void batch_decrypt(int input, int output, const batch_key& key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option = {});
+	void batch_decrypt(int input, int output, const std::function<const batch_key&(const_array salt)>& get_key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option = {});
+
+	//the batch format split over several volumes, so each volume can be written to its own device in parallel.
+	//the ciphertext is striped round-robin in stripes of option.chunk_size bytes, picked like the chunk size if zero.
+	//every volume has its own keys and MAC and can be verified alone. use at least as many threads as volumes.
+	//volume format = salt || nonce || index || count || stripe size || ciphertext || mac, little-endian 4, 4 and 8 bytes integers
+	void striped_encrypt(std::FILE* input, const std::vector<std::FILE*>& volumes, const batch_key& key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option = {});
+
+	//the volumes may be in any order, throws if they are not all the volumes of one file
+	void striped_decrypt(const std::vector<std::FILE*>& volumes, std::FILE* output, const std::function<const batch_key&(const_array salt)>& get_key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option = {});
+
+	//checks the MAC of one volume without decrypting it, returns its index
+	uint32_t verify_volume(std::FILE* volume, const std::function<const batch_key&(const_array salt)>& get_key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list);
+
+	//splits one large file between processes or machines, every shard is bytes [offset, offset + length) of a regular file
+	//encrypted as an independent job with its own nonce, keys and MAC. the jobs share the batch_key, made with the same
+	//KDF parameters and salt, so use a fresh salt for every file. the shard reaching the end of input is marked as the last.
+	//shard format = salt || nonce || offset || last || ciphertext || mac, offset is little-endian 8-bytes, last is 1-byte
+	void shard_encrypt(std::FILE* input, std::FILE* output, uint64_t offset, uint64_t length, const batch_key& key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option = {});
+
+	//decrypts the shards of one file into output in offset order, the shards may be in any order.
+	//throws if they don't cover the file from offset zero to the last shard without gaps or overlaps
+	void merge_shards(const std::vector<std::FILE*>& shards, std::FILE* output, const std::function<const batch_key&(const_array salt)>& get_key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list, int threads, const pipeline_option& option = {});
+
+	//checks the MACs and the coverage of the shards like merge_shards, without decrypting
+	void verify_shards(const std::vector<std::FILE*>& shards, const std::function<const batch_key&(const_array salt)>& get_key, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list);
+
+	//incremental form of encrypt, the KDF runs once in the constructor.
+	//if salt is null, randomly generate 32-bytes, the caller writes salt() before the first output.
+	class encryptor
+	{
+	public:
+		encryptor(kdf_algorithm algorithm, kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list);
+		~encryptor();
+
+		//input and output may be the same buffer
+		void update(const byte* input, byte* output, size_t length);
+		void final(byte* tag);
+
+		//a copy of the salt, valid for the lifetime of the encryptor
+		const_array salt() const noexcept;
+		int tag_size() const noexcept;
+
+	private:
+		class impl;
+		std::unique_ptr<impl> p;
+	};
+
+	//incremental form of decrypt, the KDF runs once in the constructor.
+	//salt must not be null, the caller reads salt and tag from the input.
+	class decryptor
+	{
+	public:
+		decryptor(kdf_algorithm algorithm, const kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list);
+		~decryptor();
+
+		//input and output may be the same buffer. the plaintext is unauthenticated until final() returns,
+		//don't act on it or release it before then
+		void update(const byte* input, byte* output, size_t length);
+		//throws if tag doesn't match
+		void final(const byte* tag);
+
+		int tag_size() const noexcept;
+
+	private:
+		class impl;
+		std::unique_ptr<impl> p;
+	};
 }
 
 #endif
\ No newline at end of file
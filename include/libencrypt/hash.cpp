@@ -0,0 +1,167 @@
+#include"hash.h"
+#include<stdexcept>
+
+using namespace libencrypt;
+
+//-------------------------------------------------------------------------------------------------
+
+#if defined(libencrypt_use_openssl)
+#include<openssl/evp.h>
+
+namespace
+{
+	template<const char* Hash, int Output_size>
+	class evp_hash : public hash
+	{
+	public:
+		evp_hash() : hash(this->output_size), algorithm(EVP_MD_fetch(nullptr, Hash, nullptr)), ctx(EVP_MD_CTX_new())
+		{
+			if (!this->algorithm || !this->ctx)
+			{
+				this->release();
+				throw std::runtime_error("libencrypt::evp_hash EVP_MD_fetch error");
+			}
+			if (!EVP_DigestInit_ex2(this->ctx, this->algorithm, nullptr))
+			{
+				this->release();
+				throw std::runtime_error("libencrypt::evp_hash EVP_DigestInit_ex2 error");
+			}
+		}
+
+		~evp_hash() override
+		{
+			this->release();
+		}
+
+		void update(const byte* input, size_t length) override
+		{
+			if (!EVP_DigestUpdate(this->ctx, input, length))
+				throw std::runtime_error("libencrypt::evp_hash::update EVP_DigestUpdate error");
+		}
+
+		void final(byte* output) override
+		{
+			unsigned int out_length = 0;
+			if (!EVP_DigestFinal_ex(this->ctx, output, &out_length) || out_length != this->output_size)
+				throw std::runtime_error("libencrypt::evp_hash::final EVP_DigestFinal_ex error");
+		}
+
+	private:
+		void release() noexcept
+		{
+			if (this->ctx)
+				EVP_MD_CTX_free(this->ctx);
+			if (this->algorithm)
+				EVP_MD_free(this->algorithm);
+		}
+
+		static constexpr int output_size = Output_size;
+		EVP_MD* algorithm;
+		EVP_MD_CTX* ctx;
+	};
+
+	constexpr char const_str_sha256[] = "SHA256";
+	constexpr char const_str_sha512[] = "SHA512";
+	constexpr char const_str_blake2b[] = "BLAKE2B-512";
+	using sha256 = evp_hash<const_str_sha256, 32>;
+	using sha512 = evp_hash<const_str_sha512, 64>;
+	using blake2b = evp_hash<const_str_blake2b, 64>;
+}
+
+#else
+#include<crypto/SHA.h>
+#include<crypto/blake2.h>
+#include<crypto/blake3.h>
+
+namespace
+{
+	template<typename Hash, int Output_size>
+	class crypto_hash : public hash
+	{
+	public:
+		crypto_hash() : hash(this->output_size) {}
+
+		void update(const byte* input, size_t length) override
+		{
+			this->impl.update(input, length);
+		}
+
+		void final(byte* output) override
+		{
+			this->impl.final(output);
+		}
+
+	private:
+		static constexpr int output_size = Output_size;
+		Hash impl;
+	};
+
+	using sha256 = crypto_hash<crypto::hash::SHA256, crypto::hash::SHA256::output_size>;
+	using sha512 = crypto_hash<crypto::hash::SHA512, crypto::hash::SHA512::output_size>;
+	using blake2b = crypto_hash<crypto::hash::blake2b, 64>;
+
+	//the digest threads hash the whole subtrees of their chunks before their turn
+	class blake3 : public hash
+	{
+	public:
+		blake3() : hash(this->output_size) {}
+
+		void update(const byte* input, size_t length) override
+		{
+			this->impl.update(input, length);
+		}
+
+		void final(byte* output) override
+		{
+			this->impl.final(output);
+		}
+
+		std::unique_ptr<prepared> prepare(const byte* input, size_t length, uint64_t position) override
+		{
+			return std::make_unique<subtree>(this->impl, input, length, position);
+		}
+
+		void update_prepared(const byte* input, size_t length, const prepared* piece) override
+		{
+			if (piece)
+				this->impl.update(static_cast<const subtree*>(piece)->impl);
+			else
+				this->impl.update(input, length);
+		}
+
+	private:
+		class subtree : public prepared
+		{
+		public:
+			subtree(const crypto::hash::blake3& hash, const byte* input, size_t length, uint64_t offset) : impl(hash, input, length, offset) {}
+
+			crypto::MAC::blake3::subtree impl;
+		};
+
+		static constexpr int output_size = 32;
+		crypto::hash::blake3 impl;
+	};
+}
+
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+std::unique_ptr<hash> libencrypt::make_hash(hash_algorithm algorithm)
+{
+	if (algorithm == hash_algorithm::sha256)
+		return std::make_unique<sha256>();
+	else if (algorithm == hash_algorithm::sha512)
+		return std::make_unique<sha512>();
+	else if (algorithm == hash_algorithm::blake2b)
+		return std::make_unique<blake2b>();
+#if defined(libencrypt_use_openssl)
+	else if (algorithm == hash_algorithm::blake3)
+		throw std::invalid_argument("libencrypt::make_hash blake3 is not supported with OpenSSL");
+#else
+	else if (algorithm == hash_algorithm::blake3)
+		return std::make_unique<blake3>();
+#endif
+	else
+		throw std::invalid_argument("libencrypt::make_hash unknown hash_algorithm");
+}
\ No newline at end of file
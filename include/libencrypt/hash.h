@@ -0,0 +1,42 @@
+#ifndef libencrypt_hash_h
+#define libencrypt_hash_h
+#include"define.h"
+#include<memory>
+
+namespace libencrypt
+{
+	enum class hash_algorithm
+	{
+		sha256,
+		sha512,
+		blake2b,
+		blake3,
+	};
+
+	class hash
+	{
+	public:
+		//the result of prepare()
+		class prepared
+		{
+		public:
+			virtual ~prepared() {}
+		};
+
+		hash(int output_size) noexcept : output_size(output_size) {}
+		virtual ~hash() {}
+
+		virtual void update(const byte* input, size_t length) = 0;
+		virtual void final(byte* output) = 0;
+
+		//like mac::prepare(), the hashes with a tree mode hash their part of a chunk before its turn
+		virtual std::unique_ptr<prepared> prepare(const byte*, size_t, uint64_t) { return nullptr; }
+		virtual void update_prepared(const byte* input, size_t length, const prepared*) { this->update(input, length); }
+
+		const int output_size;
+	};
+
+	std::unique_ptr<hash> make_hash(hash_algorithm algorithm);
+}
+
+#endif
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include"kdf.h"
+#include<algorithm>
 #include<stdexcept>
 
 using namespace libencrypt;
@@ -6,6 +7,7 @@ using namespace libencrypt;
 //-------------------------------------------------------------------------------------------------
 
 #if defined(libencrypt_use_openssl)
+#include<string>
 #include<vector>
 #include<openssl/kdf.h>
 #include<openssl/params.h>
@@ -80,10 +82,62 @@ namespace
 	{
 		argon2().derive("argon2id", parameter, output);
 	}
+
+	class hkdf
+	{
+	public:
+		hkdf() noexcept : ctx(nullptr), algorithm(nullptr) {}
+
+		void derive(const_array key, const_array salt, const_array info, array output)
+		{
+			this->algorithm = EVP_KDF_fetch(nullptr, "HKDF", nullptr);
+			if (!this->algorithm)
+				throw std::runtime_error("libencrypt::hkdf EVP_KDF_fetch error");
+			this->ctx = EVP_KDF_CTX_new(this->algorithm);
+			if (!this->ctx)
+				throw std::runtime_error("libencrypt::hkdf EVP_KDF_CTX_new error");
+
+			std::string digest = "SHA256";
+			std::vector<byte> k(key.data, key.data + key.length);
+			std::vector<byte> s(salt.data, salt.data + salt.length);
+			std::vector<byte> i(info.data, info.data + info.length);
+
+			OSSL_PARAM params[5];
+			OSSL_PARAM* p = params;
+			*p++ = OSSL_PARAM_construct_utf8_string(OSSL_KDF_PARAM_DIGEST, digest.data(), 0);
+			*p++ = OSSL_PARAM_construct_octet_string(OSSL_KDF_PARAM_KEY, k.data(), k.size());
+			if (!s.empty())
+				*p++ = OSSL_PARAM_construct_octet_string(OSSL_KDF_PARAM_SALT, s.data(), s.size());
+			if (!i.empty())
+				*p++ = OSSL_PARAM_construct_octet_string(OSSL_KDF_PARAM_INFO, i.data(), i.size());
+			*p = OSSL_PARAM_construct_end();
+
+			if (EVP_KDF_derive(this->ctx, output.data, output.length, params) != 1)
+				throw std::runtime_error("libencrypt::hkdf EVP_KDF_derive error");
+		}
+
+		~hkdf() noexcept
+		{
+			if (this->algorithm)
+				EVP_KDF_free(this->algorithm);
+			if (this->ctx)
+				EVP_KDF_CTX_free(this->ctx);
+		}
+
+		EVP_KDF_CTX* ctx;
+		EVP_KDF* algorithm;
+	};
+
+	void hkdf_sha256(const_array key, const_array salt, const_array info, array output)
+	{
+		hkdf().derive(key, salt, info, output);
+	}
 }
 
 #else
 #include<crypto/argon2.h>
+#include<crypto/HKDF.h>
+#include<crypto/SHA.h>
 
 namespace
 {
@@ -116,6 +170,11 @@ namespace
 		check(parameter, output);
 		crypto::KDF::argon2id({ parameter.password, parameter.salt, parameter.key, {} }, { parameter.time_cost, parameter.memory_cost, parameter.parallelism }, output);
 	}
+
+	void hkdf_sha256(const_array key, const_array salt, const_array info, array output)
+	{
+		crypto::KDF::HKDF<crypto::hash::SHA256>::derive(salt, key, info, output);
+	}
 }
 
 #endif
@@ -132,4 +191,25 @@ void libencrypt::kdf(kdf_algorithm algorithm, const kdf_parameter& parameter, ar
 		argon2id(dynamic_cast<const argon2_parameter&>(parameter), output);
 	else
 		throw std::invalid_argument("libencrypt::kdf unknown kdf_algorithm");
+}
+
+uint64_t libencrypt::kdf_memory(kdf_algorithm algorithm, const kdf_parameter& parameter)
+{
+	if (algorithm == kdf_algorithm::argon2i || algorithm == kdf_algorithm::argon2d || algorithm == kdf_algorithm::argon2id)
+	{
+		//memory_cost 1 KiB blocks, rounded down to a multiple of 4 * parallelism
+		const auto& p = dynamic_cast<const argon2_parameter&>(parameter);
+		const uint64_t lanes = p.parallelism ? p.parallelism : 1;
+		return std::max<uint64_t>(p.memory_cost, 8 * lanes) / (4 * lanes) * (4 * lanes) * 1024;
+	}
+	else
+		throw std::invalid_argument("libencrypt::kdf_memory unknown kdf_algorithm");
+}
+
+void libencrypt::derive_subkey(const_array key, const_array salt, const_array info, array output)
+{
+	if (output.length > 255 * 32)
+		throw std::out_of_range("libencrypt::derive_subkey output length out of range");
+
+	hkdf_sha256(key, salt, info, output);
 }
\ No newline at end of file
@@ -31,6 +31,12 @@ namespace libencrypt
 	};
 
 	void kdf(kdf_algorithm algorithm, const kdf_parameter& parameter, array output);
+
+	//bytes kdf() allocates with this parameter
+	uint64_t kdf_memory(kdf_algorithm algorithm, const kdf_parameter& parameter);
+
+	//HKDF-SHA256, derives keys from a key already produced by kdf(), output.length <= 8160
+	void derive_subkey(const_array key, const_array salt, const_array info, array output);
 }
 
 #endif
\ No newline at end of file
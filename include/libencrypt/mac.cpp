@@ -111,12 +111,63 @@ namespace
 		EVP_MAC* algorithm;
 		EVP_MAC_CTX* ctx;
 	};
+
+	class kmac256 : public mac
+	{
+	public:
+		kmac256() : mac(this->key_size, this->output_size), algorithm(nullptr), ctx(nullptr) {}
+
+		~kmac256() override
+		{
+			if (this->ctx)
+				EVP_MAC_CTX_free(this->ctx);
+			if (this->algorithm)
+				EVP_MAC_free(this->algorithm);
+		}
+
+		void init(const byte* key) override
+		{
+			this->algorithm = EVP_MAC_fetch(nullptr, "KMAC-256", nullptr);
+			if (!this->algorithm)
+				throw std::runtime_error("libencrypt::kmac256::init EVP_MAC_fetch error");
+			this->ctx = EVP_MAC_CTX_new(this->algorithm);
+			if (!this->ctx)
+				throw std::runtime_error("libencrypt::kmac256::init EVP_MAC_CTX_new error");
+			int size = this->output_size;
+			OSSL_PARAM params[] = { OSSL_PARAM_construct_int("size", &size), OSSL_PARAM_construct_end() };
+			if (!EVP_MAC_init(this->ctx, key, this->key_size, params))
+				throw std::runtime_error("libencrypt::kmac256::init EVP_MAC_init error");
+		}
+
+		void update(const byte* input, size_t length) override
+		{
+			if (!EVP_MAC_update(this->ctx, input, length))
+				throw std::runtime_error("libencrypt::kmac256::update EVP_MAC_update error");
+		}
+
+		void final(byte* output) override
+		{
+			size_t out_length = 0;
+			if (!EVP_MAC_final(this->ctx, output, &out_length, this->output_size) || out_length != this->output_size)
+				throw std::runtime_error("libencrypt::kmac256::final EVP_MAC_final error");
+		}
+
+	private:
+		static constexpr int key_size = 32;
+		static constexpr int output_size = 64;
+		EVP_MAC* algorithm;
+		EVP_MAC_CTX* ctx;
+	};
 }
 
 #else
+#include"stitch.h"
 #include<crypto/HMAC.h>
 #include<crypto/SHA.h>
 #include<crypto/poly1305.h>
+#include<crypto/blake2.h>
+#include<crypto/blake3.h>
+#include<crypto/SHA3.h>
 
 namespace
 {
@@ -141,6 +192,11 @@ namespace
 			this->impl.final(output);
 		}
 
+		crypto::MAC::HMAC<Hash>& state() noexcept
+		{
+			return this->impl;
+		}
+
 	private:
 		static constexpr int key_size = 32;
 		static constexpr int output_size = crypto::MAC::HMAC<Hash>::output_size;
@@ -176,6 +232,172 @@ namespace
 		static constexpr int output_size = crypto::MAC::poly1305::output_size;
 		crypto::MAC::poly1305 impl;
 	};
+
+	template<typename Blake2, int Output_size>
+	class blake2_tree : public mac
+	{
+	public:
+		blake2_tree() : mac(this->key_size, this->output_size) {}
+
+		void init(const byte* key) override
+		{
+			this->impl.init(key, this->key_size);
+		}
+
+		void update(const byte* input, size_t length) override
+		{
+			this->impl.update(input, length);
+		}
+
+		void final(byte* output) override
+		{
+			this->impl.final(output);
+		}
+
+	private:
+		static constexpr int key_size = 32;
+		static constexpr int output_size = Output_size;
+		Blake2 impl;
+	};
+
+	using blake2bp = blake2_tree<crypto::MAC::blake2bp, 64>;
+	using blake2sp = blake2_tree<crypto::MAC::blake2sp, 32>;
+
+	//the worker threads hash the whole subtrees of their chunks, only the chaining values are taken in order
+	class blake3 : public mac
+	{
+	public:
+		blake3() : mac(this->key_size, this->output_size), impl(nullptr) {}
+
+		void init(const byte* key) override
+		{
+			this->impl.init(key);
+		}
+
+		void update(const byte* input, size_t length) override
+		{
+			this->impl.update(input, length);
+		}
+
+		void final(byte* output) override
+		{
+			this->impl.final(output);
+		}
+
+		std::unique_ptr<prepared> prepare(const byte* input, size_t length, uint64_t position) override
+		{
+			return std::make_unique<subtree>(this->impl, input, length, position);
+		}
+
+		void update_prepared(const byte* input, size_t length, const prepared* piece) override
+		{
+			if (piece)
+				this->impl.update(static_cast<const subtree*>(piece)->impl);
+			else
+				this->impl.update(input, length);
+		}
+
+	private:
+		class subtree : public prepared
+		{
+		public:
+			subtree(const crypto::MAC::blake3& hash, const byte* input, size_t length, uint64_t offset) : impl(hash, input, length, offset) {}
+
+			crypto::MAC::blake3::subtree impl;
+		};
+
+		static constexpr int key_size = crypto::MAC::blake3::key_size;
+		static constexpr int output_size = 32;
+		crypto::MAC::blake3 impl;
+	};
+
+	class kmac256 : public mac
+	{
+	public:
+		kmac256() : mac(this->key_size, this->output_size), impl(this->output_size) {}
+
+		void init(const byte* key) override
+		{
+			this->impl.init(key, this->key_size);
+		}
+
+		void update(const byte* input, size_t length) override
+		{
+			this->impl.update(input, length);
+		}
+
+		void final(byte* output) override
+		{
+			this->impl.final(output);
+		}
+
+	private:
+		static constexpr int key_size = 32;
+		static constexpr int output_size = 64;
+		crypto::MAC::KMAC256 impl;
+	};
+
+	constexpr byte parallelhash256_customization[] = { 'P', 'a', 'r', 'a', 'l', 'l', 'e', 'l', 'H', 'a', 's', 'h', '2', '5', '6' };
+
+	//ParallelHash256 has no key, the digest of the message is the input of KMAC256 with the customization "ParallelHash256".
+	//the worker threads hash the leaves of their blocks, only the leaves are absorbed in order
+	class parallelhash256 : public mac
+	{
+	public:
+		parallelhash256() : mac(this->key_size, this->output_size), message(this->block_size), tag(this->output_size, parallelhash256_customization, sizeof(parallelhash256_customization)) {}
+
+		void init(const byte* key) override
+		{
+			this->tag.init(key, this->key_size);
+		}
+
+		void update(const byte* input, size_t length) override
+		{
+			this->message.update(input, length);
+		}
+
+		void final(byte* output) override
+		{
+			byte digest[64];
+			this->message.final(digest);
+			this->tag.update(digest, sizeof(digest));
+			this->tag.final(output);
+		}
+
+		std::unique_ptr<prepared> prepare(const byte* input, size_t length, uint64_t position) override
+		{
+			return std::make_unique<leaves>(this->message, input, length, position);
+		}
+
+		void update_prepared(const byte* input, size_t length, const prepared* piece) override
+		{
+			if (piece)
+				this->message.update(static_cast<const leaves*>(piece)->impl);
+			else
+				this->message.update(input, length);
+		}
+
+	private:
+		class leaves : public prepared
+		{
+		public:
+			leaves(const crypto::hash::ParallelHash256& hash, const byte* input, size_t length, uint64_t offset) : impl(hash, input, length, offset) {}
+
+			crypto::hash::ParallelHash256::leaves impl;
+		};
+
+		static constexpr int key_size = 32;
+		static constexpr int output_size = 64;
+		static constexpr int block_size = 8192;
+		crypto::hash::ParallelHash256 message;
+		crypto::MAC::KMAC256 tag;
+	};
+}
+
+crypto::MAC::HMAC<crypto::hash::SHA256>* libencrypt::hmac_sha256_state(mac& m) noexcept
+{
+	auto p = dynamic_cast<hmac_sha256*>(&m);
+	return p ? &p->state() : nullptr;
 }
 
 #endif
@@ -192,6 +414,22 @@ std::unique_ptr<mac> libencrypt::make_mac(mac_algorithm algorithm)
 		return std::make_unique<hmac_sha512>();
 	else if (algorithm == mac_algorithm::poly1305)
 		return std::make_unique<poly1305>();
+	else if (algorithm == mac_algorithm::kmac256)
+		return std::make_unique<kmac256>();
+#if defined(libencrypt_use_openssl)
+	//OpenSSL has no tree mode of BLAKE2, no BLAKE3 and no ParallelHash
+	else if (algorithm == mac_algorithm::blake2bp || algorithm == mac_algorithm::blake2sp || algorithm == mac_algorithm::blake3 || algorithm == mac_algorithm::parallelhash256)
+		throw std::invalid_argument("libencrypt::make_mac blake2bp, blake2sp, blake3 and parallelhash256 are not supported with OpenSSL");
+#else
+	else if (algorithm == mac_algorithm::blake2bp)
+		return std::make_unique<blake2bp>();
+	else if (algorithm == mac_algorithm::blake2sp)
+		return std::make_unique<blake2sp>();
+	else if (algorithm == mac_algorithm::blake3)
+		return std::make_unique<blake3>();
+	else if (algorithm == mac_algorithm::parallelhash256)
+		return std::make_unique<parallelhash256>();
+#endif
 	else
 		throw std::invalid_argument("libencrypt::make_mac unknown mac_algorithm");
 }
\ No newline at end of file
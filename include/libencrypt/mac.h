@@ -11,11 +11,23 @@ namespace libencrypt
 		hmac_sha256,
 		hmac_sha512,
 		poly1305,
+		blake2bp,
+		blake2sp,
+		blake3,
+		kmac256,
+		parallelhash256,
 	};
 
 	class mac
 	{
 	public:
+		//the work of an update that doesn't depend on the input before it
+		class prepared
+		{
+		public:
+			virtual ~prepared() {}
+		};
+
 		mac(int key_size, int output_size) noexcept : key_size(key_size), output_size(output_size) {}
 		virtual ~mac() {}
 
@@ -23,6 +35,11 @@ namespace libencrypt
 		virtual void update(const byte* input, size_t length) = 0;
 		virtual void final(byte* output) = 0;
 
+		//called on any thread for input at position of the message, before the updates of the input before it.
+		//update_prepared() then takes the input and the result in message order, by default nothing is prepared
+		virtual std::unique_ptr<prepared> prepare(const byte*, size_t, uint64_t) { return nullptr; }
+		virtual void update_prepared(const byte* input, size_t length, const prepared*) { this->update(input, length); }
+
 		const int key_size;
 		const int output_size;
 	};
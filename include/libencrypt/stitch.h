@@ -0,0 +1,16 @@
+#ifndef libencrypt_stitch_h
+#define libencrypt_stitch_h
+#include"mac.h"
+#include<crypto/HMAC.h>
+#include<crypto/SHA.h>
+
+//internal to the build with the in-tree crypto, not included by the public headers.
+//lets the ciphers in cipher.cpp reach the state of a MAC in mac.cpp that they run in one pass with
+
+namespace libencrypt
+{
+	//the state of m if it is HMAC-SHA256, nullptr for the other MACs
+	crypto::MAC::HMAC<crypto::hash::SHA256>* hmac_sha256_state(mac& m) noexcept;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,651 @@
+#include"system.h"
+
+using namespace libencrypt;
+
+//-------------------------------------------------------------------------------------------------
+
+#if defined(__linux__)
+#include<string>
+#include<fstream>
+#include<sys/stat.h>
+
+size_t libencrypt::cache_size(int level) noexcept
+{
+	try
+	{
+		for (int i = 0; ; i++)
+		{
+			const std::string path = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(i) + "/";
+			std::ifstream level_file(path + "level"), type_file(path + "type"), size_file(path + "size");
+			if (!level_file || !type_file || !size_file)
+				return 0;
+
+			int cache_level = 0;
+			std::string type, size;
+			level_file >> cache_level;
+			type_file >> type;
+			size_file >> size;
+			if (cache_level != level || type == "Instruction" || size.empty())
+				continue;
+
+			size_t result = std::stoull(size);
+			if (size.back() == 'K')
+				result <<= 10;
+			else if (size.back() == 'M')
+				result <<= 20;
+			return result;
+		}
+	}
+	catch (...)
+	{
+		return 0;
+	}
+}
+
+#elif defined(__APPLE__)
+#include<sys/stat.h>
+#include<sys/types.h>
+#include<sys/sysctl.h>
+
+size_t libencrypt::cache_size(int level) noexcept
+{
+	const char* name = level == 1 ? "hw.l1dcachesize" : level == 2 ? "hw.l2cachesize" : level == 3 ? "hw.l3cachesize" : nullptr;
+	uint64_t result = 0;
+	std::size_t length = sizeof(result);
+	if (!name || sysctlbyname(name, &result, &length, nullptr, 0))
+		return 0;
+	return result;
+}
+
+#elif defined(_WIN32)
+#include<vector>
+#include<io.h>
+#include<windows.h>
+
+size_t libencrypt::cache_size(int level) noexcept
+{
+	DWORD length = 0;
+	GetLogicalProcessorInformation(nullptr, &length);
+	try
+	{
+		std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> info(length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+		if (!GetLogicalProcessorInformation(info.data(), &length))
+			return 0;
+		for (const auto& i : info)
+			if (i.Relationship == RelationCache && i.Cache.Level == level && i.Cache.Type != CacheInstruction)
+				return i.Cache.Size;
+	}
+	catch (...)
+	{
+	}
+	return 0;
+}
+
+#else
+
+size_t libencrypt::cache_size(int) noexcept
+{
+	return 0;
+}
+
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+#if defined(_WIN32)
+
+bool libencrypt::is_seekable(int fd) noexcept
+{
+	HANDLE handle = reinterpret_cast<HANDLE>(_get_osfhandle(fd));
+	return handle != INVALID_HANDLE_VALUE && GetFileType(handle) == FILE_TYPE_DISK;
+}
+
+bool libencrypt::is_seekable(std::FILE* file) noexcept
+{
+	return is_seekable(_fileno(file));
+}
+
+#elif defined(__unix__) || defined(__APPLE__)
+
+bool libencrypt::is_seekable(int fd) noexcept
+{
+	struct stat status;
+	if (fstat(fd, &status))
+		return false;
+	return S_ISREG(status.st_mode) || S_ISBLK(status.st_mode);
+}
+
+bool libencrypt::is_seekable(std::FILE* file) noexcept
+{
+	return is_seekable(fileno(file));
+}
+
+#else
+
+bool libencrypt::is_seekable(int) noexcept
+{
+	return false;
+}
+
+bool libencrypt::is_seekable(std::FILE*) noexcept
+{
+	return false;
+}
+
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+//the position of a FILE includes its buffer, the position of a file descriptor is where the next read or write goes
+
+#if defined(__unix__) || defined(__APPLE__)
+#include<fcntl.h>
+#include<unistd.h>
+
+namespace
+{
+	uint64_t remaining_size_at(int fd, off_t position) noexcept
+	{
+		struct stat status;
+		if (position < 0 || fstat(fd, &status) || !S_ISREG(status.st_mode))
+			return 0;
+		return position > status.st_size ? 0 : status.st_size - position;
+	}
+}
+
+bool libencrypt::seek_file(std::FILE* file, uint64_t offset) noexcept
+{
+	return static_cast<off_t>(offset) >= 0 && !fseeko(file, static_cast<off_t>(offset), SEEK_SET);
+}
+
+uint64_t libencrypt::remaining_size(std::FILE* file) noexcept
+{
+	return remaining_size_at(fileno(file), ftello(file));
+}
+
+uint64_t libencrypt::remaining_size(int fd) noexcept
+{
+	return remaining_size_at(fd, lseek(fd, 0, SEEK_CUR));
+}
+
+#elif defined(_WIN32)
+#include<sys/types.h>
+#include<sys/stat.h>
+
+namespace
+{
+	uint64_t remaining_size_at(int fd, __int64 position) noexcept
+	{
+		struct _stat64 status;
+		if (position < 0 || _fstat64(fd, &status) || !(status.st_mode & _S_IFREG))
+			return 0;
+		return position > status.st_size ? 0 : status.st_size - position;
+	}
+}
+
+bool libencrypt::seek_file(std::FILE* file, uint64_t offset) noexcept
+{
+	return static_cast<__int64>(offset) >= 0 && !_fseeki64(file, static_cast<__int64>(offset), SEEK_SET);
+}
+
+uint64_t libencrypt::remaining_size(std::FILE* file) noexcept
+{
+	return remaining_size_at(_fileno(file), _ftelli64(file));
+}
+
+uint64_t libencrypt::remaining_size(int fd) noexcept
+{
+	return remaining_size_at(fd, _telli64(fd));
+}
+
+#else
+#include<limits>
+
+bool libencrypt::seek_file(std::FILE* file, uint64_t offset) noexcept
+{
+	return offset <= static_cast<uint64_t>(std::numeric_limits<long>::max()) && !std::fseek(file, static_cast<long>(offset), SEEK_SET);
+}
+
+uint64_t libencrypt::remaining_size(std::FILE*) noexcept
+{
+	return 0;
+}
+
+uint64_t libencrypt::remaining_size(int) noexcept
+{
+	return 0;
+}
+
+#endif
+
+#if defined(__linux__)
+
+namespace
+{
+	void prefetch_at(int fd, off_t position, uint64_t length) noexcept
+	{
+		if (position >= 0)
+			posix_fadvise(fd, position, length, POSIX_FADV_WILLNEED);
+	}
+
+	void preallocate_at(int fd, off_t position, uint64_t length) noexcept
+	{
+		if (position >= 0 && length)
+			fallocate(fd, FALLOC_FL_KEEP_SIZE, position, length);
+	}
+
+	//only the pages after dropped, so a call costs the pages read since the last one
+	void drop_read_cache_at(int fd, off_t position, uint64_t& dropped) noexcept
+	{
+		if (position > 0 && static_cast<uint64_t>(position) > dropped)
+		{
+			posix_fadvise(fd, dropped, position - dropped, POSIX_FADV_DONTNEED);
+			dropped = position;
+		}
+	}
+
+	void write_behind_at(int fd, off_t position, uint64_t length, uint64_t& dropped) noexcept
+	{
+		if (position <= 0 || static_cast<uint64_t>(position) <= dropped)
+			return;
+
+		sync_file_range(fd, dropped, position - dropped, SYNC_FILE_RANGE_WRITE);
+		if (static_cast<uint64_t>(position) > dropped + length)
+		{
+			const uint64_t end = position - length;
+			sync_file_range(fd, dropped, end - dropped, SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER);
+			posix_fadvise(fd, dropped, end - dropped, POSIX_FADV_DONTNEED);
+			dropped = end;
+		}
+	}
+}
+
+void libencrypt::prefetch_file(std::FILE* file, uint64_t length) noexcept
+{
+	prefetch_at(fileno(file), ftello(file), length);
+}
+
+void libencrypt::prefetch_file(int fd, uint64_t length) noexcept
+{
+	prefetch_at(fd, lseek(fd, 0, SEEK_CUR), length);
+}
+
+void libencrypt::preallocate_file(std::FILE* file, uint64_t length) noexcept
+{
+	preallocate_at(fileno(file), ftello(file), length);
+}
+
+void libencrypt::preallocate_file(int fd, uint64_t length) noexcept
+{
+	preallocate_at(fd, lseek(fd, 0, SEEK_CUR), length);
+}
+
+void libencrypt::advise_sequential(std::FILE* file) noexcept
+{
+	advise_sequential(fileno(file));
+}
+
+void libencrypt::advise_sequential(int fd) noexcept
+{
+	posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+}
+
+void libencrypt::drop_read_cache(std::FILE* file, uint64_t& dropped) noexcept
+{
+	drop_read_cache_at(fileno(file), ftello(file), dropped);
+}
+
+void libencrypt::drop_read_cache(int fd, uint64_t& dropped) noexcept
+{
+	drop_read_cache_at(fd, lseek(fd, 0, SEEK_CUR), dropped);
+}
+
+void libencrypt::write_behind(std::FILE* file, uint64_t length, uint64_t& dropped) noexcept
+{
+	if (!std::fflush(file))
+		write_behind_at(fileno(file), ftello(file), length, dropped);
+}
+
+void libencrypt::write_behind(int fd, uint64_t length, uint64_t& dropped) noexcept
+{
+	write_behind_at(fd, lseek(fd, 0, SEEK_CUR), length, dropped);
+}
+
+#else
+
+void libencrypt::prefetch_file(std::FILE*, uint64_t) noexcept {}
+
+void libencrypt::prefetch_file(int, uint64_t) noexcept {}
+
+void libencrypt::preallocate_file(std::FILE*, uint64_t) noexcept {}
+
+void libencrypt::preallocate_file(int, uint64_t) noexcept {}
+
+void libencrypt::advise_sequential(std::FILE*) noexcept {}
+
+void libencrypt::advise_sequential(int) noexcept {}
+
+void libencrypt::drop_read_cache(std::FILE*, uint64_t&) noexcept {}
+
+void libencrypt::drop_read_cache(int, uint64_t&) noexcept {}
+
+void libencrypt::write_behind(std::FILE*, uint64_t, uint64_t&) noexcept {}
+
+void libencrypt::write_behind(int, uint64_t, uint64_t&) noexcept {}
+
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+#if defined(_WIN32)
+#include<algorithm>
+#include<stdexcept>
+
+size_t libencrypt::read_file(int fd, byte* data, size_t length)
+{
+	size_t result = 0;
+	while (result < length)
+	{
+		int size = _read(fd, data + result, static_cast<unsigned int>(std::min<size_t>(length - result, 1 << 30)));
+		if (size < 0)
+			throw std::runtime_error("libencrypt::read_file error");
+		if (!size)
+			break;
+		result += size;
+	}
+	return result;
+}
+
+void libencrypt::write_file(int fd, const byte* data, size_t length)
+{
+	while (length)
+	{
+		int size = _write(fd, data, static_cast<unsigned int>(std::min<size_t>(length, 1 << 30)));
+		if (size < 0)
+			throw std::runtime_error("libencrypt::write_file error");
+		data += size;
+		length -= size;
+	}
+}
+
+#elif defined(__unix__) || defined(__APPLE__)
+#include<cerrno>
+#include<stdexcept>
+
+size_t libencrypt::read_file(int fd, byte* data, size_t length)
+{
+	size_t result = 0;
+	while (result < length)
+	{
+		ssize_t size = read(fd, data + result, length - result);
+		if (size < 0 && errno == EINTR)
+			continue;
+		if (size < 0)
+			throw std::runtime_error("libencrypt::read_file error");
+		if (!size)
+			break;
+		result += size;
+	}
+	return result;
+}
+
+void libencrypt::write_file(int fd, const byte* data, size_t length)
+{
+	while (length)
+	{
+		ssize_t size = write(fd, data, length);
+		if (size < 0 && errno == EINTR)
+			continue;
+		if (size < 0)
+			throw std::runtime_error("libencrypt::write_file error");
+		data += size;
+		length -= size;
+	}
+}
+
+#else
+#include<stdexcept>
+
+size_t libencrypt::read_file(int, byte*, size_t)
+{
+	throw std::runtime_error("libencrypt::read_file file descriptors are not supported");
+}
+
+void libencrypt::write_file(int, const byte*, size_t)
+{
+	throw std::runtime_error("libencrypt::write_file file descriptors are not supported");
+}
+
+#endif
+
+#if defined(__linux__)
+#include<sys/uio.h>
+
+bool libencrypt::is_pipe(int fd) noexcept
+{
+	struct stat status;
+	return !fstat(fd, &status) && S_ISFIFO(status.st_mode);
+}
+
+bool libencrypt::splice_pages(int fd, const byte* data, size_t length)
+{
+	bool first = true;
+	while (length)
+	{
+		iovec iov = { const_cast<byte*>(data), length };
+		ssize_t size = vmsplice(fd, &iov, 1, 0);
+		if (size < 0 && errno == EINTR)
+			continue;
+		if (size < 0 && first && (errno == ENOSYS || errno == EINVAL || errno == EBADF))
+			return false;
+		if (size < 0)
+			throw std::runtime_error("libencrypt::splice_pages error");
+		data += size;
+		length -= size;
+		first = false;
+	}
+	return true;
+}
+
+#else
+
+bool libencrypt::is_pipe(int) noexcept
+{
+	return false;
+}
+
+bool libencrypt::splice_pages(int, const byte*, size_t)
+{
+	return false;
+}
+
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+#if defined(__unix__) || defined(__APPLE__)
+#include<new>
+#include<sys/mman.h>
+
+byte* libencrypt::allocate_pages(size_t size, bool huge_pages)
+{
+	void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (data == MAP_FAILED)
+		throw std::bad_alloc();
+#if defined(MADV_HUGEPAGE)
+	if (huge_pages)
+		madvise(data, size, MADV_HUGEPAGE);
+#else
+	static_cast<void>(huge_pages);
+#endif
+	return static_cast<byte*>(data);
+}
+
+void libencrypt::free_pages(byte* data, size_t size) noexcept
+{
+	munmap(data, size);
+}
+
+#elif defined(_WIN32)
+#include<new>
+
+byte* libencrypt::allocate_pages(size_t size, bool)
+{
+	void* data = VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+	if (!data)
+		throw std::bad_alloc();
+	return static_cast<byte*>(data);
+}
+
+void libencrypt::free_pages(byte* data, size_t) noexcept
+{
+	VirtualFree(data, 0, MEM_RELEASE);
+}
+
+#else
+#include<new>
+
+byte* libencrypt::allocate_pages(size_t size, bool)
+{
+	return static_cast<byte*>(::operator new(size, std::align_val_t(4096)));
+}
+
+void libencrypt::free_pages(byte* data, size_t) noexcept
+{
+	::operator delete(data, std::align_val_t(4096));
+}
+
+#endif
+
+//-------------------------------------------------------------------------------------------------
+
+#if defined(__linux__)
+#include<map>
+#include<tuple>
+#include<cstring>
+#include<algorithm>
+#include<sched.h>
+#include<pthread.h>
+
+namespace
+{
+	struct cpu_topology
+	{
+		int cpu;
+		int package;
+		int core;
+		int sibling;
+	};
+
+	//sorted by sibling first, so every physical core comes before the second thread of any core
+	std::vector<cpu_topology> read_topology()
+	{
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		if (sched_getaffinity(0, sizeof(set), &set))
+			return {};
+
+		std::vector<cpu_topology> result;
+		std::map<std::pair<int, int>, int> siblings;
+		for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+			if (CPU_ISSET(cpu, &set))
+			{
+				const std::string path = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+				std::ifstream package_file(path + "physical_package_id"), core_file(path + "core_id");
+				int package = 0, core = cpu;
+				if (package_file && core_file)
+				{
+					package_file >> package;
+					core_file >> core;
+				}
+				result.push_back({ cpu, package, core, siblings[{ package, core }]++ });
+			}
+
+		std::sort(result.begin(), result.end(), [](const cpu_topology& a, const cpu_topology& b) { return std::tie(a.sibling, a.package, a.core, a.cpu) < std::tie(b.sibling, b.package, b.core, b.cpu); });
+		return result;
+	}
+}
+
+int libencrypt::physical_cores() noexcept
+{
+	try
+	{
+		auto topology = read_topology();
+		return static_cast<int>(std::count_if(topology.begin(), topology.end(), [](const cpu_topology& i) { return i.sibling == 0; }));
+	}
+	catch (...)
+	{
+		return 0;
+	}
+}
+
+std::vector<int> libencrypt::cpu_list(bool skip_smt)
+{
+	std::vector<int> result;
+	for (const auto& i : read_topology())
+		if (!skip_smt || i.sibling == 0)
+			result.push_back(i.cpu);
+	return result;
+}
+
+libencrypt::scoped_affinity::scoped_affinity(int cpu) noexcept : pinned(false)
+{
+	static_assert(sizeof(cpu_set_t) <= sizeof(saved));
+	if (cpu < 0 || cpu >= CPU_SETSIZE)
+		return;
+
+	cpu_set_t old, set;
+	CPU_ZERO(&set);
+	CPU_SET(cpu, &set);
+	if (pthread_getaffinity_np(pthread_self(), sizeof(old), &old) || pthread_setaffinity_np(pthread_self(), sizeof(set), &set))
+		return;
+	std::memcpy(this->saved, &old, sizeof(old));
+	this->pinned = true;
+}
+
+libencrypt::scoped_affinity::~scoped_affinity()
+{
+	if (!this->pinned)
+		return;
+
+	cpu_set_t old;
+	std::memcpy(&old, this->saved, sizeof(old));
+	pthread_setaffinity_np(pthread_self(), sizeof(old), &old);
+}
+
+#else
+#include<algorithm>
+
+int libencrypt::physical_cores() noexcept
+{
+#if defined(__APPLE__)
+	int result = 0;
+	std::size_t length = sizeof(result);
+	if (!sysctlbyname("hw.physicalcpu", &result, &length, nullptr, 0))
+		return result;
+#elif defined(_WIN32)
+	DWORD length = 0;
+	GetLogicalProcessorInformation(nullptr, &length);
+	try
+	{
+		std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> info(length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+		if (GetLogicalProcessorInformation(info.data(), &length))
+			return static_cast<int>(std::count_if(info.begin(), info.end(), [](const SYSTEM_LOGICAL_PROCESSOR_INFORMATION& i) { return i.Relationship == RelationProcessorCore; }));
+	}
+	catch (...)
+	{
+	}
+#endif
+	return 0;
+}
+
+std::vector<int> libencrypt::cpu_list(bool)
+{
+	return {};
+}
+
+libencrypt::scoped_affinity::scoped_affinity(int) noexcept : pinned(false), saved{} {}
+
+libencrypt::scoped_affinity::~scoped_affinity() {}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,89 @@
+#ifndef libencrypt_system_h
+#define libencrypt_system_h
+#include<cstdio>
+#include<vector>
+#include"define.h"
+
+//platform specific parts of the pipeline, each has a portable fallback
+
+namespace libencrypt
+{
+	//size of the level 1, 2 or 3 data cache in bytes, 0 if unknown
+	size_t cache_size(int level) noexcept;
+
+	//every file function takes a FILE* or a file descriptor
+
+	//true for regular files and block devices, false for pipes, sockets and terminals
+	bool is_seekable(std::FILE* file) noexcept;
+	bool is_seekable(int fd) noexcept;
+
+	//moves the position of a seekable file to offset, returns false on failure
+	bool seek_file(std::FILE* file, uint64_t offset) noexcept;
+
+	//bytes from the current position to the end of a regular file, 0 if unknown
+	uint64_t remaining_size(std::FILE* file) noexcept;
+	uint64_t remaining_size(int fd) noexcept;
+
+	//asks the OS to start reading the next length bytes of file into the page cache
+	void prefetch_file(std::FILE* file, uint64_t length) noexcept;
+	void prefetch_file(int fd, uint64_t length) noexcept;
+
+	//allocates disk space for the next length bytes written to file, without changing its size
+	void preallocate_file(std::FILE* file, uint64_t length) noexcept;
+	void preallocate_file(int fd, uint64_t length) noexcept;
+
+	//hints that file is read sequentially
+	void advise_sequential(std::FILE* file) noexcept;
+	void advise_sequential(int fd) noexcept;
+
+	//drops the pages from offset dropped to the current position of file from the page cache, and moves dropped to the position.
+	//dropped starts at 0 and is kept between calls, so each call only covers the pages read since the last one
+	void drop_read_cache(std::FILE* file, uint64_t& dropped) noexcept;
+	void drop_read_cache(int fd, uint64_t& dropped) noexcept;
+
+	//flushes file and starts writing back the pages from offset dropped to the current position,
+	//then waits for the pages up to length bytes behind it, drops them from the page cache and moves dropped past them
+	void write_behind(std::FILE* file, uint64_t length, uint64_t& dropped) noexcept;
+	void write_behind(int fd, uint64_t length, uint64_t& dropped) noexcept;
+
+	//unbuffered I/O, retrying interrupted and partial transfers. read_file returns less than length only at the end of the file.
+	//throws std::runtime_error
+	size_t read_file(int fd, byte* data, size_t length);
+	void write_file(int fd, const byte* data, size_t length);
+
+	//true if splice_pages can write to fd
+	bool is_pipe(int fd) noexcept;
+
+	//moves the pages of data into the pipe fd instead of copying them, returns false without writing if the OS refuses.
+	//the pipe and whatever the reader splices the data into keep referencing the memory with no way to tell when they let go,
+	//so data must be freed with free_pages and never written again. throws std::runtime_error
+	bool splice_pages(int fd, const byte* data, size_t length);
+
+	//page-aligned memory, huge_pages asks for transparent huge pages where supported.
+	//throws std::bad_alloc
+	byte* allocate_pages(size_t size, bool huge_pages);
+	void free_pages(byte* data, size_t size) noexcept;
+
+	//number of physical cores this process may run on, 0 if unknown
+	int physical_cores() noexcept;
+
+	//the CPUs this process may run on, the first CPU of every physical core comes before any SMT sibling.
+	//skip_smt leaves the siblings out, empty where thread affinity is unsupported
+	std::vector<int> cpu_list(bool skip_smt);
+
+	//pins the calling thread to cpu and restores its affinity when destroyed, cpu < 0 does nothing
+	class scoped_affinity
+	{
+	public:
+		explicit scoped_affinity(int cpu) noexcept;
+		scoped_affinity(const scoped_affinity&) = delete;
+		scoped_affinity& operator=(const scoped_affinity&) = delete;
+		~scoped_affinity();
+
+	private:
+		bool pinned;
+		alignas(8) unsigned char saved[128];
+	};
+}
+
+#endif
\ No newline at end of file
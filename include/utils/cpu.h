@@ -0,0 +1,82 @@
+#ifndef utils_cpu_h
+#define utils_cpu_h
+#include"define.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define utils_x86
+#include<cpuid.h>
+#endif
+
+namespace utils
+{
+	//x86 instruction set extensions supported by the CPU and enabled by the OS, all false on other architectures.
+	//code using them is compiled with __attribute__((target)) and selected at runtime.
+	struct cpu_feature
+	{
+		bool ssse3;
+		bool sse41;
+		bool aes;
+		bool sha;
+		bool avx2;
+		bool bmi2;
+		bool avx512f;
+		bool avx512vl;
+		bool avx512bw;
+
+		//detected once
+		static const cpu_feature& get() noexcept;
+
+	private:
+		cpu_feature() noexcept;
+	};
+}
+
+//-------------------------------------------------------------------------------------------------
+
+inline const utils::cpu_feature& utils::cpu_feature::get() noexcept
+{
+	static const cpu_feature feature;
+	return feature;
+}
+
+#if defined(utils_x86)
+
+inline utils::cpu_feature::cpu_feature() noexcept : ssse3(false), sse41(false), aes(false), sha(false), avx2(false), bmi2(false), avx512f(false), avx512vl(false), avx512bw(false)
+{
+	unsigned int eax, ebx, ecx, edx;
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+		return;
+	this->ssse3 = ecx & bit_SSSE3;
+	this->sse41 = ecx & bit_SSE4_1;
+	this->aes = ecx & bit_AES;
+	const bool osxsave = ecx & bit_OSXSAVE;
+	const bool avx = ecx & bit_AVX;
+
+	if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+		return;
+	this->sha = ebx & bit_SHA;
+	this->bmi2 = ebx & bit_BMI2;
+
+	//the OS must save the YMM and ZMM registers
+	if (!osxsave || !avx)
+		return;
+	unsigned int xcr0, xcr0_high;
+	__asm__("xgetbv" : "=a"(xcr0), "=d"(xcr0_high) : "c"(0));
+	if ((xcr0 & 0x6) != 0x6)
+		return;
+	this->avx2 = ebx & bit_AVX2;
+
+	if ((xcr0 & 0xe0) != 0xe0)
+		return;
+	this->avx512f = ebx & bit_AVX512F;
+	this->avx512vl = this->avx512f && (ebx & bit_AVX512VL);
+	this->avx512bw = this->avx512f && (ebx & bit_AVX512BW);
+}
+
+#else
+
+inline utils::cpu_feature::cpu_feature() noexcept : ssse3(false), sse41(false), aes(false), sha(false), avx2(false), bmi2(false), avx512f(false), avx512vl(false), avx512bw(false) {}
+
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,153 @@
+#ifndef utils_thread_pool_h
+#define utils_thread_pool_h
+#include"define.h"
+#include<algorithm>
+#include<list>
+#include<deque>
+#include<vector>
+#include<future>
+#include<mutex>
+#include<thread>
+#include<utility>
+#include<condition_variable>
+
+//assuming mutex and condition_variable don't throw exceptions
+
+namespace utils
+{
+	//like std::async(std::launch::async, f), every task starts at once on its own thread,
+	//so tasks may block on each other. finished threads wait for the next task instead of exiting.
+	class thread_pool
+	{
+	public:
+		explicit thread_pool(size_t max_idle_threads = default_max_idle_threads()) noexcept;
+		thread_pool(const thread_pool&) = delete;
+		thread_pool& operator=(const thread_pool&) = delete;
+		~thread_pool();
+
+		template<typename F>
+		std::future<void> async(F&& f);
+
+		//threads above this number exit when they become idle
+		void set_max_idle_threads(size_t max_idle_threads) noexcept;
+
+		//shared by the KDF and the encrypt/decrypt pipeline
+		static thread_pool& global() noexcept;
+
+	private:
+		static size_t default_max_idle_threads() noexcept;
+
+		void worker() noexcept;
+		void join_exited() noexcept;
+
+		std::mutex mutex;
+		std::condition_variable condition_variable;
+		std::deque<std::packaged_task<void()>> tasks;
+		std::list<std::thread> threads;
+		std::vector<std::thread::id> exited_threads;
+		size_t idle_threads;
+		size_t max_idle_threads;
+		bool stop;
+	};
+}
+
+//-------------------------------------------------------------------------------------------------
+
+inline utils::thread_pool::thread_pool(size_t max_idle_threads) noexcept : idle_threads(0), max_idle_threads(max_idle_threads), stop(false) {}
+
+inline utils::thread_pool::~thread_pool()
+{
+	{
+		std::scoped_lock lock(this->mutex);
+		this->stop = true;
+	}
+	this->condition_variable.notify_all();
+
+	for (auto& i : this->threads)
+		i.join();
+}
+
+template<typename F>
+std::future<void> utils::thread_pool::async(F&& f)
+{
+	std::packaged_task<void()> task(std::forward<F>(f));
+	std::future<void> future = task.get_future();
+
+	std::scoped_lock lock(this->mutex);
+	this->join_exited();
+	this->tasks.push_back(std::move(task));
+	if (this->tasks.size() <= this->idle_threads)
+	{
+		this->condition_variable.notify_one();
+		return future;
+	}
+
+	try
+	{
+		this->threads.emplace_back(&thread_pool::worker, this);
+	}
+	catch (...)
+	{
+		this->tasks.pop_back();
+		throw;
+	}
+
+	return future;
+}
+
+inline void utils::thread_pool::set_max_idle_threads(size_t max_idle_threads) noexcept
+{
+	std::scoped_lock lock(this->mutex);
+	this->max_idle_threads = max_idle_threads;
+}
+
+inline utils::thread_pool& utils::thread_pool::global() noexcept
+{
+	static thread_pool pool;
+	return pool;
+}
+
+inline utils::size_t utils::thread_pool::default_max_idle_threads() noexcept
+{
+	return std::max<size_t>(std::thread::hardware_concurrency(), 8);
+}
+
+inline void utils::thread_pool::worker() noexcept
+{
+	std::unique_lock lock(this->mutex);
+	while (true)
+	{
+		this->idle_threads++;
+		this->condition_variable.wait(lock, [this]() { return this->stop || !this->tasks.empty(); });
+		this->idle_threads--;
+		if (this->tasks.empty())
+			break;
+
+		std::packaged_task<void()> task = std::move(this->tasks.front());
+		this->tasks.pop_front();
+		lock.unlock();
+		task();
+		task = {};
+		lock.lock();
+
+		if (this->idle_threads >= this->max_idle_threads)
+			break;
+	}
+
+	if (!this->stop)
+		this->exited_threads.push_back(std::this_thread::get_id());
+}
+
+//mutex must be held, the exited threads no longer touch the pool after releasing it
+inline void utils::thread_pool::join_exited() noexcept
+{
+	for (const auto& id : this->exited_threads)
+	{
+		auto it = std::find_if(this->threads.begin(), this->threads.end(), [&](const std::thread& i) { return i.get_id() == id; });
+		it->join();
+		this->threads.erase(it);
+	}
+	this->exited_threads.clear();
+}
+
+#endif
\ No newline at end of file
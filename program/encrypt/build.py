@@ -26,7 +26,7 @@ if is_linux or is_darwin:
 	out = ['-o', 'encrypt']
 elif is_windows:
 	out = ['-o', 'encrypt.exe']
-source = ['src/main.cpp'] + glob.glob('../../include/libencrypt/*.cpp')
+source = glob.glob('src/*.cpp') + glob.glob('../../include/libencrypt/*.cpp')
 if not use_openssl:
 	source += glob.glob('../../include/crypto/*.cpp')
 if use_openssl:
@@ -0,0 +1,479 @@
+#include"agent.h"
+#include<stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include<cerrno>
+#include<string>
+#include<map>
+#include<list>
+#include<future>
+#include<memory>
+#include<mutex>
+#include<new>
+#include<utility>
+#include<algorithm>
+#include<exception>
+#include<utils/thread_pool.h>
+#include<unistd.h>
+#include<signal.h>
+#include<sys/mman.h>
+#include<sys/stat.h>
+#include<sys/uio.h>
+#include<sys/un.h>
+#include<sys/socket.h>
+
+namespace
+{
+	class descriptor
+	{
+	public:
+		explicit descriptor(int fd = -1) noexcept : fd(fd) {}
+		descriptor(descriptor&& other) noexcept : fd(std::exchange(other.fd, -1)) {}
+
+		descriptor& operator=(descriptor&& other) noexcept
+		{
+			std::swap(this->fd, other.fd);
+			return *this;
+		}
+
+		~descriptor()
+		{
+			if (this->fd >= 0)
+				::close(this->fd);
+		}
+
+		int get() const noexcept
+		{
+			return this->fd;
+		}
+
+		int release() noexcept
+		{
+			return std::exchange(this->fd, -1);
+		}
+
+	private:
+		int fd;
+	};
+
+	//the key lives in its own locked pages, excluded from core dumps where supported, and is wiped before unlocking
+	class locked_key
+	{
+	public:
+		locked_key(libencrypt::kdf_algorithm algorithm, libencrypt::kdf_parameter& parameter) : memory(::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)), key(nullptr)
+		{
+			if (this->memory == MAP_FAILED)
+				throw std::runtime_error("agent mmap error");
+			if (::mlock(this->memory, size))
+			{
+				::munmap(this->memory, size);
+				throw std::runtime_error("agent mlock error, check the locked memory limit");
+			}
+#if defined(MADV_DONTDUMP)
+			::madvise(this->memory, size, MADV_DONTDUMP);
+#endif
+
+			try
+			{
+				this->key = new (this->memory) libencrypt::batch_key(algorithm, parameter);
+			}
+			catch (...)
+			{
+				this->release();
+				throw;
+			}
+		}
+
+		locked_key(const locked_key&) = delete;
+		locked_key& operator=(const locked_key&) = delete;
+
+		~locked_key()
+		{
+			this->key->~batch_key();
+			this->release();
+		}
+
+		const libencrypt::batch_key& get() const noexcept
+		{
+			return *this->key;
+		}
+
+	private:
+		static constexpr std::size_t size = sizeof(libencrypt::batch_key);
+
+		void release() noexcept
+		{
+			volatile libencrypt::byte* p = static_cast<libencrypt::byte*>(this->memory);
+			for (std::size_t i = 0; i < size; i++)
+				p[i] = 0;
+			::munlock(this->memory, size);
+			::munmap(this->memory, size);
+		}
+
+		void* memory;
+		libencrypt::batch_key* key;
+	};
+
+	//encryption always uses the key made at startup, decryption runs the KDF once for every other salt.
+	//the keys of the last capacity salts are kept, a request holds its key until it finishes even if it is evicted
+	class keyring
+	{
+	public:
+		keyring(libencrypt::kdf_algorithm algorithm, libencrypt::kdf_parameter& parameter) : algorithm(algorithm), parameter(parameter), current(std::make_shared<locked_key>(algorithm, parameter)), last_serial(0) {}
+
+		const libencrypt::batch_key& get() const noexcept
+		{
+			return this->current->get();
+		}
+
+		//the KDF of a new salt runs outside mutex, the requests for the same salt wait for it and the others go on
+		std::shared_ptr<const locked_key> get(libencrypt::const_array salt)
+		{
+			if (std::equal(salt.data, salt.data + salt.length, this->current->get().salt().data))
+				return this->current;
+
+			const std::string id(salt.data, salt.data + salt.length);
+			std::promise<std::shared_ptr<const locked_key>> promise;
+			std::shared_future<std::shared_ptr<const locked_key>> future;
+			//non-zero if this request runs the KDF
+			uint64_t serial = 0;
+			{
+				std::scoped_lock lock(this->mutex);
+				auto it = this->index.find(id);
+				if (it != this->index.end())
+				{
+					this->recent.splice(this->recent.begin(), this->recent, it->second);
+					future = it->second->key;
+				}
+				else
+				{
+					future = promise.get_future().share();
+					serial = ++this->last_serial;
+					this->recent.push_front({ id, serial, future });
+					this->index[id] = this->recent.begin();
+					if (this->recent.size() > capacity)
+					{
+						this->index.erase(this->recent.back().salt);
+						this->recent.pop_back();
+					}
+				}
+			}
+
+			if (serial)
+				try
+				{
+					promise.set_value(this->make(salt));
+				}
+				catch (...)
+				{
+					//the next request for the salt tries again
+					this->forget(id, serial);
+					promise.set_exception(std::current_exception());
+				}
+			return future.get();
+		}
+
+	private:
+		static constexpr std::size_t capacity = 16;
+
+		struct entry
+		{
+			std::string salt;
+			uint64_t serial;
+			std::shared_future<std::shared_ptr<const locked_key>> key;
+		};
+
+		//the runs of the KDF share parameter, and each takes the memory of the KDF
+		std::shared_ptr<const locked_key> make(libencrypt::const_array salt)
+		{
+			std::scoped_lock lock(this->kdf_mutex);
+			this->parameter.salt = salt;
+			try
+			{
+				auto key = std::make_shared<locked_key>(this->algorithm, this->parameter);
+				this->parameter.salt = {};
+				return key;
+			}
+			catch (...)
+			{
+				this->parameter.salt = {};
+				throw;
+			}
+		}
+
+		void forget(const std::string& id, uint64_t serial)
+		{
+			std::scoped_lock lock(this->mutex);
+			auto it = this->index.find(id);
+			if (it != this->index.end() && it->second->serial == serial)
+			{
+				this->recent.erase(it->second);
+				this->index.erase(it);
+			}
+		}
+
+		libencrypt::kdf_algorithm algorithm;
+		libencrypt::kdf_parameter& parameter;
+		std::shared_ptr<const locked_key> current;
+		std::mutex mutex;
+		std::mutex kdf_mutex;
+		//most recently used first
+		std::list<entry> recent;
+		std::map<std::string, std::list<entry>::iterator> index;
+		uint64_t last_serial;
+	};
+
+	struct context
+	{
+		keyring& keys;
+		const std::vector<libencrypt::cipher_algorithm>& cipher_list;
+		const std::vector<libencrypt::mac_algorithm>& mac_list;
+		int threads;
+		const libencrypt::pipeline_option& option;
+	};
+
+	//-------------------------------------------------------------------------------------------------
+
+	sockaddr_un make_address(const std::filesystem::path& path)
+	{
+		const std::string str = path.string();
+		sockaddr_un address{};
+		if (str.size() >= sizeof(address.sun_path))
+			throw std::invalid_argument("agent socket path is too long");
+		address.sun_family = AF_UNIX;
+		std::copy(str.begin(), str.end(), address.sun_path);
+		return address;
+	}
+
+	//like ssh-agent, only clients running as the agent's own user are served
+	bool same_user(int fd) noexcept
+	{
+#if defined(__linux__)
+		ucred credential{};
+		socklen_t length = sizeof(credential);
+		return !::getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &credential, &length) && credential.uid == ::geteuid();
+#else
+		uid_t uid;
+		gid_t gid;
+		return !::getpeereid(fd, &uid, &gid) && uid == ::geteuid();
+#endif
+	}
+
+	void write_all(int fd, const char* data, std::size_t length)
+	{
+		while (length)
+		{
+			ssize_t n = ::write(fd, data, length);
+			if (n < 0 && errno == EINTR)
+				continue;
+			if (n <= 0)
+				throw std::runtime_error("agent write socket error");
+			data += n;
+			length -= n;
+		}
+	}
+
+	//request = 1-byte command with the input and output descriptors attached
+	void send_request(int fd, agent::request req, int input, int output)
+	{
+		union
+		{
+			cmsghdr header;
+			char buffer[CMSG_SPACE(sizeof(int) * 2)];
+		} control{};
+		char data = static_cast<char>(req);
+		iovec iov = { &data, 1 };
+
+		msghdr message{};
+		message.msg_iov = &iov;
+		message.msg_iovlen = 1;
+		message.msg_control = control.buffer;
+		message.msg_controllen = sizeof(control.buffer);
+		cmsghdr* header = CMSG_FIRSTHDR(&message);
+		header->cmsg_level = SOL_SOCKET;
+		header->cmsg_type = SCM_RIGHTS;
+		header->cmsg_len = CMSG_LEN(sizeof(int) * 2);
+		int fds[2] = { input, output };
+		std::copy(reinterpret_cast<const char*>(fds), reinterpret_cast<const char*>(fds) + sizeof(fds), reinterpret_cast<char*>(CMSG_DATA(header)));
+
+		ssize_t n;
+		do
+			n = ::sendmsg(fd, &message, 0);
+		while (n < 0 && errno == EINTR);
+		if (n != 1)
+			throw std::runtime_error("agent send request error");
+	}
+
+	char receive_request(int fd, descriptor& input, descriptor& output)
+	{
+		union
+		{
+			cmsghdr header;
+			char buffer[CMSG_SPACE(sizeof(int) * 2)];
+		} control{};
+		char data = 0;
+		iovec iov = { &data, 1 };
+
+		msghdr message{};
+		message.msg_iov = &iov;
+		message.msg_iovlen = 1;
+		message.msg_control = control.buffer;
+		message.msg_controllen = sizeof(control.buffer);
+
+		ssize_t n;
+		do
+			n = ::recvmsg(fd, &message, 0);
+		while (n < 0 && errno == EINTR);
+
+		//take ownership of every received descriptor first, so they are closed on error
+		std::vector<descriptor> fds;
+		if (n > 0)
+			for (cmsghdr* i = CMSG_FIRSTHDR(&message); i; i = CMSG_NXTHDR(&message, i))
+				if (i->cmsg_level == SOL_SOCKET && i->cmsg_type == SCM_RIGHTS)
+					for (std::size_t j = 0; j < (i->cmsg_len - CMSG_LEN(0)) / sizeof(int); j++)
+					{
+						int received;
+						std::copy(reinterpret_cast<const char*>(CMSG_DATA(i)) + j * sizeof(int), reinterpret_cast<const char*>(CMSG_DATA(i)) + (j + 1) * sizeof(int), reinterpret_cast<char*>(&received));
+						fds.emplace_back(received);
+					}
+
+		if (n != 1 || (message.msg_flags & MSG_CTRUNC) || fds.size() != 2)
+			throw std::runtime_error("agent receive request error");
+		input = std::move(fds[0]);
+		output = std::move(fds[1]);
+		return data;
+	}
+
+	//reply = 1-byte status, followed by the error message if the status is not zero
+	void handle(descriptor client, context& ctx) noexcept
+	{
+		std::string reply(1, '\0');
+		try
+		{
+			descriptor input, output;
+			char req = receive_request(client.get(), input, output);
+
+			//the descriptors are used directly, a pipe to the client gets the chunks spliced into it
+			if (req == static_cast<char>(agent::request::encrypt))
+				libencrypt::batch_encrypt(input.get(), output.get(), ctx.keys.get(), ctx.cipher_list, ctx.mac_list, ctx.threads, ctx.option);
+			else if (req == static_cast<char>(agent::request::decrypt))
+			{
+				std::shared_ptr<const locked_key> key;
+				auto get_key = [&ctx, &key](libencrypt::const_array salt) -> const libencrypt::batch_key& { key = ctx.keys.get(salt); return key->get(); };
+				libencrypt::batch_decrypt(input.get(), output.get(), get_key, ctx.cipher_list, ctx.mac_list, ctx.threads, ctx.option);
+			}
+			else
+				throw std::invalid_argument("agent unknown request");
+
+			if (::close(output.release()))
+				throw std::runtime_error("agent write output error");
+		}
+		catch (const std::exception& e)
+		{
+			reply = std::string(1, '\1') + e.what();
+		}
+		catch (...)
+		{
+			reply = std::string(1, '\1') + "agent unknown error";
+		}
+
+		try
+		{
+			write_all(client.get(), reply.data(), reply.size());
+		}
+		catch (...)
+		{
+			//the client has gone away
+		}
+	}
+}
+
+void agent::serve(const std::filesystem::path& path, libencrypt::kdf_algorithm algorithm, libencrypt::kdf_parameter& parameter, const std::vector<libencrypt::cipher_algorithm>& cipher_list, const std::vector<libencrypt::mac_algorithm>& mac_list, int threads, const libencrypt::pipeline_option& option)
+{
+	if (threads <= 0)
+		throw std::invalid_argument("number of threads must be greater than zero");
+
+	const sockaddr_un address = make_address(path);
+	keyring keys(algorithm, parameter);
+	context ctx = { keys, cipher_list, mac_list, threads, option };
+
+	descriptor server(::socket(AF_UNIX, SOCK_STREAM, 0));
+	if (server.get() < 0)
+		throw std::runtime_error("agent socket error");
+
+	//a socket left by an earlier agent is replaced, anything else at path is kept
+	struct stat status;
+	if (!::lstat(address.sun_path, &status))
+	{
+		if (!S_ISSOCK(status.st_mode))
+			throw std::runtime_error("agent socket path exists and is not a socket");
+		::unlink(address.sun_path);
+	}
+
+	//only the owner may connect, nobody can connect before listen so the mode is set in between
+	if (::bind(server.get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) || ::chmod(address.sun_path, 0600) || ::listen(server.get(), SOMAXCONN))
+		throw std::runtime_error("agent bind socket error");
+
+	//a client leaving early must not kill the agent
+	::signal(SIGPIPE, SIG_IGN);
+
+	while (true)
+	{
+		descriptor client(::accept(server.get(), nullptr, nullptr));
+		if (client.get() < 0)
+		{
+			if (errno == EINTR || errno == ECONNABORTED)
+				continue;
+			throw std::runtime_error("agent accept error");
+		}
+		if (!same_user(client.get()))
+			continue;
+
+		utils::thread_pool::global().async([client = std::move(client), &ctx]() mutable { handle(std::move(client), ctx); });
+	}
+}
+
+void agent::submit(const std::filesystem::path& path, request req, std::FILE* input, std::FILE* output)
+{
+	const sockaddr_un address = make_address(path);
+	descriptor client(::socket(AF_UNIX, SOCK_STREAM, 0));
+	if (client.get() < 0)
+		throw std::runtime_error("agent socket error");
+	if (::connect(client.get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)))
+		throw std::runtime_error("connect agent error");
+
+	send_request(client.get(), req, ::fileno(input), ::fileno(output));
+
+	std::string reply;
+	char buffer[256];
+	while (true)
+	{
+		ssize_t n = ::read(client.get(), buffer, sizeof(buffer));
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n < 0)
+			throw std::runtime_error("agent read socket error");
+		if (n == 0)
+			break;
+		reply.append(buffer, n);
+	}
+
+	if (reply.empty())
+		throw std::runtime_error("agent closed the connection");
+	if (reply[0])
+		throw std::runtime_error(reply.substr(1));
+}
+
+#else
+
+void agent::serve(const std::filesystem::path&, libencrypt::kdf_algorithm, libencrypt::kdf_parameter&, const std::vector<libencrypt::cipher_algorithm>&, const std::vector<libencrypt::mac_algorithm>&, int, const libencrypt::pipeline_option&)
+{
+	throw std::runtime_error("agent is not supported on this platform");
+}
+
+void agent::submit(const std::filesystem::path&, request, std::FILE*, std::FILE*)
+{
+	throw std::runtime_error("agent is not supported on this platform");
+}
+
+#endif
\ No newline at end of file
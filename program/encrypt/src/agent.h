@@ -0,0 +1,28 @@
+#ifndef encrypt_agent_h
+#define encrypt_agent_h
+#include<cstdio>
+#include<vector>
+#include<filesystem>
+#include<libencrypt/encrypt.h>
+
+//the agent runs the KDF once and serves local clients over a UNIX domain socket,
+//clients pass their input and output file descriptors instead of the data.
+//requests use the batch format, so the agent also decrypts files made by --batch.
+
+namespace agent
+{
+	enum class request : char
+	{
+		encrypt = 'e',
+		decrypt = 'd',
+	};
+
+	//serves until the process is killed, the keys are kept in locked memory.
+	//a stale socket file at path is replaced.
+	void serve(const std::filesystem::path& path, libencrypt::kdf_algorithm algorithm, libencrypt::kdf_parameter& parameter, const std::vector<libencrypt::cipher_algorithm>& cipher_list, const std::vector<libencrypt::mac_algorithm>& mac_list, int threads, const libencrypt::pipeline_option& option);
+
+	//returns when the agent has finished the request, throws the error reported by the agent
+	void submit(const std::filesystem::path& path, request req, std::FILE* input, std::FILE* output);
+}
+
+#endif
\ No newline at end of file
@@ -4,14 +4,24 @@
 #include<vector>
 #include<string>
 #include<tuple>
+#include<map>
 #include<memory>
+#include<mutex>
+#include<atomic>
+#include<future>
+#include<algorithm>
 #include<cstdlib>
+#include<limits>
 #include<charconv>
 #include<iterator>
 #include<filesystem>
+#include<thread>
 #include<exception>
 #include<stdexcept>
 #include<libencrypt/encrypt.h>
+#include<libencrypt/system.h>
+#include<utils/thread_pool.h>
+#include"agent.h"
 
 constexpr auto help =
 R"(
@@ -19,8 +29,19 @@ NAME
 	encrypt - encrypt utility
 
 SYNOPSIS
-	encrypt -e [-k kdf][-c cipher][-m mac][-p password][-s key][-t threads][-i file][-o file]
-	encrypt -d [-k kdf][-c cipher][-m mac][-p password][-s key][-t threads][-i file][-o file]
+	encrypt -e [-k kdf][-c cipher][-m mac][-p password][-s key][-t threads][-b size][--max-memory size][--affinity mode][--page-cache policy][--digest target:hash...][-i file][-o file]
+	encrypt -d [-k kdf][-c cipher][-m mac][-p password][-s key][-t threads][-b size][--max-memory size][--affinity mode][--page-cache policy][-i file][-o file]
+	encrypt -e --batch directory -o directory [-k kdf][-c cipher][-m mac][-p password][-s key][-t threads][-b size][--max-memory size][--affinity mode][--page-cache policy]
+	encrypt -d --batch directory -o directory [-k kdf][-c cipher][-m mac][-p password][-s key][-t threads][-b size][--max-memory size][--affinity mode][--page-cache policy]
+	encrypt --agent socket [-k kdf][-c cipher][-m mac][-p password][-s key][-t threads][-b size][--max-memory size][--affinity mode][--page-cache policy]
+	encrypt -e --volume file... [-i file][-k kdf][-c cipher][-m mac][-p password][-s key][-t threads][-b size][--max-memory size][--affinity mode][--page-cache policy]
+	encrypt -d --volume file... [-o file][-k kdf][-c cipher][-m mac][-p password][-s key][-t threads][--max-memory size][--affinity mode][--page-cache policy]
+	encrypt -d --verify-volume file... [-k kdf][-c cipher][-m mac][-p password][-s key]
+	encrypt -e -i file --range offset,length --salt file [-o file][-k kdf][-c cipher][-m mac][-p password][-s key][-t threads][-b size][--max-memory size][--affinity mode][--page-cache policy]
+	encrypt -d --shard file... [-o file][-k kdf][-c cipher][-m mac][-p password][-s key][-t threads][--max-memory size][--affinity mode][--page-cache policy]
+	encrypt -d --verify-shard file... [-k kdf][-c cipher][-m mac][-p password][-s key]
+	encrypt -e --connect socket [-i file][-o file]
+	encrypt -d --connect socket [-i file][-o file]
 	encrypt -h
 
 OPTIONS
@@ -58,20 +79,101 @@ OPTIONS
 			hmac-sha256
 			hmac-sha512
 			poly1305
-
-		The default is "poly1305".
+			blake2bp
+			blake2sp
+			blake3
+			kmac256
+			parallelhash256    KMAC256 of the ParallelHash256 digest with blocks of 8192 bytes
+
+		The default is "poly1305". blake2bp, blake2sp, blake3 and parallelhash256 aren't available when built with OpenSSL.
+		blake3 is hashed by all the threads at once when the chunk size is a multiple of 1024,
+		parallelhash256 when it is a multiple of 8192.
 	-p password
 		Password file path, the default password is empty.
 	-s key
 		Secret key file path, the default secret key is empty.
 	-t threads
 		Number of threads, the default is 4.
+		"auto" starts one thread per physical core.
+	-b size
+		Bytes each thread reads at a time, a multiple of 64 with an optional K, M or G suffix.
+		The default is "auto", which picks a size from the threads, the cache sizes and whether the input is seekable.
+	--max-memory size
+		Upper bound for the memory used by the KDF and the threads, with an optional K, M or G suffix.
+		The chunk size and then the number of threads are reduced to fit.
+		Fails before starting, showing the expected peak, if the KDF alone doesn't fit.
+		With --batch and --agent it applies to each file.
+	--affinity mode
+		Pins the threads to CPUs, so each chunk stays in the cache of the core working on it. Only supported on Linux.
+
+		The supported modes are:
+			none
+			cores    one CPU of every physical core, skipping SMT siblings
+			cpus     every CPU, the SMT siblings after the physical cores
+
+		The default is "none".
+	--page-cache policy
+		What happens to the file data in the page cache. Only supported on Linux.
+
+		The supported policies are:
+			keep     left to the operating system
+			drop     the input is read sequentially and dropped after use, the output is written back
+			         behind the writer and dropped, so encrypting large files doesn't evict other data
+
+		The default is "keep".
+	--digest target:hash
+		Repeated for every digest. Computes a digest while encrypting a file, in the same pass over the input,
+		and prints it to stderr as "target hash hex". Only supported when encrypting a single file.
+
+		The supported targets are:
+			plaintext     the input
+			ciphertext    the whole output file
+
+		The supported hashes are:
+			sha256
+			sha512
+			blake2b
+			blake3
 
 	-i input
 		Input file path, the default is stdin.
 	-o output
 		Output file path, the default is stdout.
 
+	--batch directory
+		Encrypt or decrypt every file under the directory into the same relative path under the -o directory.
+		The KDF runs once for the whole batch, and each file derives its own keys from a random nonce with HKDF-SHA256.
+		Files are processed concurrently, -t is the number of files processed at the same time.
+		Batch files can only be decrypted with --batch or an agent.
+
+	--volume file
+		Repeated for every volume. Encrypting stripes the ciphertext round-robin over the volumes,
+		so each volume can be on its own device and they are written in parallel by the threads.
+		The stripe size is -b, use at least as many threads as volumes.
+		Every volume gets its own keys and MAC, decrypting takes all the volumes in any order.
+	--verify-volume file
+		Repeated for every volume to check. Checks the MAC of each volume alone, without decrypting it.
+
+	--range offset,length
+		Encrypt only bytes [offset, offset + length) of the -i file into a shard, the input must be a regular file.
+		Shards of one file can be made at the same time by separate processes or machines, with the same password,
+		KDF and --salt. Every shard gets its own keys and MAC, the shard reaching the end of the file is marked as the last.
+	--salt file
+		The 32-bytes KDF salt shared by the shards of a file, needed with --range. Use a fresh salt for every file.
+	--shard file
+		Repeated for every shard. Decrypts the shards in any order into -o, and fails if a shard is missing.
+	--verify-shard file
+		Repeated for every shard. Checks the MACs and that no shard is missing, without decrypting.
+
+	--agent socket
+		Run as an agent listening on the UNIX domain socket, until killed.
+		The KDF runs once at startup and the derived keys are kept in locked memory.
+		Clients pass their input and output files to the agent, the files use the --batch format.
+		Decrypting a file with another salt runs the KDF once more, its keys are kept too.
+	--connect socket
+		Send the -i and -o files to the agent listening on the socket, and wait for the result.
+		The agent's KDF, cipher, MAC and threads are used, the other options are ignored.
+
 NOTES
 	Do not use pipeline when decrypting. This is due to having to begin streaming output before the authentication tag could be validated.
 	assert(input size < 2^64 byte)
@@ -80,6 +182,25 @@ EXAMPLES
 	Encrypt and decrypt file. The password is in the password.txt:
 		encrypt -e -i plaintext.txt -o ciphertext.txt -p password.txt
 		encrypt -d -i ciphertext.txt -o plaintext.txt -p password.txt
+
+	Encrypt and decrypt directory:
+		encrypt -e --batch plaintext -o ciphertext -p password.txt
+		encrypt -d --batch ciphertext -o plaintext -p password.txt
+
+	Encrypt a file over two disks and decrypt it:
+		encrypt -e -i plaintext.txt --volume /mnt/a/ciphertext.0 --volume /mnt/b/ciphertext.1 -t 4 -p password.txt
+		encrypt -d --volume /mnt/a/ciphertext.0 --volume /mnt/b/ciphertext.1 -o plaintext.txt -t 4 -p password.txt
+
+	Encrypt a file as two shards on two machines sharing the file, and merge them:
+		head -c 32 /dev/urandom > salt
+		encrypt -e -i plaintext.txt -o ciphertext.0 --range 0,1G --salt salt -p password.txt
+		encrypt -e -i plaintext.txt -o ciphertext.1 --range 1G,1G --salt salt -p password.txt
+		encrypt -d --shard ciphertext.0 --shard ciphertext.1 -o plaintext.txt -p password.txt
+
+	Run an agent and use it from another shell:
+		encrypt --agent /tmp/encrypt.sock -p password.txt
+		encrypt -e --connect /tmp/encrypt.sock -i plaintext.txt -o ciphertext.txt
+		encrypt -d --connect /tmp/encrypt.sock -i ciphertext.txt -o plaintext.txt
 )";
 
 namespace
@@ -88,12 +209,13 @@ namespace
 	{
 		encrypt,
 		decrypt,
+		agent,
 		help,
 	};
 
 	struct option
 	{
-		option() : cmd(command::help), input(nullptr), output(nullptr), algorithm(libencrypt::kdf_algorithm::argon2id), time_cost(1), memory_cost(1 << 21), parallelism(4), cipher_list{ libencrypt::cipher_algorithm::chacha20 }, mac_list{ libencrypt::mac_algorithm::poly1305 }, threads(4) {}
+		option() : cmd(command::help), input(nullptr), output(nullptr), algorithm(libencrypt::kdf_algorithm::argon2id), time_cost(1), memory_cost(1 << 21), parallelism(4), cipher_list{ libencrypt::cipher_algorithm::chacha20 }, mac_list{ libencrypt::mac_algorithm::poly1305 }, threads(4), has_range(false), offset(0), length(0) {}
 		option(option&&) = default;
 
 		~option()
@@ -117,8 +239,26 @@ namespace
 		std::vector<libencrypt::cipher_algorithm> cipher_list;
 		std::vector<libencrypt::mac_algorithm> mac_list;
 		int threads;
+		libencrypt::pipeline_option pipeline;
+		libencrypt::digest_option digest;
+		std::vector<std::string> digest_names;
+		std::filesystem::path input_path;
+		std::filesystem::path output_path;
+		std::filesystem::path batch;
+		std::filesystem::path agent;
+		std::filesystem::path connect;
+		std::vector<std::filesystem::path> volumes;
+		std::vector<std::filesystem::path> verify_volumes;
+		bool has_range;
+		libencrypt::uint64_t offset;
+		libencrypt::uint64_t length;
+		std::vector<char> salt;
+		std::vector<std::filesystem::path> shards;
+		std::vector<std::filesystem::path> verify_shards;
 	};
 
+	using file_ptr = std::unique_ptr<std::FILE, int(*)(std::FILE*)>;
+
 	//-------------------------------------------------------------------------------------------------
 
 	std::vector<char> read_file(const std::filesystem::path& path)
@@ -223,6 +363,16 @@ namespace
 				return libencrypt::mac_algorithm::hmac_sha512;
 			else if (algorithm == "poly1305")
 				return libencrypt::mac_algorithm::poly1305;
+			else if (algorithm == "blake2bp")
+				return libencrypt::mac_algorithm::blake2bp;
+			else if (algorithm == "blake2sp")
+				return libencrypt::mac_algorithm::blake2sp;
+			else if (algorithm == "blake3")
+				return libencrypt::mac_algorithm::blake3;
+			else if (algorithm == "kmac256")
+				return libencrypt::mac_algorithm::kmac256;
+			else if (algorithm == "parallelhash256")
+				return libencrypt::mac_algorithm::parallelhash256;
 			else
 				throw std::invalid_argument("unknown MAC algorithm");
 		};
@@ -236,6 +386,100 @@ namespace
 		}
 	}
 
+	void add_argument_digest(const std::string& arg, libencrypt::digest_option& digest)
+	{
+		auto [target, algorithm] = split<1>(arg, ":");
+		libencrypt::hash_algorithm hash;
+		if (algorithm == "sha256")
+			hash = libencrypt::hash_algorithm::sha256;
+		else if (algorithm == "sha512")
+			hash = libencrypt::hash_algorithm::sha512;
+		else if (algorithm == "blake2b")
+			hash = libencrypt::hash_algorithm::blake2b;
+		else if (algorithm == "blake3")
+			hash = libencrypt::hash_algorithm::blake3;
+		else
+			throw std::invalid_argument("unknown hash algorithm");
+
+		if (target == "plaintext")
+			digest.plaintext.push_back(hash);
+		else if (target == "ciphertext")
+			digest.ciphertext.push_back(hash);
+		else
+			throw std::invalid_argument("unknown digest target");
+	}
+
+	//bytes with an optional K, M or G suffix
+	libencrypt::size_t stosize(const std::string& arg)
+	{
+		if (arg.empty())
+			throw std::invalid_argument("invalid size");
+
+		int shift = 0;
+		switch (arg.back())
+		{
+		case 'K':
+			shift = 10;
+			break;
+		case 'M':
+			shift = 20;
+			break;
+		case 'G':
+			shift = 30;
+			break;
+		}
+
+		auto size = string_to_integer<libencrypt::size_t>(shift ? arg.substr(0, arg.size() - 1) : arg);
+		if (!size || size > (std::numeric_limits<libencrypt::size_t>::max() >> shift))
+			throw std::out_of_range("invalid size");
+		return size << shift;
+	}
+
+	int get_argument_t(const std::string& arg)
+	{
+		if (arg != "auto")
+			return ::stoi(arg);
+
+		int cores = libencrypt::physical_cores();
+		if (!cores)
+			cores = static_cast<int>(std::thread::hardware_concurrency());
+		return cores ? cores : 4;
+	}
+
+	libencrypt::thread_affinity get_argument_affinity(const std::string& arg)
+	{
+		if (arg == "none")
+			return libencrypt::thread_affinity::none;
+		else if (arg == "cores")
+			return libencrypt::thread_affinity::physical_cores;
+		else if (arg == "cpus")
+			return libencrypt::thread_affinity::logical_cpus;
+		else
+			throw std::invalid_argument("unknown affinity mode");
+	}
+
+	bool get_argument_page_cache(const std::string& arg)
+	{
+		if (arg == "keep")
+			return false;
+		else if (arg == "drop")
+			return true;
+		else
+			throw std::invalid_argument("unknown page cache policy");
+	}
+
+	//offset,length, the offset may be zero
+	std::tuple<libencrypt::uint64_t, libencrypt::uint64_t> get_argument_range(const std::string& arg)
+	{
+		auto [offset, length] = split<1>(arg, ",");
+		return { offset == "0" ? 0 : stosize(offset), stosize(length) };
+	}
+
+	libencrypt::size_t get_argument_b(const std::string& arg)
+	{
+		return arg == "auto" ? 0 : stosize(arg);
+	}
+
 	std::FILE* get_argument_i(const std::string& arg)
 	{
 		std::FILE* p = std::fopen(arg.c_str(), "rb");
@@ -262,6 +506,8 @@ namespace
 			return command::encrypt;
 		else if (std::string(argv[1]) == "-d")
 			return command::decrypt;
+		else if (std::string(argv[1]) == "--agent")
+			return command::agent;
 		else if (std::string(argv[1]) == "-h")
 			return command::help;
 		else
@@ -270,9 +516,11 @@ namespace
 
 	void read_argument(int argc, char* argv[], option& opt)
 	{
-		if (argc % 2)
+		//--agent is both the command and an option
+		const int first = opt.cmd == command::agent ? 1 : 2;
+		if ((argc - first) % 2)
 			throw std::invalid_argument("missing arguments");
-		for (int i = 2; i < argc; i += 2)
+		for (int i = first; i < argc; i += 2)
 		{
 			std::string a = argv[i];
 			std::string b = argv[i + 1];
@@ -288,11 +536,45 @@ namespace
 			else if (a == "-s")
 				opt.key = read_file(b);
 			else if (a == "-t")
-				opt.threads = ::stoi(b);
+				opt.threads = get_argument_t(b);
+			else if (a == "-b")
+				opt.pipeline.chunk_size = get_argument_b(b);
+			else if (a == "--max-memory")
+				opt.pipeline.max_memory = stosize(b);
+			else if (a == "--affinity")
+				opt.pipeline.affinity = get_argument_affinity(b);
+			else if (a == "--page-cache")
+				opt.pipeline.drop_cache = get_argument_page_cache(b);
+			else if (a == "--digest")
+			{
+				add_argument_digest(b, opt.digest);
+				opt.digest_names.push_back(b);
+			}
 			else if (a == "-i")
-				opt.input = get_argument_i(b);
+				opt.input_path = b;
 			else if (a == "-o")
-				opt.output = get_argument_o(b);
+				opt.output_path = b;
+			else if (a == "--batch")
+				opt.batch = b;
+			else if (a == "--agent" && i == 1)
+				opt.agent = b;
+			else if (a == "--connect")
+				opt.connect = b;
+			else if (a == "--volume")
+				opt.volumes.push_back(b);
+			else if (a == "--verify-volume")
+				opt.verify_volumes.push_back(b);
+			else if (a == "--range")
+			{
+				std::tie(opt.offset, opt.length) = get_argument_range(b);
+				opt.has_range = true;
+			}
+			else if (a == "--salt")
+				opt.salt = read_file(b);
+			else if (a == "--shard")
+				opt.shards.push_back(b);
+			else if (a == "--verify-shard")
+				opt.verify_shards.push_back(b);
 			else
 				throw std::invalid_argument("unknown option");
 		}
@@ -306,19 +588,23 @@ namespace
 		return std::make_unique<libencrypt::argon2_parameter>(password, salt, key, opt.time_cost, opt.memory_cost, opt.parallelism);
 	}
 
-	FILE* get_input(FILE* file)
+	FILE* get_input(const std::filesystem::path& path)
 	{
-		if (!file)
-			file = std::freopen(nullptr, "rb", stdin);
+		if (!path.empty())
+			return get_argument_i(path.string());
+
+		FILE* file = std::freopen(nullptr, "rb", stdin);
 		if (!file)
 			throw std::runtime_error("reopen stdin error");
 		return file;
 	}
 
-	FILE* get_output(FILE* file)
+	FILE* get_output(const std::filesystem::path& path)
 	{
-		if (!file)
-			file = std::freopen(nullptr, "wb", stdout);
+		if (!path.empty())
+			return get_argument_o(path.string());
+
+		FILE* file = std::freopen(nullptr, "wb", stdout);
 		if (!file)
 			throw std::runtime_error("reopen stdout error");
 		return file;
@@ -332,12 +618,251 @@ namespace
 		{
 			read_argument(argc, argv, opt);
 			opt.parameter = make_kdf_parameter(opt);
-			opt.input = get_input(opt.input);
-			opt.output = get_output(opt.output);
+			if (!opt.digest_names.empty() && (opt.cmd != command::encrypt || !opt.batch.empty() || !opt.connect.empty() || !opt.volumes.empty() || opt.has_range))
+				throw std::invalid_argument("--digest needs -e and a single file");
+			if (opt.cmd == command::agent)
+			{
+				if (!opt.input_path.empty() || !opt.output_path.empty() || !opt.batch.empty() || !opt.connect.empty() || !opt.volumes.empty() || !opt.verify_volumes.empty() || opt.has_range || !opt.shards.empty() || !opt.verify_shards.empty())
+					throw std::invalid_argument("--agent doesn't take -i, -o, --batch, --connect, volumes or shards");
+				return opt;
+			}
+			if (opt.has_range != !opt.salt.empty())
+				throw std::invalid_argument("--range and --salt go together");
+			if (!opt.verify_shards.empty())
+			{
+				if (opt.cmd != command::decrypt || !opt.input_path.empty() || !opt.output_path.empty() || !opt.batch.empty() || !opt.connect.empty() || !opt.volumes.empty() || !opt.verify_volumes.empty() || !opt.shards.empty())
+					throw std::invalid_argument("--verify-shard needs -d and no other files");
+				return opt;
+			}
+			if (!opt.shards.empty())
+			{
+				if (opt.cmd != command::decrypt || !opt.input_path.empty() || !opt.batch.empty() || !opt.connect.empty() || !opt.volumes.empty() || !opt.verify_volumes.empty())
+					throw std::invalid_argument("--shard needs -d and replaces -i, and doesn't take --batch, --connect or volumes");
+				opt.output = get_output(opt.output_path);
+				return opt;
+			}
+			if (opt.has_range)
+			{
+				if (opt.cmd != command::encrypt || opt.input_path.empty() || !opt.batch.empty() || !opt.connect.empty() || !opt.volumes.empty() || !opt.verify_volumes.empty())
+					throw std::invalid_argument("--range needs -e and -i file, and doesn't take --batch, --connect or volumes");
+				opt.input = get_input(opt.input_path);
+				opt.output = get_output(opt.output_path);
+				return opt;
+			}
+			if (!opt.verify_volumes.empty())
+			{
+				if (opt.cmd != command::decrypt || !opt.input_path.empty() || !opt.output_path.empty() || !opt.batch.empty() || !opt.connect.empty() || !opt.volumes.empty())
+					throw std::invalid_argument("--verify-volume needs -d and no other files");
+				return opt;
+			}
+			if (!opt.volumes.empty())
+			{
+				if (!opt.batch.empty() || !opt.connect.empty() || !(opt.cmd == command::encrypt ? opt.output_path : opt.input_path).empty())
+					throw std::invalid_argument("--volume replaces -o when encrypting and -i when decrypting, and doesn't take --batch or --connect");
+				if (opt.cmd == command::encrypt)
+					opt.input = get_input(opt.input_path);
+				else
+					opt.output = get_output(opt.output_path);
+				return opt;
+			}
+			if (!opt.batch.empty())
+			{
+				if (!opt.input_path.empty() || opt.output_path.empty() || !opt.connect.empty())
+					throw std::invalid_argument("--batch needs -o directory and no -i or --connect");
+				return opt;
+			}
+			opt.input = get_input(opt.input_path);
+			opt.output = get_output(opt.output_path);
 		}
 
 		return opt;
 	}
+
+	//-------------------------------------------------------------------------------------------------
+
+	std::vector<std::filesystem::path> list_files(const std::filesystem::path& directory)
+	{
+		std::vector<std::filesystem::path> files;
+		for (const auto& i : std::filesystem::recursive_directory_iterator(directory))
+			if (i.is_regular_file())
+				files.push_back(std::filesystem::relative(i.path(), directory));
+		return files;
+	}
+
+	file_ptr open_file(const std::filesystem::path& path, const char* mode)
+	{
+		file_ptr file(std::fopen(path.string().c_str(), mode), std::fclose);
+		if (!file)
+			throw std::runtime_error("open file error: " + path.string());
+		return file;
+	}
+
+	class batch_key_cache
+	{
+	public:
+		batch_key_cache(option& opt) noexcept : opt(opt) {}
+
+		const libencrypt::batch_key& get(libencrypt::const_array salt)
+		{
+			std::scoped_lock lock(this->mutex);
+			auto& key = this->keys[std::string(salt.data, salt.data + salt.length)];
+			if (!key)
+			{
+				this->opt.parameter->salt = salt;
+				key = std::make_unique<libencrypt::batch_key>(this->opt.algorithm, *this->opt.parameter);
+				this->opt.parameter->salt = {};
+			}
+			return *key;
+		}
+
+	private:
+		option& opt;
+		std::mutex mutex;
+		std::map<std::string, std::unique_ptr<libencrypt::batch_key>> keys;
+	};
+
+	void run_batch(option& opt)
+	{
+		if (opt.threads <= 0)
+			throw std::invalid_argument("number of threads must be greater than zero");
+
+		const auto files = list_files(opt.batch);
+		std::unique_ptr<libencrypt::batch_key> key;
+		batch_key_cache cache(opt);
+		if (opt.cmd == command::encrypt)
+			key = std::make_unique<libencrypt::batch_key>(opt.algorithm, *opt.parameter);
+
+		std::atomic<std::size_t> next = 0;
+		std::atomic_bool good = true;
+		auto f = [&]()
+		{
+			for (std::size_t i = next++; good && i < files.size(); i = next++)
+			{
+				try
+				{
+					file_ptr input = open_file(opt.batch / files[i], "rb");
+					std::filesystem::create_directories((opt.output_path / files[i]).parent_path());
+					file_ptr output = open_file(opt.output_path / files[i], "wb");
+					if (opt.cmd == command::encrypt)
+						libencrypt::batch_encrypt(input.get(), output.get(), *key, opt.cipher_list, opt.mac_list, 1, opt.pipeline);
+					else
+					{
+						auto get_key = [&cache](libencrypt::const_array salt) -> const libencrypt::batch_key& { return cache.get(salt); };
+						libencrypt::batch_decrypt(input.get(), output.get(), get_key, opt.cipher_list, opt.mac_list, 1, opt.pipeline);
+					}
+				}
+				catch (...)
+				{
+					good = false;
+					throw;
+				}
+			}
+		};
+
+		std::vector<std::future<void>> vec(std::min<std::size_t>(opt.threads, files.size()));
+		try
+		{
+			for (auto& i : vec)
+				i = utils::thread_pool::global().async(f);
+		}
+		catch (...)
+		{
+			good = false;
+			for (const auto& i : vec)
+				if (i.valid())
+					i.wait();
+			throw;
+		}
+
+		for (const auto& i : vec)
+			i.wait();
+		for (auto& i : vec)
+			i.get();
+	}
+
+	void run_striped(option& opt)
+	{
+		std::vector<file_ptr> files;
+		std::vector<std::FILE*> volumes;
+		for (const auto& i : opt.volumes)
+		{
+			files.push_back(open_file(i, opt.cmd == command::encrypt ? "wb" : "rb"));
+			volumes.push_back(files.back().get());
+		}
+
+		if (opt.cmd == command::encrypt)
+		{
+			libencrypt::batch_key key(opt.algorithm, *opt.parameter);
+			libencrypt::striped_encrypt(opt.input, volumes, key, opt.cipher_list, opt.mac_list, opt.threads, opt.pipeline);
+		}
+		else
+		{
+			batch_key_cache cache(opt);
+			auto get_key = [&cache](libencrypt::const_array salt) -> const libencrypt::batch_key& { return cache.get(salt); };
+			libencrypt::striped_decrypt(volumes, opt.output, get_key, opt.cipher_list, opt.mac_list, opt.threads, opt.pipeline);
+		}
+
+		for (auto& i : files)
+			if (std::fclose(i.release()))
+				throw std::runtime_error("close volume error");
+	}
+
+	void run_verify(option& opt)
+	{
+		batch_key_cache cache(opt);
+		auto get_key = [&cache](libencrypt::const_array salt) -> const libencrypt::batch_key& { return cache.get(salt); };
+		for (const auto& i : opt.verify_volumes)
+		{
+			file_ptr volume = open_file(i, "rb");
+			const auto index = libencrypt::verify_volume(volume.get(), get_key, opt.cipher_list, opt.mac_list);
+			std::cout << i.string() << ": volume " << index << " OK\n";
+		}
+	}
+
+	void print_digest(const option& opt, const libencrypt::digest_result& result)
+	{
+		constexpr char hex[] = "0123456789abcdef";
+		std::size_t plaintext = 0, ciphertext = 0;
+		for (const auto& i : opt.digest_names)
+		{
+			auto [target, algorithm] = split<1>(i, ":");
+			const auto& digest = target == "plaintext" ? result.plaintext[plaintext++] : result.ciphertext[ciphertext++];
+			std::string str;
+			for (const auto& j : digest)
+				str += { hex[j >> 4], hex[j & 15] };
+			std::cerr << target << ' ' << algorithm << ' ' << str << '\n';
+		}
+	}
+
+	void run_shard(option& opt)
+	{
+		opt.parameter->salt = { reinterpret_cast<const libencrypt::byte*>(opt.salt.data()), opt.salt.size() };
+		libencrypt::batch_key key(opt.algorithm, *opt.parameter);
+		opt.parameter->salt = {};
+		libencrypt::shard_encrypt(opt.input, opt.output, opt.offset, opt.length, key, opt.cipher_list, opt.mac_list, opt.threads, opt.pipeline);
+	}
+
+	void run_merge(option& opt)
+	{
+		const auto& paths = opt.shards.empty() ? opt.verify_shards : opt.shards;
+		std::vector<file_ptr> files;
+		std::vector<std::FILE*> shards;
+		for (const auto& i : paths)
+		{
+			files.push_back(open_file(i, "rb"));
+			shards.push_back(files.back().get());
+		}
+
+		batch_key_cache cache(opt);
+		auto get_key = [&cache](libencrypt::const_array salt) -> const libencrypt::batch_key& { return cache.get(salt); };
+		if (opt.shards.empty())
+		{
+			libencrypt::verify_shards(shards, get_key, opt.cipher_list, opt.mac_list);
+			std::cout << shards.size() << " shards OK\n";
+		}
+		else
+			libencrypt::merge_shards(shards, opt.output, get_key, opt.cipher_list, opt.mac_list, opt.threads, opt.pipeline);
+	}
 }
 
 int main(int argc, char* argv[])
@@ -345,10 +870,26 @@ int main(int argc, char* argv[])
 	try
 	{
 		option opt = get_option(argc, argv);
-		if (opt.cmd == command::encrypt)
-			libencrypt::encrypt(opt.input, opt.output, opt.algorithm, *opt.parameter, opt.cipher_list, opt.mac_list, opt.threads);
+		if (opt.cmd == command::agent)
+			agent::serve(opt.agent, opt.algorithm, *opt.parameter, opt.cipher_list, opt.mac_list, opt.threads, opt.pipeline);
+		else if (!opt.batch.empty())
+			run_batch(opt);
+		else if (!opt.volumes.empty())
+			run_striped(opt);
+		else if (!opt.verify_volumes.empty())
+			run_verify(opt);
+		else if (opt.has_range)
+			run_shard(opt);
+		else if (!opt.shards.empty() || !opt.verify_shards.empty())
+			run_merge(opt);
+		else if (!opt.connect.empty())
+			agent::submit(opt.connect, opt.cmd == command::encrypt ? agent::request::encrypt : agent::request::decrypt, opt.input, opt.output);
+		else if (opt.cmd == command::encrypt && !opt.digest_names.empty())
+			print_digest(opt, libencrypt::encrypt(fileno(opt.input), fileno(opt.output), opt.algorithm, *opt.parameter, opt.cipher_list, opt.mac_list, opt.threads, opt.digest, opt.pipeline));
+		else if (opt.cmd == command::encrypt)
+			libencrypt::encrypt(fileno(opt.input), fileno(opt.output), opt.algorithm, *opt.parameter, opt.cipher_list, opt.mac_list, opt.threads, opt.pipeline);
 		else if (opt.cmd == command::decrypt)
-			libencrypt::decrypt(opt.input, opt.output, opt.algorithm, *opt.parameter, opt.cipher_list, opt.mac_list, opt.threads);
+			libencrypt::decrypt(fileno(opt.input), fileno(opt.output), opt.algorithm, *opt.parameter, opt.cipher_list, opt.mac_list, opt.threads, opt.pipeline);
 		else if (opt.cmd == command::help)
 			std::cout << help << '\n';
 	}
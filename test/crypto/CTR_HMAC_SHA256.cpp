@@ -0,0 +1,78 @@
+#include<iostream>
+#include<algorithm>
+#include<exception>
+#include<vector>
+#include<crypto/CTR_HMAC_SHA256.h>
+
+//the stitched pass must match CTR mode followed by HMAC-SHA256 of the ciphertext. the counter starts 3 blocks before
+//the low 64 bits wrap, and the MAC also starts inside a block, which takes the path without the kernel
+template<typename Cipher>
+void test_ctr_hmac_sha256(const char* str)
+{
+	using crypto::cipher::CTR;
+	using crypto::cipher::CTR_HMAC_SHA256;
+	using crypto::MAC::HMAC;
+	using crypto::hash::SHA256;
+
+	unsigned char key[32], mac_key[32], counter[16];
+	for (int i = 0; i < 32; i++)
+	{
+		key[i] = static_cast<unsigned char>(i * 7 + 1);
+		mac_key[i] = static_cast<unsigned char>(i * 13 + 5);
+	}
+	for (int i = 0; i < 16; i++)
+		counter[i] = i < 8 ? static_cast<unsigned char>(i) : 0xff;
+	counter[15] = 0xfd;
+
+	for (size_t length : { 0, 64, 128, 192, 4096, 65536 + 64 * 3 })
+		for (size_t prefix : { 0, 3 })
+		{
+			std::vector<unsigned char> plaintext(length), expected(length), data(length);
+			for (size_t i = 0; i < length; i++)
+				plaintext[i] = static_cast<unsigned char>(i % 251);
+
+			unsigned char expected_tag[32], tag[32];
+			typename CTR<Cipher>::encryption ctr(key, counter);
+			HMAC<SHA256> hmac(mac_key, 32);
+			hmac.update(mac_key, prefix);
+			for (size_t i = 0; i < length; i += 16)
+				ctr.encrypt(plaintext.data() + i, expected.data() + i);
+			hmac.update(expected.data(), length);
+			hmac.final(expected_tag);
+
+			typename CTR<Cipher>::encryption stitched_ctr(key, counter);
+			HMAC<SHA256> stitched_hmac(mac_key, 32);
+			stitched_hmac.update(mac_key, prefix);
+			data = plaintext;
+			CTR_HMAC_SHA256<Cipher>::encrypt(stitched_ctr, stitched_hmac, data.data(), length / 2 / 64 * 64);
+			CTR_HMAC_SHA256<Cipher>::encrypt(stitched_ctr, stitched_hmac, data.data() + length / 2 / 64 * 64, length - length / 2 / 64 * 64);
+			stitched_hmac.final(tag);
+			if (data != expected || !std::equal(tag, tag + 32, expected_tag))
+			{
+				std::cerr << str;
+				std::terminate();
+			}
+
+			typename CTR<Cipher>::encryption decrypt_ctr(key, counter);
+			HMAC<SHA256> decrypt_hmac(mac_key, 32);
+			decrypt_hmac.update(mac_key, prefix);
+			CTR_HMAC_SHA256<Cipher>::decrypt(decrypt_ctr, decrypt_hmac, data.data(), length);
+			decrypt_hmac.final(tag);
+			if (data != plaintext || !std::equal(tag, tag + 32, expected_tag))
+			{
+				std::cerr << str;
+				std::terminate();
+			}
+		}
+}
+
+int main()
+{
+	using namespace crypto::cipher;
+
+	test_ctr_hmac_sha256<AES_128>("AES-128-CTR HMAC-SHA256 fail\n");
+	test_ctr_hmac_sha256<AES_192>("AES-192-CTR HMAC-SHA256 fail\n");
+	test_ctr_hmac_sha256<AES_256>("AES-256-CTR HMAC-SHA256 fail\n");
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+#include<iostream>
+#include<algorithm>
+#include<exception>
+#include<crypto/HKDF.h>
+#include<crypto/SHA.h>
+#include"HKDF_test_vector.h"
+
+template<typename Hash, int N>
+void test_HKDF(const HKDF_test_vector (&array)[N], const char* str)
+{
+	for (int i = 0; i < N; i++)
+	{
+		using crypto::KDF::HKDF;
+		unsigned char okm[100];
+		utils::const_array ikm = { array[i].ikm, static_cast<utils::size_t>(array[i].ikm_length) };
+		utils::const_array salt = { array[i].salt, static_cast<utils::size_t>(array[i].salt_length) };
+		utils::const_array info = { array[i].info, static_cast<utils::size_t>(array[i].info_length) };
+		HKDF<Hash>::derive(salt, ikm, info, { okm, static_cast<utils::size_t>(array[i].okm_length) });
+		if (!std::equal(okm, okm + array[i].okm_length, array[i].okm))
+		{
+			std::cerr << str;
+			std::terminate();
+		}
+	}
+}
+
+int main()
+{
+	using namespace crypto::hash;
+
+	test_HKDF<SHA256>(hkdf_sha256_vector1, "HKDF_SHA256 fail\n");
+	test_HKDF<SHA1>(hkdf_sha1_vector1, "HKDF_SHA1 fail\n");
+
+	return 0;
+}
\ No newline at end of file
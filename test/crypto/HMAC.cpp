@@ -18,6 +18,24 @@ void test_HMAC(const HMAC_test_vector (&array)[N], const char* str)
 			std::cerr << str;
 			std::terminate();
 		}
+
+		//one prepared key starts two messages on the same object
+		const typename HMAC<Hash>::prepared_key key(array[i].key, array[i].key_length);
+		HMAC<Hash> hmac(key);
+		hmac.update(array[i].message, array[i].length / 2);
+		hmac.final(digest);
+		for (int j = 0; j < 2; j++)
+		{
+			hmac.init(key);
+			hmac.update(array[i].message, array[i].length / 2);
+			hmac.update(array[i].message + array[i].length / 2, array[i].length - array[i].length / 2);
+			hmac.final(digest);
+			if (!std::equal(digest, digest + HMAC<Hash>::output_size, array[i].digest))
+			{
+				std::cerr << str;
+				std::terminate();
+			}
+		}
 	}
 }
 
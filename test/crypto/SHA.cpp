@@ -19,6 +19,79 @@ void test_sha(const SHA_test_vector (&array)[N], const char* str)
 	}
 }
 
+//fed in pieces that are not a multiple of the block size
+template<typename Hash, int N>
+void test_million_a(const unsigned char (&expected)[N], const char* str)
+{
+	unsigned char piece[1000];
+	std::fill(piece, piece + sizeof(piece), 'a');
+	Hash hash;
+	for (int i = 0; i < 1000; i++)
+		hash.update(piece, sizeof(piece));
+
+	unsigned char digest[64];
+	hash.final(digest);
+	if (!std::equal(digest, digest + N, expected))
+	{
+		std::cerr << str;
+		std::terminate();
+	}
+}
+
+//every lane count and message lengths around the block boundaries, checked against SHA256
+void test_sha256_multi()
+{
+	using namespace crypto::hash;
+
+	unsigned char message[40][300];
+	const unsigned char* input[40];
+	size_t length[40];
+	unsigned char digest[40][32];
+	unsigned char* output[40];
+	for (int i = 0; i < 40; i++)
+	{
+		for (int j = 0; j < 300; j++)
+			message[i][j] = static_cast<unsigned char>(i * 31 + j * 7);
+		input[i] = message[i];
+		length[i] = (i * 37) % 300;
+		output[i] = digest[i];
+	}
+
+	for (int lanes = 1; lanes <= SHA256_multi::max_lanes; lanes++)
+		for (size_t n : { 0, 1, 55, 56, 63, 64, 65, 200 })
+		{
+			SHA256_multi multi(lanes);
+			multi.update(input, n / 3);
+			multi.update(input, n - n / 3);
+			multi.final(output);
+			for (int i = 0; i < lanes; i++)
+			{
+				unsigned char expected[32];
+				SHA256 hash;
+				hash.update(input[i], n / 3);
+				hash.update(input[i], n - n / 3);
+				hash.final(expected);
+				if (!std::equal(expected, expected + 32, digest[i]))
+				{
+					std::cerr << "SHA256_multi fail\n";
+					std::terminate();
+				}
+			}
+		}
+
+	SHA256_multi::hash(40, input, length, output);
+	for (int i = 0; i < 40; i++)
+	{
+		unsigned char expected[32];
+		SHA256(input[i], length[i], expected);
+		if (!std::equal(expected, expected + 32, digest[i]))
+		{
+			std::cerr << "SHA256_multi fail\n";
+			std::terminate();
+		}
+	}
+}
+
 int main()
 {
 	using namespace crypto::hash;
@@ -38,5 +111,13 @@ int main()
 	test_sha<SHA512_256>(sha512_256_vector1, "SHA512_256 fail\n");
 	test_sha<SHA512_256>(sha512_256_vector2, "SHA512_256 fail\n");
 
+	test_million_a<SHA1>(sha1_million_a, "SHA1 fail\n");
+	test_million_a<SHA224>(sha224_million_a, "SHA224 fail\n");
+	test_million_a<SHA256>(sha256_million_a, "SHA256 fail\n");
+	test_million_a<SHA384>(sha384_million_a, "SHA384 fail\n");
+	test_million_a<SHA512>(sha512_million_a, "SHA512 fail\n");
+
+	test_sha256_multi();
+
 	return 0;
 }
\ No newline at end of file
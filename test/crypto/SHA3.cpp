@@ -0,0 +1,114 @@
+#include<iostream>
+#include<algorithm>
+#include<cstring>
+#include<exception>
+#include<vector>
+#include<crypto/SHA3.h>
+#include"SHA3_test_vector.h"
+
+void check(const unsigned char* expected, const unsigned char* output, size_t length, const char* str)
+{
+	if (!std::equal(expected, expected + length, output))
+	{
+		std::cerr << str;
+		std::terminate();
+	}
+}
+
+//the message is also split so that the first piece ends inside a block
+template<int N>
+void test_SHA3(const SHA3_test_vector (&array)[N])
+{
+	std::vector<unsigned char> message(4096);
+	for (size_t i = 0; i < message.size(); i++)
+		message[i] = static_cast<unsigned char>(i % 251);
+
+	for (int i = 0; i < N; i++)
+	{
+		const int length = array[i].length;
+		unsigned char digest[200];
+		crypto::hash::SHA3_256(message.data(), length, digest);
+		check(array[i].sha3_256, digest, 32, "SHA3-256 fail\n");
+		crypto::hash::SHA3_512(message.data(), length, digest);
+		check(array[i].sha3_512, digest, 64, "SHA3-512 fail\n");
+
+		//the output is squeezed in two pieces
+		crypto::hash::SHAKE256 shake;
+		shake.update(message.data(), length / 3);
+		shake.update(message.data() + length / 3, length - length / 3);
+		shake.final(digest, 77);
+		shake.final(digest + 77, 123);
+		check(array[i].shake256, digest, 200, "SHAKE256 fail\n");
+	}
+}
+
+template<int N>
+void test_KMAC256(const KMAC256_test_vector (&array)[N])
+{
+	unsigned char message[200], key[32];
+	for (int i = 0; i < 200; i++)
+		message[i] = static_cast<unsigned char>(i);
+	for (int i = 0; i < 32; i++)
+		key[i] = static_cast<unsigned char>(0x40 + i);
+
+	for (int i = 0; i < N; i++)
+	{
+		const auto S = reinterpret_cast<const unsigned char*>(array[i].S);
+		unsigned char output[64];
+		crypto::MAC::KMAC256(key, 32, message, array[i].length, output, 64, S, std::strlen(array[i].S));
+		check(array[i].output, output, 64, "KMAC256 fail\n");
+
+		crypto::MAC::KMAC256 mac(64, S, std::strlen(array[i].S));
+		mac.init(key, 32);
+		mac.update(message, array[i].length / 3);
+		mac.update(message + array[i].length / 3, array[i].length - array[i].length / 3);
+		mac.final(output);
+		check(array[i].output, output, 64, "KMAC256 fail\n");
+	}
+}
+
+//the leaves of whole blocks are hashed apart from the rest, so the message is also fed in pieces that cross blocks
+//and as pieces of leaves hashed last to first before they are taken in order
+template<int N>
+void test_ParallelHash256(const ParallelHash256_test_vector (&array)[N])
+{
+	std::vector<unsigned char> message(81925);
+	for (size_t i = 0; i < message.size(); i++)
+		message[i] = static_cast<unsigned char>(i / 8 * 16 + i % 8);
+
+	for (int i = 0; i < N; i++)
+	{
+		const int length = array[i].length, block_size = array[i].block_size, output_size = array[i].output_size;
+		const auto S = reinterpret_cast<const unsigned char*>(array[i].S);
+		const size_t S_length = std::strlen(array[i].S);
+		unsigned char output[64];
+		crypto::hash::ParallelHash256(block_size, message.data(), length, output, output_size, S, S_length);
+		check(array[i].output, output, output_size, "ParallelHash256 fail\n");
+
+		crypto::hash::ParallelHash256 hash(block_size, output_size, S, S_length);
+		for (int offset = 0, piece = block_size / 2 + 3; offset < length; offset += piece, piece = piece * 3 % 1000 + 1)
+			hash.update(message.data() + offset, std::min(piece, length - offset));
+		hash.final(output);
+		check(array[i].output, output, output_size, "ParallelHash256 pieces fail\n");
+
+		const int piece = block_size * 5;
+		crypto::hash::ParallelHash256 parallel(block_size, output_size, S, S_length);
+		std::vector<crypto::hash::ParallelHash256::leaves> pieces;
+		pieces.reserve(length / piece + 1);
+		for (int offset = length / piece * piece; offset >= 0; offset -= piece)
+			pieces.emplace_back(parallel, message.data() + offset, std::min(piece, length - offset), offset);
+		for (auto it = pieces.rbegin(); it != pieces.rend(); ++it)
+			parallel.update(*it);
+		parallel.final(output);
+		check(array[i].output, output, output_size, "ParallelHash256 leaves fail\n");
+	}
+}
+
+int main()
+{
+	test_SHA3(SHA3_vector);
+	test_KMAC256(KMAC256_vector);
+	test_ParallelHash256(ParallelHash256_vector);
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#ifndef SHA3_test_vector_h
+#define SHA3_test_vector_h
+
+struct SHA3_test_vector
+{
+	int length;
+	unsigned char sha3_256[32];
+	unsigned char sha3_512[64];
+	unsigned char shake256[200];
+};
+
+struct KMAC256_test_vector
+{
+	int length;
+	const char* S;
+	unsigned char output[64];
+};
+
+struct ParallelHash256_test_vector
+{
+	int length;
+	int block_size;
+	const char* S;
+	int output_size;
+	unsigned char output[64];
+};
+
+//hashlib of Python, message[i] = i % 251
+
+constexpr SHA3_test_vector SHA3_vector[9] = {
+	{ 0, { 0xa7, 0xff, 0xc6, 0xf8, 0xbf, 0x1e, 0xd7, 0x66, 0x51, 0xc1, 0x47, 0x56, 0xa0, 0x61, 0xd6, 0x62, 0xf5, 0x80, 0xff, 0x4d, 0xe4, 0x3b, 0x49, 0xfa, 0x82, 0xd8, 0x0a, 0x4b, 0x80, 0xf8, 0x43, 0x4a }, { 0xa6, 0x9f, 0x73, 0xcc, 0xa2, 0x3a, 0x9a, 0xc5, 0xc8, 0xb5, 0x67, 0xdc, 0x18, 0x5a, 0x75, 0x6e, 0x97, 0xc9, 0x82, 0x16, 0x4f, 0xe2, 0x58, 0x59, 0xe0, 0xd1, 0xdc, 0xc1, 0x47, 0x5c, 0x80, 0xa6, 0x15, 0xb2, 0x12, 0x3a, 0xf1, 0xf5, 0xf9, 0x4c, 0x11, 0xe3, 0xe9, 0x40, 0x2c, 0x3a, 0xc5, 0x58, 0xf5, 0x00, 0x19, 0x9d, 0x95, 0xb6, 0xd3, 0xe3, 0x01, 0x75, 0x85, 0x86, 0x28, 0x1d, 0xcd, 0x26 }, { 0x46, 0xb9, 0xdd, 0x2b, 0x0b, 0xa8, 0x8d, 0x13, 0x23, 0x3b, 0x3f, 0xeb, 0x74, 0x3e, 0xeb, 0x24, 0x3f, 0xcd, 0x52, 0xea, 0x62, 0xb8, 0x1b, 0x82, 0xb5, 0x0c, 0x27, 0x64, 0x6e, 0xd5, 0x76, 0x2f, 0xd7, 0x5d, 0xc4, 0xdd, 0xd8, 0xc0, 0xf2, 0x00, 0xcb, 0x05, 0x01, 0x9d, 0x67, 0xb5, 0x92, 0xf6, 0xfc, 0x82, 0x1c, 0x49, 0x47, 0x9a, 0xb4, 0x86, 0x40, 0x29, 0x2e, 0xac, 0xb3, 0xb7, 0xc4, 0xbe, 0x14, 0x1e, 0x96, 0x61, 0x6f, 0xb1, 0x39, 0x57, 0x69, 0x2c, 0xc7, 0xed, 0xd0, 0xb4, 0x5a, 0xe3, 0xdc, 0x07, 0x22, 0x3c, 0x8e, 0x92, 0x93, 0x7b, 0xef, 0x84, 0xbc, 0x0e, 0xab, 0x86, 0x28, 0x53, 0x34, 0x9e, 0xc7, 0x55, 0x46, 0xf5, 0x8f, 0xb7, 0xc2, 0x77, 0x5c, 0x38, 0x46, 0x2c, 0x50, 0x10, 0xd8, 0x46, 0xc1, 0x85, 0xc1, 0x51, 0x11, 0xe5, 0x95, 0x52, 0x2a, 0x6b, 0xcd, 0x16, 0xcf, 0x86, 0xf3, 0xd1, 0x22, 0x10, 0x9e, 0x3b, 0x1f, 0xdd, 0x94, 0x3b, 0x6a, 0xec, 0x46, 0x8a, 0x2d, 0x62, 0x1a, 0x7c, 0x06, 0xc6, 0xa9, 0x57, 0xc6, 0x2b, 0x54, 0xda, 0xfc, 0x3b, 0xe8, 0x75, 0x67, 0xd6, 0x77, 0x23, 0x13, 0x95, 0xf6, 0x14, 0x72, 0x93, 0xb6, 0x8c, 0xea, 0xb7, 0xa9, 0xe0, 0xc5, 0x8d, 0x86, 0x4e, 0x8e, 0xfd, 0xe4, 0xe1, 0xb9, 0xa4, 0x6c, 0xbe, 0x85, 0x47, 0x13, 0x67, 0x2f, 0x5c, 0xaa, 0xae, 0x31, 0x4e, 0xd9, 0x08, 0x3d, 0xab } },
+	{ 1, { 0x5d, 0x53, 0x46, 0x9f, 0x20, 0xfe, 0xf4, 0xf8, 0xea, 0xb5, 0x2b, 0x88, 0x04, 0x4e, 0xde, 0x69, 0xc7, 0x7a, 0x6a, 0x68, 0xa6, 0x07, 0x28, 0x60, 0x9f, 0xc4, 0xa6, 0x5f, 0xf5, 0x31, 0xe7, 0xd0 }, { 0x71, 0x27, 0xaa, 0xb2, 0x11, 0xf8, 0x2a, 0x18, 0xd0, 0x6c, 0xf7, 0x57, 0x8f, 0xf4, 0x9d, 0x50, 0x89, 0x01, 0x79, 0x44, 0x13, 0x9a, 0xa6, 0x0d, 0x8b, 0xee, 0x05, 0x78, 0x11, 0xa1, 0x5f, 0xb5, 0x5a, 0x53, 0x88, 0x76, 0x00, 0xa3, 0xec, 0xeb, 0xa0, 0x04, 0xde, 0x51, 0x10, 0x51, 0x39, 0xf3, 0x25, 0x06, 0xfe, 0x5b, 0x53, 0xe1, 0x91, 0x3b, 0xfa, 0x6b, 0x32, 0xe7, 0x16, 0xfe, 0x97, 0xda }, { 0xb8, 0xd0, 0x1d, 0xf8, 0x55, 0xf7, 0x07, 0x58, 0x82, 0xc6, 0x36, 0xf6, 0xdd, 0xea, 0xcf, 0x41, 0xe5, 0xde, 0x0b, 0xbf, 0x30, 0x04, 0x2e, 0xf0, 0xa8, 0x6e, 0x36, 0xf4, 0xb8, 0x60, 0x0d, 0x54, 0x6c, 0x51, 0x65, 0x01, 0xa6, 0xa3, 0xc8, 0x21, 0x67, 0x8d, 0x3d, 0x99, 0x43, 0xfa, 0x9e, 0x74, 0xb9, 0xb9, 0x9f, 0xcc, 0xd4, 0x7a, 0xec, 0xc9, 0x1d, 0xd1, 0xf4, 0x94, 0x6b, 0x83, 0x55, 0xb3, 0x0a, 0x50, 0x0d, 0x7b, 0xd8, 0x08, 0x1e, 0x67, 0xad, 0x45, 0x99, 0xa5, 0xc8, 0xe2, 0x37, 0x06, 0x80, 0x3f, 0x95, 0x5a, 0xef, 0xf1, 0x68, 0x6e, 0x54, 0xcd, 0xf4, 0x88, 0x40, 0xe3, 0x2d, 0xd2, 0x34, 0x2c, 0x1a, 0x26, 0xfb, 0x27, 0xaa, 0xec, 0x2b, 0x4f, 0xe5, 0xb9, 0x11, 0x1f, 0x64, 0x97, 0x14, 0x3c, 0xc5, 0x9b, 0xe6, 0xff, 0x2a, 0xbe, 0xff, 0x59, 0x23, 0x0c, 0xa3, 0x32, 0xb3, 0x13, 0x65, 0xaf, 0x12, 0xba, 0x4e, 0xe8, 0x46, 0xff, 0x4e, 0x55, 0xe8, 0x91, 0x0b, 0x06, 0x8a, 0x86, 0xc8, 0x25, 0xa3, 0x18, 0x32, 0xe6, 0x43, 0x8a, 0x40, 0x58, 0xc5, 0x80, 0xaf, 0x06, 0xb8, 0x32, 0x1a, 0xcf, 0x9d, 0x21, 0x35, 0x31, 0x58, 0xb3, 0xf7, 0x4d, 0x9c, 0x6d, 0xd7, 0x18, 0xed, 0xbb, 0xb5, 0x21, 0x12, 0x31, 0xcf, 0x0d, 0xfb, 0x30, 0xa4, 0x3b, 0xe2, 0xe0, 0xc1, 0x30, 0x3b, 0xc3, 0xe4, 0x10, 0x49, 0xed, 0x12, 0x6c, 0xde, 0x17 } },
+	{ 71, { 0x88, 0x1a, 0xd9, 0xff, 0xbd, 0x7f, 0x09, 0x0e, 0xfa, 0x51, 0xcb, 0xdf, 0xe9, 0x3d, 0xa2, 0x3a, 0x04, 0x01, 0xf4, 0x44, 0x6f, 0x7a, 0xdf, 0x15, 0x0d, 0x1c, 0x22, 0x68, 0x51, 0xcb, 0xff, 0xf2 }, { 0x3c, 0xcc, 0x85, 0x0d, 0x53, 0xa1, 0x28, 0x7a, 0xf7, 0xb4, 0x56, 0x0b, 0x2e, 0xf0, 0xd4, 0x3e, 0xb5, 0xd9, 0xa8, 0x0d, 0x62, 0xa0, 0xe9, 0xcf, 0x1d, 0xbc, 0x04, 0x01, 0x35, 0x92, 0x11, 0x04, 0xd4, 0x39, 0x51, 0x68, 0xe9, 0x0b, 0xfc, 0x87, 0x17, 0x73, 0xeb, 0xb3, 0x4b, 0xca, 0x1b, 0xd6, 0x70, 0x56, 0xe1, 0xcc, 0x7d, 0xc7, 0xa4, 0x8f, 0xf7, 0xc3, 0x16, 0x7d, 0x38, 0x9f, 0x11, 0x7c }, { 0x10, 0xb3, 0xb7, 0xde, 0xa3, 0x6e, 0xb4, 0x7f, 0x49, 0xa3, 0x80, 0xbd, 0x01, 0xb0, 0x27, 0x8e, 0x6a, 0x2a, 0xc9, 0x4c, 0x9e, 0x13, 0xb4, 0x82, 0x6b, 0xc7, 0x7d, 0xfa, 0x55, 0x8c, 0xa1, 0x57, 0xaa, 0x84, 0x17, 0x02, 0x01, 0x2b, 0x53, 0x4f, 0x7c, 0x11, 0x28, 0x39, 0xc2, 0x7d, 0x06, 0xcf, 0xdf, 0x18, 0x26, 0x96, 0xcb, 0xa3, 0xb5, 0x7c, 0xa2, 0x70, 0x44, 0xbf, 0x51, 0xc2, 0x04, 0x3b, 0x55, 0x91, 0x5d, 0x6b, 0x82, 0xbb, 0xd0, 0xc8, 0x7e, 0x4d, 0x96, 0x1e, 0x13, 0x4e, 0x59, 0xea, 0x06, 0xa9, 0x16, 0x51, 0xc3, 0x39, 0x50, 0x7e, 0x2e, 0x7f, 0xa5, 0x8a, 0x99, 0xa1, 0x8b, 0x54, 0x16, 0x39, 0x61, 0x76, 0x53, 0x1d, 0xd9, 0xfe, 0x5b, 0x65, 0xac, 0x31, 0x41, 0x13, 0x37, 0xee, 0x5e, 0xd3, 0x55, 0x25, 0xa6, 0x15, 0xb5, 0x1d, 0x42, 0xd8, 0xf8, 0x53, 0xe7, 0x01, 0x0c, 0x01, 0xbe, 0xcf, 0xb6, 0x88, 0x7d, 0xd2, 0xc1, 0x6b, 0x2b, 0x5f, 0x4e, 0x76, 0x9d, 0x95, 0x64, 0x6a, 0xc1, 0xb7, 0x28, 0x9e, 0xfa, 0xef, 0xb4, 0x63, 0x09, 0xc1, 0xd8, 0x45, 0xad, 0x9a, 0x42, 0x67, 0x42, 0x10, 0x19, 0x3f, 0x58, 0xaf, 0x23, 0xf4, 0xb9, 0xd0, 0x5b, 0x4c, 0x11, 0x61, 0x79, 0x65, 0xcc, 0x81, 0x01, 0xa6, 0x28, 0x81, 0x04, 0x7b, 0x2a, 0x21, 0x3e, 0x31, 0xcc, 0x85, 0xe6, 0xb2, 0x39, 0x62, 0x4d, 0x86, 0x5f, 0xc3, 0xdc, 0x87 } },
+	{ 72, { 0xfe, 0x58, 0x86, 0x6b, 0x28, 0x93, 0xc6, 0xc4, 0x0e, 0xe8, 0x32, 0xce, 0x40, 0xfb, 0x6e, 0xb4, 0xc7, 0x0f, 0xf7, 0xc4, 0x79, 0x43, 0x80, 0xd9, 0x5c, 0x2e, 0xbe, 0xec, 0x62, 0xde, 0xcd, 0x31 }, { 0x5d, 0x63, 0xf2, 0xbb, 0xe9, 0x71, 0xa9, 0x83, 0xac, 0x68, 0x47, 0x48, 0x01, 0x06, 0xe4, 0xe1, 0x26, 0x4e, 0xe3, 0xa0, 0xbe, 0xfd, 0x79, 0x95, 0x49, 0x14, 0xe1, 0xd8, 0x6e, 0x79, 0x5b, 0x2e, 0x18, 0x23, 0x8f, 0x12, 0xfc, 0x5e, 0x46, 0xcb, 0x9c, 0xc7, 0x8e, 0xfd, 0xec, 0x61, 0x0a, 0x93, 0x64, 0x7c, 0xc0, 0x4e, 0x1c, 0x23, 0xd8, 0xca, 0xaa, 0x6a, 0x58, 0xc2, 0x1d, 0xd2, 0x6c, 0x07 }, { 0x2b, 0xb9, 0xaa, 0xde, 0x91, 0xb4, 0x0c, 0xfc, 0xed, 0x14, 0xad, 0x1f, 0xd7, 0xe2, 0x6a, 0xa8, 0x39, 0xb5, 0x14, 0x02, 0x27, 0xfa, 0xd2, 0x03, 0x11, 0xd2, 0x4d, 0xb1, 0x57, 0x8a, 0x8a, 0x55, 0x4e, 0x11, 0xcd, 0xc5, 0x36, 0x00, 0xe4, 0x51, 0xea, 0x0c, 0xeb, 0xcc, 0xa9, 0xb7, 0x00, 0xee, 0x76, 0x36, 0xd4, 0x79, 0x34, 0x19, 0x2c, 0x46, 0xd6, 0xcd, 0x4a, 0x27, 0xc1, 0x48, 0xf8, 0xc6, 0x2f, 0x1f, 0x4c, 0x7d, 0x12, 0xb5, 0x6c, 0x7b, 0xd4, 0xd4, 0x4d, 0xee, 0x8f, 0xff, 0xa5, 0xb0, 0x3c, 0xc2, 0x0c, 0xdf, 0xde, 0x2f, 0x50, 0x3b, 0xd1, 0x9b, 0x62, 0x4e, 0x50, 0xbf, 0x19, 0x4c, 0x7e, 0x52, 0xd7, 0x7b, 0x5f, 0xb2, 0x01, 0xde, 0x3f, 0xab, 0xce, 0xd1, 0xa0, 0xb3, 0x5b, 0x06, 0xbf, 0xf4, 0x58, 0x10, 0x0f, 0x8e, 0x54, 0xbc, 0xb2, 0x6f, 0x27, 0x25, 0xf7, 0x20, 0x82, 0x1f, 0xb5, 0x82, 0x44, 0xc4, 0xb8, 0x5f, 0xdf, 0x3e, 0xd6, 0x5e, 0x04, 0x68, 0x8b, 0xbf, 0xd4, 0x1b, 0x50, 0xb9, 0xca, 0xc0, 0x8f, 0xbb, 0xe2, 0x76, 0x2e, 0x5a, 0x9e, 0x15, 0xba, 0x5b, 0x57, 0x54, 0xfb, 0xa8, 0xf3, 0x43, 0x9e, 0x27, 0xf0, 0x04, 0x0c, 0xf6, 0x00, 0x9f, 0x9a, 0xeb, 0x06, 0x53, 0xc7, 0x7c, 0xb7, 0xa4, 0xd7, 0x1b, 0x12, 0x16, 0x80, 0x31, 0xc8, 0x44, 0x20, 0xe1, 0x99, 0xa4, 0x1d, 0x51, 0x89, 0x00, 0x62, 0x29, 0xa4, 0x82 } },
+	{ 135, { 0xfd, 0xed, 0x8f, 0xd9, 0xd6, 0x55, 0x1c, 0x60, 0x1e, 0xeb, 0x3b, 0x7c, 0x6b, 0xc5, 0xe5, 0xcf, 0xd8, 0xaa, 0xd1, 0xd0, 0x15, 0xb7, 0xe9, 0xaa, 0xa9, 0xc9, 0xb9, 0x47, 0x52, 0x31, 0xd5, 0xe2 }, { 0xd9, 0x42, 0xdf, 0x0d, 0xf0, 0x9a, 0xc0, 0x42, 0xcd, 0x3b, 0x64, 0x11, 0x44, 0xc9, 0x8d, 0x8f, 0xda, 0x09, 0x80, 0xbb, 0x03, 0x7f, 0xc5, 0xc0, 0xe7, 0xf2, 0xe9, 0xa0, 0x73, 0xb0, 0x73, 0xdc, 0x4b, 0xb8, 0xa8, 0xc1, 0xf4, 0xcb, 0x5b, 0x45, 0xf5, 0x80, 0x5c, 0x65, 0x23, 0x74, 0x1e, 0xd0, 0x57, 0x1d, 0x67, 0x79, 0xb1, 0x58, 0x29, 0xb2, 0xfa, 0xa2, 0x80, 0xfc, 0x60, 0xb5, 0x06, 0x45 }, { 0xc4, 0x5d, 0xae, 0x62, 0x4a, 0xd8, 0xa2, 0xf5, 0xaa, 0x7b, 0xac, 0x9d, 0x75, 0x57, 0x73, 0x7f, 0xd9, 0x1c, 0x96, 0xee, 0xdb, 0x70, 0xa6, 0xbe, 0x55, 0x74, 0xd5, 0x7a, 0x84, 0x4e, 0xad, 0xe0, 0x7f, 0x40, 0x56, 0xbf, 0x08, 0x1a, 0x10, 0x98, 0x10, 0x1c, 0xea, 0x81, 0x32, 0x18, 0x8c, 0x42, 0x21, 0x36, 0xfe, 0xb4, 0x68, 0x7d, 0x1e, 0x22, 0x09, 0xf3, 0xfd, 0x28, 0xbe, 0xdf, 0xb8, 0xf4, 0x46, 0x8c, 0xba, 0x85, 0x01, 0x76, 0x35, 0x11, 0xf5, 0x07, 0xc9, 0xc1, 0x45, 0x37, 0x40, 0x3b, 0xf7, 0x80, 0x4a, 0x89, 0x60, 0x7b, 0x4c, 0x3f, 0x5a, 0xfd, 0x48, 0x4e, 0xc0, 0xc4, 0x11, 0xc6, 0x1e, 0x61, 0xd8, 0x78, 0x4b, 0x2a, 0x0c, 0xb2, 0x81, 0xef, 0x9f, 0x44, 0xa4, 0xe3, 0x27, 0x32, 0xad, 0xab, 0xa1, 0x31, 0x87, 0x5b, 0x0e, 0x34, 0xd5, 0x87, 0xd1, 0xe6, 0x3f, 0xea, 0x83, 0xb1, 0x77, 0xa0, 0x42, 0x30, 0xd0, 0x41, 0xb8, 0xf9, 0x6e, 0x77, 0xd6, 0xd9, 0xa7, 0xc1, 0x42, 0x81, 0x7c, 0xbf, 0x4c, 0xed, 0xfa, 0x17, 0xf3, 0x86, 0xdc, 0x02, 0x06, 0xf4, 0x50, 0x9a, 0xb4, 0x30, 0x67, 0x63, 0x51, 0x2d, 0x15, 0x5d, 0xcb, 0xfa, 0x8f, 0xfe, 0xad, 0xb0, 0xa9, 0x09, 0xda, 0x94, 0x64, 0xa2, 0x8f, 0x01, 0xc9, 0xb5, 0x44, 0x1e, 0xc8, 0x5b, 0x53, 0x47, 0x86, 0xc6, 0xa0, 0xce, 0x90, 0xec, 0x77, 0x21, 0xed, 0x0f, 0x5a, 0x03 } },
+	{ 136, { 0xcf, 0x3c, 0xcf, 0xf9, 0x24, 0x80, 0xa2, 0x91, 0x60, 0xc2, 0xd3, 0x83, 0x17, 0xc4, 0x30, 0xe1, 0x47, 0x49, 0xbf, 0xee, 0x17, 0x88, 0x10, 0x69, 0x57, 0xdf, 0xe7, 0x3f, 0x8c, 0x49, 0x30, 0xe5 }, { 0xad, 0x8e, 0xdf, 0xf4, 0xf1, 0xb7, 0xaa, 0x1c, 0x63, 0xbb, 0xe4, 0x97, 0x28, 0xab, 0x9b, 0x16, 0x5f, 0x72, 0x45, 0xb3, 0xd7, 0x10, 0x2e, 0x6f, 0x99, 0xc2, 0x61, 0xfc, 0x15, 0xd2, 0xd0, 0xbf, 0x6a, 0xfe, 0xf6, 0xa4, 0x91, 0x72, 0x04, 0x54, 0xa1, 0x34, 0x9f, 0xbf, 0x5d, 0x84, 0x88, 0x54, 0x87, 0x5a, 0xc8, 0x3a, 0x11, 0x56, 0xfd, 0x7f, 0x6e, 0x2a, 0x37, 0xaf, 0x26, 0xc0, 0x7f, 0xb2 }, { 0xb7, 0xff, 0x40, 0x73, 0xb3, 0xf5, 0xa8, 0xea, 0xbd, 0x6e, 0x17, 0x70, 0x5c, 0xa7, 0xf6, 0x76, 0x1a, 0x31, 0x05, 0x8f, 0x9d, 0xf7, 0x81, 0xa6, 0xa4, 0x7e, 0x3a, 0x30, 0x63, 0xb9, 0xd6, 0x7a, 0x75, 0x7e, 0x8d, 0xbf, 0x04, 0x3d, 0xac, 0x48, 0xd2, 0x15, 0x4e, 0x46, 0xd5, 0x9c, 0x0b, 0x9e, 0x8b, 0xc3, 0x6b, 0xa0, 0x35, 0x15, 0x36, 0x91, 0xfb, 0xe8, 0x3b, 0x9e, 0xff, 0x5d, 0xae, 0x4a, 0x0a, 0xa0, 0x1d, 0x73, 0xc9, 0x84, 0xc4, 0x9a, 0xdc, 0x27, 0x12, 0x97, 0xaf, 0x1b, 0xaa, 0x96, 0x93, 0x1f, 0x24, 0xef, 0x47, 0xa1, 0x17, 0x81, 0xfe, 0xd7, 0x72, 0x2a, 0x29, 0x3e, 0x22, 0x36, 0x47, 0xe4, 0xbe, 0x70, 0x4f, 0xd5, 0xd6, 0x3e, 0xe4, 0xe1, 0x5a, 0x4a, 0x7c, 0xf7, 0xad, 0x58, 0x6b, 0x56, 0x1b, 0x84, 0x0e, 0x62, 0x25, 0xe6, 0xaa, 0xe3, 0x44, 0xdb, 0xe9, 0xa1, 0x5f, 0xb1, 0x55, 0xe4, 0xfa, 0x2a, 0xb7, 0xd7, 0xdf, 0x09, 0xbe, 0x06, 0xd8, 0x31, 0x95, 0xc8, 0x89, 0x2a, 0x2e, 0x6c, 0x5b, 0x56, 0xda, 0xdb, 0xb8, 0xf8, 0x08, 0xac, 0x51, 0x7e, 0x30, 0x59, 0x57, 0xe7, 0xe7, 0xcc, 0xa4, 0x07, 0xf3, 0x98, 0x40, 0xa0, 0x0b, 0xb6, 0x0e, 0x35, 0x63, 0x8b, 0xf0, 0xe2, 0xd5, 0x51, 0xfb, 0x0e, 0x27, 0x03, 0xb4, 0xeb, 0x65, 0x4c, 0x53, 0x42, 0x7a, 0xbb, 0x39, 0x32, 0xa4, 0x0a, 0xfb, 0x86, 0xb7, 0x63, 0x73, 0xe6 } },
+	{ 137, { 0xce, 0x9d, 0x7d, 0xc9, 0x09, 0x13, 0xee, 0x5d, 0x92, 0x74, 0x50, 0x19, 0x47, 0x9a, 0x53, 0x52, 0xc6, 0xd6, 0x27, 0x9b, 0xef, 0x18, 0xed, 0x07, 0xdc, 0x0a, 0x83, 0xee, 0x80, 0x84, 0xda, 0xca }, { 0x3f, 0x82, 0x7e, 0x5d, 0x7d, 0xdb, 0xd5, 0x4e, 0xa1, 0xdb, 0xa2, 0x8c, 0xae, 0x01, 0x54, 0xeb, 0x5f, 0xf8, 0xd8, 0xd9, 0x73, 0x77, 0x08, 0x65, 0x86, 0x1b, 0x7c, 0xdf, 0x5f, 0x09, 0x10, 0x40, 0x88, 0x9d, 0x55, 0xc0, 0xe7, 0x4b, 0x67, 0x2c, 0xea, 0xd2, 0x74, 0xfa, 0xc1, 0xd4, 0xa5, 0x59, 0xfd, 0x91, 0x85, 0xbe, 0x89, 0x8a, 0xb8, 0x96, 0x9b, 0x5e, 0x78, 0x68, 0x15, 0x27, 0x66, 0x0d }, { 0x01, 0xd9, 0x09, 0x52, 0xc6, 0x42, 0xa5, 0xeb, 0x2a, 0x8f, 0xc9, 0xd7, 0x13, 0xf8, 0x43, 0xa4, 0x5d, 0x7a, 0xc0, 0x51, 0x32, 0xdd, 0xdc, 0xb2, 0xef, 0xc9, 0xbe, 0xbc, 0x27, 0xe3, 0x7b, 0xcb, 0xe4, 0x21, 0x30, 0xc3, 0x6f, 0x35, 0x40, 0x25, 0x0a, 0xb1, 0x17, 0x96, 0x98, 0x0e, 0x77, 0x36, 0x83, 0xf2, 0x8d, 0x07, 0xf0, 0xf8, 0x38, 0x60, 0x6f, 0xb9, 0xc4, 0x5e, 0x45, 0x2b, 0xd3, 0x8f, 0xb9, 0xed, 0x42, 0xc8, 0x99, 0x4c, 0xba, 0xd9, 0x98, 0xa1, 0x97, 0x1c, 0xf3, 0xd7, 0xbc, 0x76, 0x3f, 0x40, 0xcb, 0x04, 0xfe, 0xfe, 0x87, 0x6a, 0x20, 0xc2, 0x7e, 0xce, 0x85, 0x1d, 0x48, 0x95, 0x39, 0xe1, 0xea, 0xa5, 0xec, 0xd6, 0x2b, 0xb2, 0x0b, 0xda, 0xd6, 0x52, 0x68, 0x19, 0x46, 0x2c, 0x6e, 0x4e, 0xfb, 0x71, 0xa4, 0x5c, 0x5b, 0x46, 0xdd, 0x01, 0x26, 0x47, 0xab, 0xd1, 0xd8, 0x99, 0xa0, 0x3d, 0x1b, 0x51, 0x4f, 0xb9, 0x38, 0x28, 0xa2, 0x1b, 0xc9, 0x36, 0x8b, 0xc2, 0x4f, 0xe6, 0x38, 0x08, 0xd6, 0xbe, 0x56, 0x72, 0x48, 0xba, 0xe6, 0x1f, 0x38, 0xba, 0x3f, 0x9e, 0x67, 0x6b, 0xbe, 0x82, 0x75, 0xba, 0x47, 0xc2, 0xff, 0x92, 0xd7, 0x70, 0x46, 0x89, 0x44, 0xb9, 0x93, 0x3c, 0x96, 0x43, 0x54, 0x88, 0x22, 0x4a, 0xf2, 0x96, 0xb8, 0xb5, 0x42, 0xf9, 0xfd, 0x3d, 0xc0, 0xf9, 0xf8, 0xf2, 0x3a, 0x3e, 0x65, 0x4a, 0xf4, 0x4e } },
+	{ 1000, { 0x48, 0xe6, 0x6a, 0x01, 0x86, 0x1d, 0x0e, 0xad, 0xaa, 0xcd, 0xb7, 0xa6, 0xae, 0x7d, 0xb6, 0xb9, 0xac, 0x79, 0x24, 0x2e, 0xcc, 0xed, 0x41, 0x54, 0xa9, 0xfb, 0xb3, 0x3c, 0x4e, 0x3c, 0xc5, 0x71 }, { 0xb8, 0x03, 0x0d, 0x30, 0x6a, 0xe9, 0x90, 0xbc, 0x79, 0x4b, 0xfb, 0x3a, 0x61, 0x00, 0xf6, 0x78, 0x51, 0x88, 0x9d, 0x6c, 0x27, 0x22, 0x57, 0xaf, 0xac, 0x7d, 0x10, 0x77, 0xa1, 0x86, 0x60, 0xd6, 0xea, 0x8d, 0x0d, 0xa5, 0xd2, 0x29, 0x9c, 0x3e, 0xba, 0xa0, 0xd3, 0x4b, 0xaf, 0x62, 0xcc, 0x58, 0xac, 0x1f, 0xd4, 0x47, 0x65, 0x06, 0xcf, 0x51, 0x2a, 0x48, 0x97, 0xbb, 0x08, 0x3a, 0x6f, 0xc4 }, { 0x34, 0x83, 0x3f, 0x03, 0xed, 0x88, 0xbb, 0x5f, 0x08, 0x3c, 0xe5, 0x90, 0xc7, 0xae, 0x5a, 0xf9, 0x3e, 0xde, 0x33, 0xe1, 0x1f, 0x53, 0xc7, 0x0e, 0x47, 0x91, 0x6c, 0x70, 0x44, 0x74, 0x6a, 0xcb, 0xdc, 0xa1, 0x9a, 0x73, 0xff, 0x13, 0x90, 0x5e, 0x91, 0xf8, 0xdc, 0x25, 0xce, 0x6e, 0x41, 0xae, 0x59, 0xfe, 0x75, 0x44, 0x1b, 0xd5, 0x48, 0xdd, 0xa9, 0x11, 0x4a, 0xca, 0x1d, 0xa7, 0x18, 0x02, 0x31, 0xfc, 0x22, 0xb3, 0x53, 0x32, 0x7c, 0xd2, 0x5e, 0x00, 0x74, 0x9a, 0xa2, 0x77, 0xae, 0x0f, 0xb1, 0x10, 0x3f, 0xfd, 0x45, 0x4d, 0x17, 0xae, 0x83, 0x34, 0x09, 0x0a, 0x8f, 0x3f, 0xb2, 0xa5, 0x6d, 0xf1, 0x0e, 0xc6, 0x3f, 0x46, 0xc9, 0x1e, 0xf1, 0xd8, 0x77, 0xd5, 0x59, 0xb5, 0xa5, 0x7b, 0x4b, 0xa9, 0xab, 0xbe, 0x4a, 0x38, 0xef, 0x7f, 0xec, 0xe7, 0xab, 0xff, 0x86, 0x1c, 0x8d, 0x85, 0x54, 0xb8, 0x7f, 0xd4, 0x5d, 0xc8, 0x3f, 0x6e, 0x41, 0xc0, 0xe2, 0xb4, 0xdc, 0x62, 0x71, 0x8e, 0x0d, 0x4c, 0x20, 0xd6, 0x19, 0x49, 0x49, 0x47, 0x30, 0x8d, 0x65, 0x2f, 0x47, 0xc6, 0xdb, 0x1c, 0x79, 0xd2, 0xe8, 0x05, 0x98, 0x9f, 0x71, 0xcf, 0xa0, 0xe7, 0x9e, 0xbe, 0x54, 0x00, 0x6c, 0xb2, 0x64, 0xdb, 0x8d, 0x31, 0x56, 0x26, 0x76, 0xc8, 0x9a, 0xe6, 0x9c, 0x80, 0x96, 0x68, 0x87, 0x64, 0xb7, 0xaa, 0x68, 0x60, 0xd8, 0x9c, 0xd4, 0x03 } },
+	{ 4096, { 0x40, 0xe6, 0x55, 0xa0, 0x04, 0x2c, 0x7f, 0xc2, 0x43, 0x71, 0x05, 0x79, 0xc0, 0xd6, 0xfa, 0xd0, 0x5d, 0xac, 0xeb, 0xa7, 0xd4, 0x74, 0xde, 0x35, 0xcc, 0xcb, 0x17, 0xd1, 0x94, 0xc2, 0xcd, 0xa2 }, { 0xac, 0x8f, 0xc5, 0xc0, 0xa7, 0xdc, 0x20, 0xb9, 0x23, 0x45, 0x24, 0xac, 0xcd, 0x60, 0x00, 0xbc, 0xaf, 0xba, 0xd2, 0x85, 0x0a, 0x66, 0x45, 0x56, 0x00, 0x87, 0x3c, 0x13, 0xd1, 0xcb, 0x68, 0x75, 0x82, 0x4f, 0x68, 0x88, 0x63, 0x08, 0x29, 0x89, 0x6e, 0xb4, 0x11, 0xee, 0x49, 0x73, 0x89, 0x6e, 0x0f, 0xb6, 0x48, 0x7d, 0x8b, 0xe8, 0x9f, 0xcc, 0x3d, 0xfd, 0x9e, 0xed, 0x6c, 0x93, 0xfe, 0x90 }, { 0x70, 0x67, 0x6a, 0x5d, 0x57, 0x93, 0x77, 0x56, 0xa9, 0x4d, 0x3c, 0xdb, 0xb4, 0xa6, 0x36, 0xc7, 0xa9, 0x57, 0xe5, 0xfc, 0xcd, 0x13, 0x23, 0xd8, 0xa4, 0x99, 0x7b, 0x62, 0xe3, 0x2c, 0xa6, 0x32, 0x35, 0xae, 0xd5, 0x7e, 0x65, 0x63, 0x72, 0x47, 0x97, 0x10, 0x7e, 0xd8, 0xf2, 0xee, 0xd5, 0xc0, 0x61, 0xd2, 0x65, 0x45, 0x59, 0xf3, 0xf1, 0xf9, 0x84, 0x18, 0x39, 0x09, 0x80, 0xfe, 0x5f, 0x2c, 0x91, 0xde, 0x51, 0x21, 0x16, 0xd9, 0xfd, 0x86, 0x8e, 0xf7, 0xb1, 0x3f, 0x5d, 0x0c, 0x45, 0x5b, 0x13, 0x22, 0x65, 0x6c, 0xeb, 0x2c, 0x12, 0x18, 0xa7, 0xd3, 0xfe, 0x65, 0x06, 0x39, 0xfb, 0xf9, 0x7d, 0x93, 0x49, 0x26, 0x4a, 0xf1, 0x11, 0xcd, 0xcf, 0x19, 0xcb, 0x14, 0xb2, 0x1d, 0x3a, 0x03, 0x9f, 0x7a, 0x37, 0x84, 0x57, 0xa1, 0xe4, 0x2e, 0x4f, 0xc6, 0x15, 0x71, 0x93, 0x24, 0xca, 0x11, 0xa2, 0x4c, 0xd8, 0x21, 0xe6, 0x15, 0x72, 0x28, 0x4d, 0x8a, 0xdb, 0x0f, 0x69, 0x8f, 0x30, 0xaf, 0x0d, 0xdc, 0x87, 0x4a, 0x71, 0xff, 0xaf, 0xd6, 0x8a, 0xbb, 0x38, 0xbb, 0x68, 0x64, 0x9e, 0xa2, 0xf1, 0xf5, 0x9c, 0x8b, 0x62, 0xa8, 0x92, 0x62, 0x8d, 0xe4, 0x8b, 0x94, 0xc3, 0xec, 0xdd, 0x89, 0xa5, 0x56, 0xe9, 0xb1, 0xdc, 0xc0, 0x35, 0x56, 0x85, 0xf6, 0x41, 0x32, 0xfe, 0x3e, 0xeb, 0xc4, 0xd7, 0x64, 0x23, 0x45, 0x54, 0xed, 0xf3, 0xc1 } },
+};
+
+//samples 4 to 6 of the KMAC examples of NIST SP 800-185, key[i] = 0x40 + i with 32 bytes and message[i] = i
+constexpr KMAC256_test_vector KMAC256_vector[3] = {
+	{ 4, "My Tagged Application", { 0x20, 0xc5, 0x70, 0xc3, 0x13, 0x46, 0xf7, 0x03, 0xc9, 0xac, 0x36, 0xc6, 0x1c, 0x03, 0xcb, 0x64, 0xc3, 0x97, 0x0d, 0x0c, 0xfc, 0x78, 0x7e, 0x9b, 0x79, 0x59, 0x9d, 0x27, 0x3a, 0x68, 0xd2, 0xf7, 0xf6, 0x9d, 0x4c, 0xc3, 0xde, 0x9d, 0x10, 0x4a, 0x35, 0x16, 0x89, 0xf2, 0x7c, 0xf6, 0xf5, 0x95, 0x1f, 0x01, 0x03, 0xf3, 0x3f, 0x4f, 0x24, 0x87, 0x10, 0x24, 0xd9, 0xc2, 0x77, 0x73, 0xa8, 0xdd } },
+	{ 200, "", { 0x75, 0x35, 0x8c, 0xf3, 0x9e, 0x41, 0x49, 0x4e, 0x94, 0x97, 0x07, 0x92, 0x7c, 0xee, 0x0a, 0xf2, 0x0a, 0x3f, 0xf5, 0x53, 0x90, 0x4c, 0x86, 0xb0, 0x8f, 0x21, 0xcc, 0x41, 0x4b, 0xcf, 0xd6, 0x91, 0x58, 0x9d, 0x27, 0xcf, 0x5e, 0x15, 0x36, 0x9c, 0xbb, 0xff, 0x8b, 0x9a, 0x4c, 0x2e, 0xb1, 0x78, 0x00, 0x85, 0x5d, 0x02, 0x35, 0xff, 0x63, 0x5d, 0xa8, 0x25, 0x33, 0xec, 0x6b, 0x75, 0x9b, 0x69 } },
+	{ 200, "My Tagged Application", { 0xb5, 0x86, 0x18, 0xf7, 0x1f, 0x92, 0xe1, 0xd5, 0x6c, 0x1b, 0x8c, 0x55, 0xdd, 0xd7, 0xcd, 0x18, 0x8b, 0x97, 0xb4, 0xca, 0x4d, 0x99, 0x83, 0x1e, 0xb2, 0x69, 0x9a, 0x83, 0x7d, 0xa2, 0xe4, 0xd9, 0x70, 0xfb, 0xac, 0xfd, 0xe5, 0x00, 0x33, 0xae, 0xa5, 0x85, 0xf1, 0xa2, 0x70, 0x85, 0x10, 0xc3, 0x2d, 0x07, 0x88, 0x08, 0x01, 0xbd, 0x18, 0x28, 0x98, 0xfe, 0x47, 0x68, 0x76, 0xfc, 0x89, 0x65 } },
+};
+
+//samples 4 to 6 of the ParallelHash examples of NIST SP 800-185 and longer messages, message[i] = i / 8 * 16 + i % 8
+constexpr ParallelHash256_test_vector ParallelHash256_vector[9] = {
+	{ 24, 8, "", 64, { 0xbc, 0x1e, 0xf1, 0x24, 0xda, 0x34, 0x49, 0x5e, 0x94, 0x8e, 0xad, 0x20, 0x7d, 0xd9, 0x84, 0x22, 0x35, 0xda, 0x43, 0x2d, 0x2b, 0xbc, 0x54, 0xb4, 0xc1, 0x10, 0xe6, 0x4c, 0x45, 0x11, 0x05, 0x53, 0x1b, 0x7f, 0x2a, 0x3e, 0x0c, 0xe0, 0x55, 0xc0, 0x28, 0x05, 0xe7, 0xc2, 0xde, 0x1f, 0xb7, 0x46, 0xaf, 0x97, 0xa1, 0xdd, 0x01, 0xf4, 0x3b, 0x82, 0x4e, 0x31, 0xb8, 0x76, 0x12, 0x41, 0x04, 0x29 } },
+	{ 24, 8, "Parallel Data", 64, { 0xcd, 0xf1, 0x52, 0x89, 0xb5, 0x4f, 0x62, 0x12, 0xb4, 0xbc, 0x27, 0x05, 0x28, 0xb4, 0x95, 0x26, 0x00, 0x6d, 0xd9, 0xb5, 0x4e, 0x2b, 0x6a, 0xdd, 0x1e, 0xf6, 0x90, 0x0d, 0xda, 0x39, 0x63, 0xbb, 0x33, 0xa7, 0x24, 0x91, 0xf2, 0x36, 0x96, 0x9c, 0xa8, 0xaf, 0xae, 0xa2, 0x9c, 0x68, 0x2d, 0x47, 0xa3, 0x93, 0xc0, 0x65, 0xb3, 0x8e, 0x29, 0xfa, 0xe6, 0x51, 0xa2, 0x09, 0x1c, 0x83, 0x31, 0x10 } },
+	{ 72, 12, "Parallel Data", 64, { 0x1a, 0x6f, 0x07, 0x1d, 0x77, 0x52, 0x09, 0x9e, 0xf6, 0xf5, 0x3b, 0x83, 0x15, 0x27, 0x4d, 0xea, 0xf1, 0x81, 0xe8, 0x97, 0x6f, 0xa4, 0xdd, 0xda, 0xb5, 0x30, 0xd5, 0x42, 0x5a, 0x4d, 0x8d, 0xc9, 0x35, 0xd6, 0x04, 0x87, 0x3b, 0x27, 0xa5, 0x23, 0x8f, 0x3d, 0xd9, 0xba, 0xcd, 0x0f, 0x77, 0xd7, 0x8b, 0x1c, 0x0f, 0x0f, 0xce, 0x22, 0x90, 0x91, 0x43, 0x96, 0x98, 0x28, 0x66, 0x47, 0xfc, 0x15 } },
+	{ 0, 8, "", 64, { 0x0f, 0x86, 0x63, 0x26, 0xa0, 0x8d, 0x47, 0x16, 0xbe, 0x9a, 0x36, 0x43, 0xbc, 0x1e, 0x12, 0x54, 0x95, 0xea, 0x63, 0xde, 0xd6, 0xd7, 0x9c, 0xf4, 0x80, 0x8b, 0x88, 0xec, 0x86, 0xc5, 0xcd, 0xeb, 0x33, 0xb0, 0x4c, 0xad, 0xe8, 0xa4, 0x34, 0xd2, 0x47, 0xad, 0x3e, 0xe9, 0xe7, 0xce, 0x9c, 0xf0, 0xb7, 0xe5, 0xe6, 0xd7, 0x4d, 0xa6, 0x6c, 0x9d, 0x52, 0x97, 0x42, 0xaf, 0x0d, 0x17, 0xe7, 0x39 } },
+	{ 1000, 8, "", 32, { 0x9c, 0x51, 0x2b, 0x93, 0x55, 0x96, 0x07, 0x40, 0x66, 0x63, 0x33, 0xd1, 0x50, 0xb7, 0xa2, 0x71, 0x94, 0x10, 0x04, 0xe5, 0xd9, 0xc8, 0x5f, 0x83, 0x9e, 0xec, 0x70, 0xaf, 0xee, 0x8d, 0x94, 0xd3 } },
+	{ 1000, 136, "Parallel Data", 64, { 0xc2, 0xbc, 0x13, 0x82, 0xea, 0xed, 0x3a, 0xd2, 0x3e, 0x84, 0x04, 0xd2, 0xd9, 0x0e, 0x86, 0x6d, 0x16, 0x0b, 0xb5, 0xb4, 0x34, 0x00, 0xd4, 0x64, 0x81, 0x8a, 0x8a, 0x98, 0xc7, 0xd9, 0xbb, 0x6b, 0x7b, 0x87, 0xaf, 0x99, 0x81, 0x6f, 0xcd, 0x6f, 0xe7, 0xd4, 0x18, 0x00, 0x9a, 0x99, 0x69, 0x57, 0x83, 0x75, 0x01, 0x99, 0x6d, 0x04, 0x0e, 0xb2, 0xf6, 0x62, 0xf3, 0xa7, 0x01, 0xff, 0x0d, 0xdd } },
+	{ 5000, 100, "", 64, { 0x02, 0x96, 0x09, 0xf2, 0x04, 0x7c, 0x79, 0x1d, 0x86, 0x1a, 0xb8, 0x1d, 0xdc, 0xe5, 0x0c, 0xd9, 0x19, 0xb3, 0x74, 0x06, 0x40, 0x35, 0x55, 0x4f, 0xee, 0x60, 0xfc, 0xb5, 0x18, 0x23, 0x77, 0xc7, 0xe3, 0xdd, 0x11, 0x7d, 0x64, 0x3a, 0x70, 0x94, 0x76, 0xa9, 0x14, 0x64, 0x08, 0x11, 0x73, 0xa9, 0xb0, 0xdb, 0xf0, 0x63, 0x22, 0x38, 0x5e, 0x07, 0xaa, 0x40, 0xe9, 0xe7, 0x9a, 0x2c, 0x9e, 0xcd } },
+	{ 81925, 8192, "", 64, { 0xe2, 0x73, 0x31, 0x6d, 0xd6, 0xea, 0x20, 0x06, 0x31, 0x61, 0x1a, 0x8b, 0xda, 0x1a, 0x21, 0x3e, 0x17, 0xb1, 0x04, 0xc6, 0x89, 0xb2, 0x82, 0xd9, 0x06, 0x75, 0x0f, 0x4d, 0xc9, 0x1c, 0xa6, 0xa7, 0x08, 0x4d, 0x1c, 0xd5, 0x87, 0x56, 0x82, 0xf6, 0x78, 0xbf, 0x73, 0xf0, 0xfe, 0x86, 0x76, 0x33, 0x48, 0x54, 0xbd, 0x60, 0xa0, 0xb9, 0xc0, 0xe4, 0x39, 0x5c, 0xda, 0x71, 0xdc, 0x6b, 0xef, 0xde } },
+	{ 81925, 8192, "Parallel Data", 32, { 0x44, 0x67, 0xea, 0x99, 0x2e, 0x1b, 0x7c, 0x58, 0x90, 0x30, 0xe1, 0x66, 0xd0, 0x58, 0xee, 0x74, 0xb6, 0xbc, 0x46, 0x3f, 0x67, 0xf2, 0x6c, 0x14, 0x03, 0xc8, 0x59, 0x64, 0x4a, 0xaa, 0x3b, 0x41 } },
+};
+
+#endif
\ No newline at end of file
@@ -766,4 +766,11 @@ constexpr SHA_test_vector sha512_256_vector2[100] = {
 	{ { 0x11, 0x07, 0x6c, 0x37, 0x69, 0xf8, 0x63, 0xc9, 0xa1, 0xdc, 0x4b, 0x56, 0x0b, 0x6c, 0xf9, 0x57, 0x5a, 0x22, 0x45, 0xd5, 0x4a, 0xc6, 0x51, 0x8f, 0xb9, 0x0e, 0xfa, 0xa5, 0x6c, 0x12, 0x1f, 0xd6, 0xee, 0x0d, 0x01, 0x20, 0xe6, 0xb6, 0x89, 0x1a, 0xc3, 0xae, 0xd8, 0x5c, 0x1b, 0xf2, 0xc5, 0xee, 0x69, 0x91, 0x09, 0x33, 0xc3, 0xad, 0xeb, 0x70, 0x21, 0x97, 0x73, 0xdf, 0x91, 0x51, 0x51, 0xd6, 0x87, 0x25, 0x9c, 0x9e, 0x75, 0x96, 0x59, 0x42, 0x23, 0xf9, 0x76, 0xe8, 0xa6, 0x64, 0x07, 0x9c, 0x05, 0x5e, 0x0b, 0x8a, 0x4e, 0xab, 0x82, 0x7c, 0x5e, 0x21, 0x3d, 0x91, 0x21, 0x40, 0x49, 0x02, 0xb9, 0x48, 0x7c, 0x03, 0xd2, 0x0d, 0xec, 0x7a, 0xdd, 0xbd, 0x2b, 0x24, 0xa4, 0x62, 0x8b, 0x4c, 0x6d, 0x86, 0x3d, 0x3e, 0x04, 0x2c, 0x36, 0xb5, 0xff, 0x34, 0xbb, 0xd6 }, 124, { 0x20, 0x93, 0x11, 0xd8, 0xca, 0x27, 0x61, 0x2e, 0x21, 0xd0, 0xae, 0x22, 0xe4, 0x7a, 0x05, 0x61, 0x31, 0x04, 0xbe, 0x91, 0x44, 0x70, 0xe7, 0x7b, 0x12, 0x63, 0x5f, 0x51, 0x82, 0x5f, 0x51, 0xc2 } },
 };
 
+//FIPS 180-2 examples, one million repetitions of 'a'
+constexpr unsigned char sha1_million_a[20] = { 0x34, 0xaa, 0x97, 0x3c, 0xd4, 0xc4, 0xda, 0xa4, 0xf6, 0x1e, 0xeb, 0x2b, 0xdb, 0xad, 0x27, 0x31, 0x65, 0x34, 0x01, 0x6f };
+constexpr unsigned char sha224_million_a[28] = { 0x20, 0x79, 0x46, 0x55, 0x98, 0x0c, 0x91, 0xd8, 0xbb, 0xb4, 0xc1, 0xea, 0x97, 0x61, 0x8a, 0x4b, 0xf0, 0x3f, 0x42, 0x58, 0x19, 0x48, 0xb2, 0xee, 0x4e, 0xe7, 0xad, 0x67 };
+constexpr unsigned char sha256_million_a[32] = { 0xcd, 0xc7, 0x6e, 0x5c, 0x99, 0x14, 0xfb, 0x92, 0x81, 0xa1, 0xc7, 0xe2, 0x84, 0xd7, 0x3e, 0x67, 0xf1, 0x80, 0x9a, 0x48, 0xa4, 0x97, 0x20, 0x0e, 0x04, 0x6d, 0x39, 0xcc, 0xc7, 0x11, 0x2c, 0xd0 };
+constexpr unsigned char sha384_million_a[48] = { 0x9d, 0x0e, 0x18, 0x09, 0x71, 0x64, 0x74, 0xcb, 0x08, 0x6e, 0x83, 0x4e, 0x31, 0x0a, 0x4a, 0x1c, 0xed, 0x14, 0x9e, 0x9c, 0x00, 0xf2, 0x48, 0x52, 0x79, 0x72, 0xce, 0xc5, 0x70, 0x4c, 0x2a, 0x5b, 0x07, 0xb8, 0xb3, 0xdc, 0x38, 0xec, 0xc4, 0xeb, 0xae, 0x97, 0xdd, 0xd8, 0x7f, 0x3d, 0x89, 0x85 };
+constexpr unsigned char sha512_million_a[64] = { 0xe7, 0x18, 0x48, 0x3d, 0x0c, 0xe7, 0x69, 0x64, 0x4e, 0x2e, 0x42, 0xc7, 0xbc, 0x15, 0xb4, 0x63, 0x8e, 0x1f, 0x98, 0xb1, 0x3b, 0x20, 0x44, 0x28, 0x56, 0x32, 0xa8, 0x03, 0xaf, 0xa9, 0x73, 0xeb, 0xde, 0x0f, 0xf2, 0x44, 0x87, 0x7e, 0xa6, 0x0a, 0x4c, 0xb0, 0x43, 0x2c, 0xe5, 0x77, 0xc3, 0x1b, 0xeb, 0x00, 0x9c, 0x5c, 0x2c, 0x49, 0xaa, 0x2e, 0x4e, 0xad, 0xb2, 0x17, 0xad, 0x8c, 0xc0, 0x9b };
+
 #endif
\ No newline at end of file
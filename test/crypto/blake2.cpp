@@ -16,6 +16,49 @@ void test_blake2(const blake2_test_vector (&array)[N], const char* str)
 			std::cerr << str;
 			std::terminate();
 		}
+
+		//split so that the first piece ends inside a block
+		Hash hash(array[i].key, array[i].key_length, array[i].digest_length);
+		hash.update(array[i].message, array[i].length / 3);
+		hash.update(array[i].message + array[i].length / 3, array[i].length - array[i].length / 3);
+		hash.final(digest);
+		if (!std::equal(array[i].digest, array[i].digest + array[i].digest_length, digest))
+		{
+			std::cerr << str;
+			std::terminate();
+		}
+	}
+}
+
+//the leaves take whole blocks in turn, so the message is also fed in pieces that cross blocks and stripes
+template<typename Hash, int N>
+void test_blake2p(const blake2p_test_vector (&array)[N], const char* str)
+{
+	unsigned char message[3000], key[64];
+	for (int i = 0; i < 3000; i++)
+		message[i] = static_cast<unsigned char>(i);
+	for (int i = 0; i < 64; i++)
+		key[i] = static_cast<unsigned char>(i);
+
+	for (int i = 0; i < N; i++)
+	{
+		unsigned char digest[64];
+		Hash(key, array[i].key_length, message, array[i].length, digest, array[i].digest_length);
+		if (!std::equal(array[i].digest, array[i].digest + array[i].digest_length, digest))
+		{
+			std::cerr << str;
+			std::terminate();
+		}
+
+		Hash hash(key, array[i].key_length, array[i].digest_length);
+		for (int j = 0; j < array[i].length; j += 67)
+			hash.update(message + j, std::min(67, array[i].length - j));
+		hash.final(digest);
+		if (!std::equal(array[i].digest, array[i].digest + array[i].digest_length, digest))
+		{
+			std::cerr << str;
+			std::terminate();
+		}
 	}
 }
 
@@ -29,6 +72,8 @@ int main()
 	test_blake2<blake2s>(blake2s_hash_vector1, "blake2s fail\n");
 	test_blake2<blake2s>(blake2s_hash_vector2, "blake2s fail\n");
 	test_blake2<blake2s>(blake2s_mac_vector1, "blake2s fail\n");
+	test_blake2p<blake2bp>(blake2bp_vector, "blake2bp fail\n");
+	test_blake2p<blake2sp>(blake2sp_vector, "blake2sp fail\n");
 
 	return 0;
 }
\ No newline at end of file
@@ -433,4 +433,41 @@ constexpr blake2_test_vector blake2s_mac_vector1[100] = {
 	{ { 0x75, 0x04, 0xf0, 0x8c, 0x6c, 0x11, 0xc3, 0xb0, 0xf1, 0x61, 0xff, 0x46, 0xf2, 0x9a, 0x10, 0x65, 0xc7, 0x9e, 0x92, 0xc5, 0xf2, 0xf8, 0xab, 0x07, 0x9a, 0x0b, 0x56, 0xdb, 0x81, 0x4b, 0x78, 0x8b, 0x03, 0xe2, 0xed, 0x8a, 0xf5, 0xcc, 0x75, 0x75, 0x3f, 0xdd, 0x8e, 0xf0, 0xd4 }, 45, { 0xd2, 0xd4, 0xef, 0xd9, 0xac, 0xd4, 0x97, 0x18, 0x14, 0xe7, 0x18, 0x8a, 0xe0, 0x91, 0x05, 0xb2, 0x10, 0x48, 0x1d, 0x83, 0x1e, 0x3a, 0xd1, 0xba }, 24, { 0x8f, 0xf1, 0x50, 0xd4, 0x41, 0xde, 0x48, 0xae }, 8 },
 };
 
+//message[i] = i % 256 and key[i] = i, the keyed empty messages match blake2bp-kat.txt and blake2sp-kat.txt of the BLAKE2 reference
+struct blake2p_test_vector
+{
+	int length;
+	int key_length;
+	unsigned char digest[64];
+	int digest_length;
+};
+
+constexpr blake2p_test_vector blake2bp_vector[11] = {
+	{ 0, 0, { 0xb5, 0xef, 0x81, 0x1a, 0x80, 0x38, 0xf7, 0x0b, 0x62, 0x8f, 0xa8, 0xb2, 0x94, 0xda, 0xae, 0x74, 0x92, 0xb1, 0xeb, 0xe3, 0x43, 0xa8, 0x0e, 0xaa, 0xbb, 0xf1, 0xf6, 0xae, 0x66, 0x4d, 0xd6, 0x7b, 0x9d, 0x90, 0xb0, 0x12, 0x07, 0x91, 0xea, 0xb8, 0x1d, 0xc9, 0x69, 0x85, 0xf2, 0x88, 0x49, 0xf6, 0xa3, 0x05, 0x18, 0x6a, 0x85, 0x50, 0x1b, 0x40, 0x51, 0x14, 0xbf, 0xa6, 0x78, 0xdf, 0x93, 0x80 }, 64 },
+	{ 0, 64, { 0x9d, 0x94, 0x61, 0x07, 0x3e, 0x4e, 0xb6, 0x40, 0xa2, 0x55, 0x35, 0x7b, 0x83, 0x9f, 0x39, 0x4b, 0x83, 0x8c, 0x6f, 0xf5, 0x7c, 0x9b, 0x68, 0x6a, 0x3f, 0x76, 0x10, 0x7c, 0x10, 0x66, 0x72, 0x8f, 0x3c, 0x99, 0x56, 0xbd, 0x78, 0x5c, 0xbc, 0x3b, 0xf7, 0x9d, 0xc2, 0xab, 0x57, 0x8c, 0x5a, 0x0c, 0x06, 0x3b, 0x9d, 0x9c, 0x40, 0x58, 0x48, 0xde, 0x1d, 0xbe, 0x82, 0x1c, 0xd0, 0x5c, 0x94, 0x0a }, 64 },
+	{ 1, 0, { 0xa1, 0x39, 0x28, 0x0e, 0x72, 0x75, 0x7b, 0x72, 0x3e, 0x64, 0x73, 0xd5, 0xbe, 0x59, 0xf3, 0x6e, 0x9d, 0x50, 0xfc, 0x5c, 0xd7, 0xd4, 0x58, 0x5c, 0xbc, 0x09, 0x80, 0x48, 0x95, 0xa3, 0x6c, 0x52, 0x12, 0x42, 0xfb, 0x27, 0x89, 0xf8, 0x5c, 0xb9, 0xe3, 0x54, 0x91, 0xf3, 0x1d, 0x4a, 0x69, 0x52, 0xf9, 0xd8, 0xe0, 0x97, 0xae, 0xf9, 0x4f, 0xa1, 0xca, 0x0b, 0x12, 0x52, 0x57, 0x21, 0xf0, 0x3d }, 64 },
+	{ 128, 64, { 0x92, 0x80, 0xf4, 0xd1, 0x15, 0x70, 0x32, 0xab, 0x31, 0x5c, 0x10, 0x0d, 0x63, 0x62, 0x83, 0xfb, 0xf4, 0xfb, 0xa2, 0xfb, 0xad, 0x0f, 0x8b, 0xc0, 0x20, 0x72, 0x1d, 0x76, 0xbc, 0x1c, 0x89, 0x73, 0xce, 0xd2, 0x88, 0x71, 0xcc, 0x90, 0x7d, 0xab, 0x60, 0xe5, 0x97, 0x56, 0x98, 0x7b, 0x0e, 0x0f, 0x86, 0x7f, 0xa2, 0xfe, 0x9d, 0x90, 0x41, 0xf2, 0xc9, 0x61, 0x80, 0x74, 0xe4, 0x4f, 0xe5, 0xe9 }, 64 },
+	{ 511, 0, { 0xfa, 0x14, 0x89, 0x74, 0x33, 0xdd, 0x69, 0x32, 0x1b, 0x19, 0x33, 0xa1, 0xfe, 0x10, 0x1f, 0xdd, 0x46, 0x3d, 0xc1, 0x5f, 0xff, 0xe3, 0xf5, 0x72, 0xc0, 0xb4, 0x89, 0xbb, 0x60, 0x7e, 0xdf, 0xf8, 0xb6, 0xdd, 0x04, 0xa2, 0x38, 0x71, 0xbe, 0x99, 0x3d, 0x64, 0xaf, 0x5a, 0xaa, 0x9b, 0x76, 0xaf, 0x48, 0x2a, 0x23, 0x63, 0xa3, 0x6c, 0x1e, 0x6d, 0xaa, 0xef, 0x21, 0xd3, 0xe3, 0xac, 0x29, 0xc6 }, 64 },
+	{ 512, 64, { 0x14, 0xba, 0x32, 0xc1, 0xc8, 0x0b, 0xb3, 0x2c, 0x82, 0x82, 0xaa, 0x53, 0xf3, 0x41, 0xf4, 0x5d, 0xaa, 0xbd, 0xa1, 0x2b, 0xda, 0x41, 0xf7, 0xad, 0x8e, 0xc7, 0x5b, 0xaa, 0x74, 0x3a, 0x41, 0xad, 0xf2, 0x37, 0x6a, 0xd3, 0xde, 0x32, 0xfb, 0x57, 0x6d, 0x3e, 0xfd, 0xca, 0xdf, 0x3f, 0x59, 0xd2, 0x5b, 0x40, 0xb9, 0x15, 0x68, 0x1c, 0xc9, 0x0d, 0xee, 0x3a, 0x9b, 0x2c, 0xb0, 0x20, 0x61, 0xea }, 64 },
+	{ 513, 0, { 0xcd, 0x79, 0xfb, 0xbd, 0xed, 0x91, 0x82, 0x32, 0x72, 0xab, 0xb7, 0xa9, 0x7a, 0x55, 0x30, 0x60, 0x8f, 0x05, 0x83, 0xbd, 0x54, 0x05, 0xc7, 0x76, 0x51, 0x56, 0xc4, 0xd8, 0x75, 0x4d, 0xdf, 0x43, 0x5d, 0x6d, 0x71, 0xb8, 0x4f, 0x83, 0xc6, 0x38, 0x10, 0x78, 0x93, 0x5e, 0x37, 0x8d, 0x4b, 0xf0, 0xf7, 0x52, 0xb3, 0x09, 0xd1, 0x39, 0x8a, 0xf5, 0x78, 0xe1, 0x03, 0xe4, 0x43, 0xb8, 0xac, 0x55 }, 64 },
+	{ 1024, 64, { 0x86, 0x8a, 0x4b, 0xe4, 0x29, 0xbf, 0xe1, 0x26, 0x79, 0x6f, 0x52, 0x80, 0x04, 0xb9, 0x9b, 0xb7, 0x9b, 0x3c, 0xb1, 0x49, 0x77, 0x1e, 0x8d, 0x9f, 0x0d, 0x96, 0x2e, 0x39, 0xd5, 0x8d, 0xb1, 0xc2, 0x8d, 0x42, 0xdc, 0xf2, 0x3e, 0xae, 0xd7, 0x36, 0x1f, 0xe1, 0xae, 0x8b, 0xc1, 0x82, 0xa7, 0xe0, 0x36, 0x35, 0x2b, 0xf5, 0x71, 0x97, 0x6d, 0x2b, 0xfd, 0x63, 0xe9, 0x2d, 0x92, 0x0b, 0xb4, 0x9a }, 64 },
+	{ 1025, 32, { 0xa2, 0xfc, 0xcd, 0xf2, 0x00, 0x98, 0x52, 0x34, 0x3d, 0x57, 0x17, 0x53, 0xc9, 0x4a, 0x23, 0x84, 0x76, 0x9d, 0x05, 0xd7, 0x04, 0xd7, 0x37, 0x74, 0x8b, 0xd8, 0xf1, 0xf0, 0x45, 0x4c, 0xa0, 0xe2, 0x2b, 0xcb, 0x23, 0xd5, 0x94, 0x1c, 0x39, 0xbe, 0xcf, 0xab, 0xe2, 0x48, 0x98, 0x69, 0x00, 0xea, 0x82, 0x75, 0x9e, 0x61, 0x77, 0x33, 0x44, 0x4b, 0x71, 0xb0, 0x8d, 0x6a, 0xcf, 0x6b, 0x96, 0x3d }, 64 },
+	{ 3000, 0, { 0x5a, 0xeb, 0x3a, 0xb2, 0x12, 0x42, 0xff, 0x3f, 0xe2, 0x12, 0x0e, 0x8f, 0x04, 0xfd, 0x29, 0x4b, 0x5b, 0x1f, 0x23, 0xda, 0xf9, 0x34, 0x4b, 0x43, 0x1a, 0x76, 0xc1, 0xd1, 0xc4, 0x5d, 0xe2, 0x06 }, 32 },
+	{ 3000, 64, { 0x7c, 0x1c, 0xb7, 0x73, 0x0b, 0x08, 0x29, 0x4b, 0x0b, 0x5c, 0x9f, 0x6a, 0x42, 0x1a, 0x76, 0x80, 0x9c, 0xff, 0x85, 0x62, 0xc9, 0x79, 0x8a, 0x02, 0x20, 0x1f, 0x50, 0x42, 0x65, 0x78, 0xa4, 0x43, 0x9d, 0x7b, 0x06, 0xd1, 0x2b, 0x1d, 0xbc, 0xc0, 0x74, 0xfb, 0x86, 0x01, 0xa0, 0xf8, 0x92, 0x83, 0x7d, 0x5f, 0x47, 0xa7, 0xb2, 0x84, 0x24, 0x4f, 0x4d, 0x94, 0x8a, 0x96, 0xa6, 0xa0, 0x9d, 0x05 }, 64 },
+};
+
+constexpr blake2p_test_vector blake2sp_vector[11] = {
+	{ 0, 0, { 0xdd, 0x0e, 0x89, 0x17, 0x76, 0x93, 0x3f, 0x43, 0xc7, 0xd0, 0x32, 0xb0, 0x8a, 0x91, 0x7e, 0x25, 0x74, 0x1f, 0x8a, 0xa9, 0xa1, 0x2c, 0x12, 0xe1, 0xca, 0xc8, 0x80, 0x15, 0x00, 0xf2, 0xca, 0x4f }, 32 },
+	{ 0, 32, { 0x71, 0x5c, 0xb1, 0x38, 0x95, 0xae, 0xb6, 0x78, 0xf6, 0x12, 0x41, 0x60, 0xbf, 0xf2, 0x14, 0x65, 0xb3, 0x0f, 0x4f, 0x68, 0x74, 0x19, 0x3f, 0xc8, 0x51, 0xb4, 0x62, 0x10, 0x43, 0xf0, 0x9c, 0xc6 }, 32 },
+	{ 1, 0, { 0xa6, 0xb9, 0xee, 0xcc, 0x25, 0x22, 0x7a, 0xd7, 0x88, 0xc9, 0x9d, 0x3f, 0x23, 0x6d, 0xeb, 0xc8, 0xda, 0x40, 0x88, 0x49, 0xe9, 0xa5, 0x17, 0x89, 0x78, 0x72, 0x7a, 0x81, 0x45, 0x7f, 0x72, 0x39 }, 32 },
+	{ 64, 32, { 0x1d, 0x37, 0x01, 0xa5, 0x66, 0x1b, 0xd3, 0x1a, 0xb2, 0x05, 0x62, 0xbd, 0x07, 0xb7, 0x4d, 0xd1, 0x9a, 0xc8, 0xf3, 0x52, 0x4b, 0x73, 0xce, 0x7b, 0xc9, 0x96, 0xb7, 0x88, 0xaf, 0xd2, 0xf3, 0x17 }, 32 },
+	{ 511, 0, { 0x50, 0x28, 0x52, 0x71, 0x95, 0x69, 0x32, 0xd3, 0x9b, 0x09, 0x67, 0x20, 0x2b, 0x56, 0x00, 0x6c, 0xbb, 0x6d, 0x73, 0x8e, 0xe2, 0x9e, 0x5a, 0x86, 0x7e, 0xdf, 0x72, 0xc8, 0xc4, 0x38, 0x6f, 0x1b }, 32 },
+	{ 512, 32, { 0x32, 0x46, 0xbc, 0x18, 0xb4, 0x22, 0x53, 0xf5, 0x8d, 0x3b, 0xc2, 0x1d, 0xd5, 0x1c, 0x14, 0x29, 0x0c, 0x0b, 0x78, 0xd4, 0xd9, 0xd5, 0x27, 0x40, 0x87, 0xbf, 0xf2, 0xca, 0x29, 0x7c, 0x51, 0xfc }, 32 },
+	{ 513, 0, { 0x13, 0x36, 0x62, 0x8c, 0x7f, 0x15, 0x41, 0xc7, 0x81, 0x5f, 0xc0, 0xff, 0x1f, 0xb5, 0xdf, 0xb0, 0x7a, 0x85, 0xcf, 0x5a, 0x17, 0xa2, 0x87, 0x2a, 0x3c, 0xe4, 0xb3, 0x22, 0xd4, 0xa0, 0x3d, 0x0b }, 32 },
+	{ 1024, 32, { 0x70, 0xf4, 0x61, 0xc5, 0x06, 0x64, 0x94, 0xb5, 0xeb, 0x28, 0xa9, 0x59, 0xef, 0xa3, 0xa9, 0x19, 0x1a, 0x5e, 0x52, 0x64, 0x2e, 0x6f, 0x5b, 0x5f, 0x22, 0xc7, 0x51, 0x92, 0x72, 0x39, 0xd4, 0x60 }, 32 },
+	{ 1025, 16, { 0xa6, 0x6d, 0x13, 0x22, 0xe3, 0xbd, 0xd2, 0x46, 0xb0, 0x8e, 0xbc, 0xa0, 0x3f, 0x19, 0x4a, 0xe0, 0xe2, 0x40, 0x7a, 0xf2, 0x60, 0x85, 0x56, 0xb4, 0xb7, 0x38, 0xa6, 0xc0, 0x0d, 0x76, 0x3b, 0x52 }, 32 },
+	{ 3000, 0, { 0xc9, 0xdf, 0xc6, 0xec, 0x37, 0xff, 0xb1, 0x82, 0x32, 0x1f, 0xa5, 0x0f, 0xbd, 0x2e, 0xc4, 0x4c }, 16 },
+	{ 3000, 32, { 0x1c, 0xf0, 0x2f, 0x5b, 0xb5, 0x85, 0x45, 0xa9, 0x85, 0x1a, 0xed, 0xf8, 0x53, 0xb9, 0xbe, 0x88, 0x53, 0x22, 0x1d, 0xcd, 0x15, 0xf5, 0xd6, 0x49, 0x22, 0xff, 0x59, 0xe2, 0xc8, 0xf4, 0xb9, 0xfc }, 32 },
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include<iostream>
+#include<algorithm>
+#include<exception>
+#include<vector>
+#include<crypto/blake3.h>
+#include"blake3_test_vector.h"
+
+template<typename Hash>
+void check(Hash& hash, const unsigned char* expected, int output_size, const char* str)
+{
+	unsigned char digest[131];
+	hash.final(digest);
+	if (!std::equal(expected, expected + output_size, digest))
+	{
+		std::cerr << str;
+		std::terminate();
+	}
+}
+
+//every vector is hashed in one piece, split so that the first piece ends inside a chunk,
+//and as subtrees of 4096 bytes hashed last to first before they are taken in order
+template<int N>
+void test_blake3(const blake3_test_vector (&array)[N])
+{
+	std::vector<unsigned char> message(102400);
+	for (size_t i = 0; i < message.size(); i++)
+		message[i] = static_cast<unsigned char>(i % 251);
+
+	for (int i = 0; i < N; i++)
+	{
+		const int length = array[i].length;
+		for (int output_size : { 32, 131 })
+		{
+			crypto::hash::blake3 hash(output_size);
+			hash.update(message.data(), length);
+			check(hash, array[i].hash, output_size, "blake3 fail\n");
+
+			crypto::MAC::blake3 mac(blake3_test_key, output_size);
+			mac.update(message.data(), length / 3);
+			mac.update(message.data() + length / 3, length - length / 3);
+			check(mac, array[i].keyed_hash, output_size, "blake3 keyed fail\n");
+		}
+
+		constexpr int piece = 4096;
+		crypto::MAC::blake3 mac(blake3_test_key);
+		std::vector<crypto::MAC::blake3::subtree> subtrees;
+		subtrees.reserve(length / piece + 1);
+		for (int offset = length / piece * piece; offset >= 0; offset -= piece)
+			subtrees.emplace_back(mac, message.data() + offset, std::min(piece, length - offset), offset);
+		for (auto it = subtrees.rbegin(); it != subtrees.rend(); ++it)
+			mac.update(*it);
+		check(mac, array[i].keyed_hash, 32, "blake3 subtree fail\n");
+	}
+}
+
+int main()
+{
+	test_blake3(blake3_vector);
+
+	return 0;
+}
\ No newline at end of file
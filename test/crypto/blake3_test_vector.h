@@ -0,0 +1,39 @@
+#ifndef blake3_test_vector_h
+#define blake3_test_vector_h
+
+struct blake3_test_vector
+{
+	int length;
+	unsigned char hash[131];
+	unsigned char keyed_hash[131];
+};
+
+//test_vectors.json of the BLAKE3 reference, message[i] = i % 251 and the key is blake3_test_key
+constexpr unsigned char blake3_test_key[33] = "whats the Elvish word for friend";
+
+constexpr blake3_test_vector blake3_vector[22] = {
+	{ 0, { 0xaf, 0x13, 0x49, 0xb9, 0xf5, 0xf9, 0xa1, 0xa6, 0xa0, 0x40, 0x4d, 0xea, 0x36, 0xdc, 0xc9, 0x49, 0x9b, 0xcb, 0x25, 0xc9, 0xad, 0xc1, 0x12, 0xb7, 0xcc, 0x9a, 0x93, 0xca, 0xe4, 0x1f, 0x32, 0x62, 0xe0, 0x0f, 0x03, 0xe7, 0xb6, 0x9a, 0xf2, 0x6b, 0x7f, 0xaa, 0xf0, 0x9f, 0xcd, 0x33, 0x30, 0x50, 0x33, 0x8d, 0xdf, 0xe0, 0x85, 0xb8, 0xcc, 0x86, 0x9c, 0xa9, 0x8b, 0x20, 0x6c, 0x08, 0x24, 0x3a, 0x26, 0xf5, 0x48, 0x77, 0x89, 0xe8, 0xf6, 0x60, 0xaf, 0xe6, 0xc9, 0x9e, 0xf9, 0xe0, 0xc5, 0x2b, 0x92, 0xe7, 0x39, 0x30, 0x24, 0xa8, 0x04, 0x59, 0xcf, 0x91, 0xf4, 0x76, 0xf9, 0xff, 0xdb, 0xda, 0x70, 0x01, 0xc2, 0x2e, 0x15, 0x9b, 0x40, 0x26, 0x31, 0xf2, 0x77, 0xca, 0x96, 0xf2, 0xde, 0xfd, 0xf1, 0x07, 0x82, 0x82, 0x31, 0x4e, 0x76, 0x36, 0x99, 0xa3, 0x1c, 0x53, 0x63, 0x16, 0x54, 0x21, 0xcc, 0xe1, 0x4d }, { 0x92, 0xb2, 0xb7, 0x56, 0x04, 0xed, 0x3c, 0x76, 0x1f, 0x9d, 0x6f, 0x62, 0x39, 0x2c, 0x8a, 0x92, 0x27, 0xad, 0x0e, 0xa3, 0xf0, 0x95, 0x73, 0xe7, 0x83, 0xf1, 0x49, 0x8a, 0x4e, 0xd6, 0x0d, 0x26, 0xb1, 0x81, 0x71, 0xa2, 0xf2, 0x2a, 0x4b, 0x94, 0x82, 0x2c, 0x70, 0x1f, 0x10, 0x71, 0x53, 0xdb, 0xa2, 0x49, 0x18, 0xc4, 0xba, 0xe4, 0xd2, 0x94, 0x5c, 0x20, 0xec, 0xe1, 0x33, 0x87, 0x62, 0x7d, 0x3b, 0x73, 0xcb, 0xf9, 0x7b, 0x79, 0x7d, 0x5e, 0x59, 0x94, 0x8c, 0x7e, 0xf7, 0x88, 0xf5, 0x43, 0x72, 0xdf, 0x45, 0xe4, 0x5e, 0x42, 0x93, 0xc7, 0xdc, 0x18, 0xc1, 0xd4, 0x11, 0x44, 0xa9, 0x75, 0x8b, 0xe5, 0x89, 0x60, 0x85, 0x6b, 0xe1, 0xea, 0xbb, 0xe2, 0x2c, 0x26, 0x53, 0x19, 0x0d, 0xe5, 0x60, 0xca, 0x3b, 0x2a, 0xc4, 0xaa, 0x69, 0x2a, 0x92, 0x10, 0x69, 0x42, 0x54, 0xc3, 0x71, 0xe8, 0x51, 0xbc, 0x8f } },
+	{ 1, { 0x2d, 0x3a, 0xde, 0xdf, 0xf1, 0x1b, 0x61, 0xf1, 0x4c, 0x88, 0x6e, 0x35, 0xaf, 0xa0, 0x36, 0x73, 0x6d, 0xcd, 0x87, 0xa7, 0x4d, 0x27, 0xb5, 0xc1, 0x51, 0x02, 0x25, 0xd0, 0xf5, 0x92, 0xe2, 0x13, 0xc3, 0xa6, 0xcb, 0x8b, 0xf6, 0x23, 0xe2, 0x0c, 0xdb, 0x53, 0x5f, 0x8d, 0x1a, 0x5f, 0xfb, 0x86, 0x34, 0x2d, 0x9c, 0x0b, 0x64, 0xac, 0xa3, 0xbc, 0xe1, 0xd3, 0x1f, 0x60, 0xad, 0xfa, 0x13, 0x7b, 0x35, 0x8a, 0xd4, 0xd7, 0x9f, 0x97, 0xb4, 0x7c, 0x3d, 0x5e, 0x79, 0xf1, 0x79, 0xdf, 0x87, 0xa3, 0xb9, 0x77, 0x6e, 0xf8, 0x32, 0x5f, 0x83, 0x29, 0x88, 0x6b, 0xa4, 0x2f, 0x07, 0xfb, 0x13, 0x8b, 0xb5, 0x02, 0xf4, 0x08, 0x1c, 0xbc, 0xec, 0x31, 0x95, 0xc5, 0x87, 0x1e, 0x6c, 0x23, 0xe2, 0xcc, 0x97, 0xd3, 0xc6, 0x9a, 0x61, 0x3e, 0xba, 0x13, 0x1e, 0x5f, 0x13, 0x51, 0xf3, 0xf1, 0xda, 0x78, 0x65, 0x45, 0xe5 }, { 0x6d, 0x78, 0x78, 0xdf, 0xff, 0x2f, 0x48, 0x56, 0x35, 0xd3, 0x90, 0x13, 0x27, 0x8a, 0xe1, 0x4f, 0x14, 0x54, 0xb8, 0xc0, 0xa3, 0xa2, 0xd3, 0x4b, 0xc1, 0xab, 0x38, 0x22, 0x8a, 0x80, 0xc9, 0x5b, 0x65, 0x68, 0xc0, 0x49, 0x06, 0x09, 0x41, 0x30, 0x06, 0xfb, 0xd4, 0x28, 0xeb, 0x3f, 0xd1, 0x4e, 0x77, 0x56, 0xd9, 0x0f, 0x73, 0xa4, 0x72, 0x5f, 0xad, 0x14, 0x7f, 0x7b, 0xf7, 0x0f, 0xd6, 0x1c, 0x4e, 0x0c, 0xf7, 0x07, 0x48, 0x85, 0xe9, 0x2b, 0x0e, 0x3f, 0x12, 0x59, 0x78, 0xb4, 0x15, 0x49, 0x86, 0xd4, 0xfb, 0x20, 0x2a, 0x3f, 0x33, 0x1a, 0x3f, 0xb6, 0xcf, 0x34, 0x9a, 0x3a, 0x70, 0xe4, 0x99, 0x90, 0xf9, 0x8f, 0xe4, 0x28, 0x97, 0x61, 0xc8, 0x60, 0x2c, 0x4e, 0x6a, 0xb1, 0x13, 0x8d, 0x31, 0xd3, 0xb6, 0x22, 0x18, 0x07, 0x8b, 0x2f, 0x3b, 0xa9, 0xa8, 0x8e, 0x1d, 0x08, 0xd0, 0xdd, 0x4c, 0xea, 0x11 } },
+	{ 1023, { 0x10, 0x10, 0x89, 0x70, 0xee, 0xda, 0x3e, 0xb9, 0x32, 0xba, 0xac, 0x14, 0x28, 0xc7, 0xa2, 0x16, 0x3b, 0x0e, 0x92, 0x4c, 0x9a, 0x9e, 0x25, 0xb3, 0x5b, 0xba, 0x72, 0xb2, 0x8f, 0x70, 0xbd, 0x11, 0xa1, 0x82, 0xd2, 0x7a, 0x59, 0x1b, 0x05, 0x59, 0x2b, 0x15, 0x60, 0x75, 0x00, 0xe1, 0xe8, 0xdd, 0x56, 0xbc, 0x6c, 0x7f, 0xc0, 0x63, 0x71, 0x5b, 0x7a, 0x1d, 0x73, 0x7d, 0xf5, 0xba, 0xd3, 0x33, 0x9c, 0x56, 0x77, 0x89, 0x57, 0xd8, 0x70, 0xeb, 0x97, 0x17, 0xb5, 0x7e, 0xa3, 0xd9, 0xfb, 0x68, 0xd1, 0xb5, 0x51, 0x27, 0xbb, 0xa6, 0xa9, 0x06, 0xa4, 0xa2, 0x4b, 0xbd, 0x5a, 0xcb, 0x2d, 0x12, 0x3a, 0x37, 0xb2, 0x8f, 0x9e, 0x9a, 0x81, 0xbb, 0xaa, 0xe3, 0x60, 0xd5, 0x8f, 0x85, 0xe5, 0xfc, 0x9d, 0x75, 0xf7, 0xc3, 0x70, 0xa0, 0xcc, 0x09, 0xb6, 0x52, 0x2d, 0x9c, 0x8d, 0x82, 0x2f, 0x2f, 0x28, 0xf4, 0x85 }, { 0xc9, 0x51, 0xec, 0xdf, 0x03, 0x28, 0x8d, 0x0f, 0xcc, 0x96, 0xee, 0x34, 0x13, 0x56, 0x3d, 0x8a, 0x6d, 0x35, 0x89, 0x54, 0x7f, 0x2c, 0x2f, 0xb3, 0x6d, 0x97, 0x86, 0x47, 0x0f, 0x1b, 0x9d, 0x6e, 0x89, 0x03, 0x16, 0xd2, 0xe6, 0xd8, 0xb8, 0xc2, 0x5b, 0x0a, 0x5b, 0x21, 0x80, 0xf9, 0x4f, 0xb1, 0xa1, 0x58, 0xef, 0x50, 0x8c, 0x3c, 0xde, 0x45, 0xe2, 0x96, 0x6b, 0xd7, 0x96, 0xa6, 0x96, 0xd3, 0xe1, 0x3e, 0xfd, 0x86, 0x25, 0x9d, 0x75, 0x63, 0x87, 0xd9, 0xbe, 0xcf, 0x5c, 0x8b, 0xf1, 0xce, 0x21, 0x92, 0xb8, 0x70, 0x25, 0x15, 0x29, 0x07, 0xb6, 0xd8, 0xcc, 0x33, 0xd1, 0x78, 0x26, 0xd8, 0xb7, 0xb9, 0xbc, 0x97, 0xe3, 0x8c, 0x3c, 0x85, 0x10, 0x8e, 0xf0, 0x9f, 0x01, 0x3e, 0x01, 0xc2, 0x29, 0xc2, 0x0a, 0x83, 0xd9, 0xe8, 0xef, 0xac, 0x5b, 0x37, 0x47, 0x0d, 0xa2, 0x85, 0x75, 0xfd, 0x75, 0x5a, 0x10 } },
+	{ 1024, { 0x42, 0x21, 0x47, 0x39, 0xf0, 0x95, 0xa4, 0x06, 0xf3, 0xfc, 0x83, 0xde, 0xb8, 0x89, 0x74, 0x4a, 0xc0, 0x0d, 0xf8, 0x31, 0xc1, 0x0d, 0xaa, 0x55, 0x18, 0x9b, 0x5d, 0x12, 0x1c, 0x85, 0x5a, 0xf7, 0x1c, 0xf8, 0x10, 0x72, 0x65, 0xec, 0xda, 0xf8, 0x50, 0x5b, 0x95, 0xd8, 0xfc, 0xec, 0x83, 0xa9, 0x8a, 0x6a, 0x96, 0xea, 0x51, 0x09, 0xd2, 0xc1, 0x79, 0xc4, 0x7a, 0x38, 0x7f, 0xfb, 0xb4, 0x04, 0x75, 0x6f, 0x6e, 0xea, 0xe7, 0x88, 0x3b, 0x44, 0x6b, 0x70, 0xeb, 0xb1, 0x44, 0x52, 0x7c, 0x20, 0x75, 0xab, 0x8a, 0xb2, 0x04, 0xc0, 0x08, 0x6b, 0xb2, 0x2b, 0x7c, 0x93, 0xd4, 0x65, 0xef, 0xc5, 0x7f, 0x8d, 0x91, 0x7f, 0x0b, 0x38, 0x5c, 0x6d, 0xf2, 0x65, 0xe7, 0x70, 0x03, 0xb8, 0x51, 0x02, 0x96, 0x74, 0x86, 0xed, 0x57, 0xdb, 0x5c, 0x5c, 0xa1, 0x70, 0xba, 0x44, 0x14, 0x27, 0xed, 0x9a, 0xfa, 0x68, 0x4e }, { 0x75, 0xc4, 0x6f, 0x6f, 0x3d, 0x9e, 0xb4, 0xf5, 0x5e, 0xca, 0xae, 0xe4, 0x80, 0xdb, 0x73, 0x2e, 0x6c, 0x21, 0x05, 0x54, 0x6f, 0x1e, 0x67, 0x50, 0x03, 0x68, 0x7c, 0x31, 0x71, 0x9c, 0x7b, 0xa4, 0xa7, 0x8b, 0xc8, 0x38, 0xc7, 0x28, 0x52, 0xd4, 0xf4, 0x9c, 0x86, 0x4a, 0xcb, 0x7a, 0xda, 0xfe, 0x24, 0x78, 0xe8, 0x24, 0xaf, 0xe5, 0x1c, 0x89, 0x19, 0xd0, 0x61, 0x68, 0x41, 0x4c, 0x26, 0x5f, 0x29, 0x8a, 0x80, 0x94, 0xb1, 0xad, 0x81, 0x3a, 0x9b, 0x86, 0x14, 0xac, 0xab, 0xac, 0x32, 0x1f, 0x24, 0xce, 0x61, 0xc5, 0xa5, 0x34, 0x6e, 0xb5, 0x19, 0x52, 0x0d, 0x38, 0xec, 0xc4, 0x3e, 0x89, 0xb5, 0x00, 0x02, 0x36, 0xdf, 0x05, 0x97, 0x24, 0x3e, 0x4d, 0x24, 0x93, 0xfd, 0x62, 0x67, 0x30, 0xe2, 0xba, 0x17, 0xac, 0x4d, 0x88, 0x24, 0xd0, 0x9d, 0x1a, 0x4a, 0x8f, 0x57, 0xb8, 0x22, 0x77, 0x78, 0xe2, 0xde } },
+	{ 1025, { 0xd0, 0x02, 0x78, 0xae, 0x47, 0xeb, 0x27, 0xb3, 0x4f, 0xae, 0xcf, 0x67, 0xb4, 0xfe, 0x26, 0x3f, 0x82, 0xd5, 0x41, 0x29, 0x16, 0xc1, 0xff, 0xd9, 0x7c, 0x8c, 0xb7, 0xfb, 0x81, 0x4b, 0x84, 0x44, 0xf4, 0xc4, 0xa2, 0x2b, 0x4b, 0x39, 0x91, 0x55, 0x35, 0x8a, 0x99, 0x4e, 0x52, 0xbf, 0x25, 0x5d, 0xe6, 0x00, 0x35, 0x74, 0x2e, 0xc7, 0x1b, 0xd0, 0x8a, 0xc2, 0x75, 0xa1, 0xb5, 0x1c, 0xc6, 0xbf, 0xe3, 0x32, 0xb0, 0xef, 0x84, 0xb4, 0x09, 0x10, 0x8c, 0xda, 0x08, 0x0e, 0x62, 0x69, 0xed, 0x4b, 0x3e, 0x2c, 0x3f, 0x7d, 0x72, 0x2a, 0xa4, 0xcd, 0xc9, 0x8d, 0x16, 0xde, 0xb5, 0x54, 0xe5, 0x62, 0x7b, 0xe8, 0xf9, 0x55, 0xc9, 0x8e, 0x1d, 0x5f, 0x95, 0x65, 0xa9, 0x19, 0x4c, 0xad, 0x0c, 0x42, 0x85, 0xf9, 0x37, 0x00, 0x06, 0x2d, 0x95, 0x95, 0xad, 0xb9, 0x92, 0xae, 0x68, 0xff, 0x12, 0x80, 0x0a, 0xb6, 0x7a }, { 0x35, 0x7d, 0xc5, 0x5d, 0xe0, 0xc7, 0xe3, 0x82, 0xc9, 0x00, 0xfd, 0x6e, 0x32, 0x0a, 0xcc, 0x04, 0x14, 0x6b, 0xe0, 0x1d, 0xb6, 0xa8, 0xce, 0x72, 0x10, 0xb7, 0x18, 0x9b, 0xd6, 0x64, 0xea, 0x69, 0x36, 0x23, 0x96, 0xb7, 0x7f, 0xdc, 0x0d, 0x26, 0x34, 0xa5, 0x52, 0x97, 0x08, 0x43, 0x72, 0x20, 0x66, 0xc3, 0xc1, 0x59, 0x02, 0xae, 0x50, 0x97, 0xe0, 0x0f, 0xf5, 0x3f, 0x1e, 0x11, 0x6f, 0x1c, 0xd5, 0x35, 0x27, 0x20, 0x11, 0x3a, 0x83, 0x7a, 0xb2, 0x45, 0x2c, 0xaf, 0xbd, 0xe4, 0xd5, 0x40, 0x85, 0xd9, 0xcf, 0x5d, 0x21, 0xca, 0x61, 0x30, 0x71, 0x55, 0x1b, 0x25, 0xd5, 0x2e, 0x69, 0xd6, 0xc8, 0x11, 0x23, 0x87, 0x2b, 0x6f, 0x19, 0xcd, 0x3b, 0xc1, 0x33, 0x3e, 0xdf, 0x0c, 0x52, 0xb9, 0x4d, 0xe2, 0x3b, 0xa7, 0x72, 0xcf, 0x82, 0x63, 0x6c, 0xff, 0x45, 0x42, 0x54, 0x0a, 0x77, 0x38, 0xd5, 0xb9, 0x30 } },
+	{ 2048, { 0xe7, 0x76, 0xb6, 0x02, 0x8c, 0x7c, 0xd2, 0x2a, 0x4d, 0x0b, 0xa1, 0x82, 0xa8, 0xbf, 0x62, 0x20, 0x5d, 0x2e, 0xf5, 0x76, 0x46, 0x7e, 0x83, 0x8e, 0xd6, 0xf2, 0x52, 0x9b, 0x85, 0xfb, 0xa2, 0x4a, 0x9a, 0x60, 0xbf, 0x80, 0x00, 0x14, 0x10, 0xec, 0x9e, 0xea, 0x66, 0x98, 0xcd, 0x53, 0x79, 0x39, 0xfa, 0xd4, 0x74, 0x9e, 0xdd, 0x48, 0x4c, 0xb5, 0x41, 0xac, 0xed, 0x55, 0xcd, 0x9b, 0xf5, 0x47, 0x64, 0xd0, 0x63, 0xf2, 0x3f, 0x6f, 0x1e, 0x32, 0xe1, 0x29, 0x58, 0xba, 0x5c, 0xfe, 0xb1, 0xbf, 0x61, 0x8a, 0xd0, 0x94, 0x26, 0x6d, 0x4f, 0xc3, 0xc9, 0x68, 0xc2, 0x08, 0x8f, 0x67, 0x74, 0x54, 0xc2, 0x88, 0xc6, 0x7b, 0xa0, 0xdb, 0xa3, 0x37, 0xb9, 0xd9, 0x1c, 0x7e, 0x1b, 0xa5, 0x86, 0xdc, 0x9a, 0x5b, 0xc2, 0xd5, 0xe9, 0x0c, 0x14, 0xf5, 0x3a, 0x88, 0x63, 0xac, 0x75, 0x65, 0x54, 0x61, 0xce, 0xa8, 0xf9 }, { 0x87, 0x9c, 0xf1, 0xfa, 0x2e, 0xa0, 0xe7, 0x91, 0x26, 0xcb, 0x10, 0x63, 0x61, 0x7a, 0x05, 0xb6, 0xad, 0x9d, 0x0b, 0x69, 0x6d, 0x0d, 0x75, 0x7c, 0xf0, 0x53, 0x43, 0x9f, 0x60, 0xa9, 0x9d, 0xd1, 0x01, 0x73, 0xb9, 0x61, 0xcd, 0x57, 0x42, 0x88, 0x19, 0x4b, 0x23, 0xec, 0xe2, 0x78, 0xc3, 0x30, 0xfb, 0xb8, 0x58, 0x54, 0x85, 0xe7, 0x49, 0x67, 0xf3, 0x13, 0x52, 0xa8, 0x18, 0x3a, 0xa7, 0x82, 0xb2, 0xb2, 0x2f, 0x26, 0xcd, 0xca, 0xdb, 0x61, 0xee, 0xd1, 0xa5, 0xbc, 0x14, 0x4b, 0x81, 0x98, 0xfb, 0xb0, 0xc1, 0x3a, 0xbb, 0xf8, 0xe3, 0x19, 0x2c, 0x14, 0x5d, 0x0a, 0x5c, 0x21, 0x63, 0x3b, 0x0e, 0xf8, 0x60, 0x54, 0xf4, 0x28, 0x09, 0xdf, 0x82, 0x33, 0x89, 0xee, 0x40, 0x81, 0x1a, 0x59, 0x10, 0xdc, 0xbd, 0x10, 0x18, 0xaf, 0x31, 0xc3, 0xb4, 0x3a, 0xa5, 0x52, 0x01, 0xed, 0x4e, 0xda, 0xac, 0x74, 0xfe } },
+	{ 2049, { 0x5f, 0x4d, 0x72, 0xf4, 0x0d, 0x7a, 0x5f, 0x82, 0xb1, 0x5c, 0xa2, 0xb2, 0xe4, 0x4b, 0x1d, 0xe3, 0xc2, 0xef, 0x86, 0xc4, 0x26, 0xc9, 0x5c, 0x1a, 0xf0, 0xb6, 0x87, 0x95, 0x22, 0x56, 0x30, 0x30, 0x96, 0xde, 0x31, 0xd7, 0x1d, 0x74, 0x10, 0x34, 0x03, 0x82, 0x2a, 0x2e, 0x0b, 0xc1, 0xeb, 0x19, 0x3e, 0x7a, 0xec, 0xc9, 0x64, 0x3a, 0x76, 0xb7, 0xbb, 0xc0, 0xc9, 0xf9, 0xc5, 0x2e, 0x87, 0x83, 0xaa, 0xe9, 0x87, 0x64, 0xca, 0x46, 0x89, 0x62, 0xb5, 0xc2, 0xec, 0x92, 0xf0, 0xc7, 0x4e, 0xb5, 0x44, 0x8d, 0x51, 0x97, 0x13, 0xe0, 0x94, 0x13, 0x71, 0x94, 0x31, 0xc8, 0x02, 0xf9, 0x48, 0xdd, 0x5d, 0x90, 0x42, 0x5a, 0x4e, 0xcd, 0xad, 0xec, 0xe9, 0xeb, 0x17, 0x8d, 0x80, 0xf2, 0x6e, 0xfc, 0xca, 0xe6, 0x30, 0x73, 0x4d, 0xff, 0x63, 0x34, 0x02, 0x85, 0xad, 0xec, 0x2a, 0xed, 0x3b, 0x51, 0x07, 0x3a, 0xd3 }, { 0x9f, 0x29, 0x70, 0x09, 0x02, 0xf7, 0xc8, 0x6e, 0x51, 0x4d, 0xdc, 0x4d, 0xf1, 0xe3, 0x04, 0x9f, 0x25, 0x8b, 0x24, 0x72, 0xb6, 0xdd, 0x52, 0x67, 0xf6, 0x1b, 0xf1, 0x39, 0x83, 0xb7, 0x8d, 0xd5, 0xf9, 0xa8, 0x8a, 0xbf, 0xef, 0xdf, 0xa1, 0xe0, 0x0b, 0x41, 0x89, 0x71, 0xf2, 0xb3, 0x9c, 0x64, 0xca, 0x62, 0x1e, 0x8e, 0xb3, 0x7f, 0xce, 0xac, 0x57, 0xfd, 0x0c, 0x8f, 0xc8, 0xe1, 0x17, 0xd4, 0x3b, 0x81, 0x44, 0x7b, 0xe2, 0x2d, 0x5d, 0x81, 0x86, 0xf8, 0xf5, 0x91, 0x9b, 0xa6, 0xbc, 0xc6, 0x84, 0x6b, 0xd7, 0xd5, 0x07, 0x26, 0xc0, 0x6d, 0x24, 0x56, 0x72, 0xc2, 0xad, 0x4f, 0x61, 0x70, 0x2c, 0x64, 0x64, 0x99, 0xee, 0x11, 0x73, 0xda, 0xa0, 0x61, 0xff, 0xe1, 0x5b, 0xf4, 0x5a, 0x63, 0x1e, 0x29, 0x46, 0xd6, 0x16, 0xa4, 0xc3, 0x45, 0x82, 0x2f, 0x11, 0x51, 0x28, 0x47, 0x12, 0xf7, 0x6b, 0x2b, 0x0e } },
+	{ 3072, { 0xb9, 0x8c, 0xb0, 0xff, 0x36, 0x23, 0xbe, 0x03, 0x32, 0x6b, 0x37, 0x3d, 0xe6, 0xb9, 0x09, 0x52, 0x18, 0x51, 0x3e, 0x64, 0xf1, 0xee, 0x2e, 0xdd, 0x25, 0x25, 0xc7, 0xad, 0x1e, 0x5c, 0xff, 0xd2, 0x9a, 0x3f, 0x6b, 0x0b, 0x97, 0x8d, 0x66, 0x08, 0x33, 0x5c, 0x09, 0xdc, 0x94, 0xcc, 0xf6, 0x82, 0xf9, 0x95, 0x1c, 0xdf, 0xc5, 0x01, 0xbf, 0xe4, 0x7b, 0x9c, 0x91, 0x89, 0xa6, 0xfc, 0x7b, 0x40, 0x4d, 0x12, 0x02, 0x58, 0x50, 0x63, 0x41, 0xa6, 0xd8, 0x02, 0x85, 0x73, 0x22, 0xfb, 0xd2, 0x0d, 0x3e, 0x5d, 0xae, 0x05, 0xb9, 0x5c, 0x88, 0x79, 0x3f, 0xa8, 0x3d, 0xb1, 0xcb, 0x08, 0xe7, 0xd8, 0x00, 0x8d, 0x15, 0x99, 0xb6, 0x20, 0x9d, 0x78, 0x33, 0x6e, 0x24, 0x83, 0x97, 0x24, 0xc1, 0x91, 0xb2, 0xa5, 0x2a, 0x80, 0x44, 0x83, 0x06, 0xe0, 0xda, 0xa8, 0x4a, 0x3f, 0xdb, 0x56, 0x66, 0x61, 0xa3, 0x7e, 0x11 }, { 0x04, 0x4a, 0x0e, 0x7b, 0x17, 0x2a, 0x31, 0x2d, 0xc0, 0x2a, 0x4c, 0x9a, 0x81, 0x8c, 0x03, 0x6f, 0xfa, 0x27, 0x76, 0x36, 0x8d, 0x7f, 0x52, 0x82, 0x68, 0xd2, 0xe6, 0xb5, 0xdf, 0x19, 0x17, 0x70, 0x22, 0xf3, 0x02, 0xd0, 0x52, 0x9e, 0x41, 0x74, 0xcc, 0x50, 0x7c, 0x46, 0x36, 0x71, 0x21, 0x79, 0x75, 0xe8, 0x1d, 0xab, 0x02, 0xb8, 0xfd, 0xeb, 0x0d, 0x7c, 0xcc, 0x75, 0x68, 0xdd, 0x22, 0x57, 0x4c, 0x78, 0x3a, 0x76, 0xbe, 0x21, 0x54, 0x41, 0xb3, 0x2e, 0x91, 0xb9, 0xa9, 0x04, 0xbe, 0x8e, 0xa8, 0x1f, 0x7a, 0x0a, 0xfd, 0x14, 0xba, 0xd8, 0xee, 0x7c, 0x8e, 0xfc, 0x30, 0x5a, 0xce, 0x5d, 0x3d, 0xd6, 0x1b, 0x99, 0x6f, 0xeb, 0xe8, 0xda, 0x4f, 0x56, 0xca, 0x09, 0x19, 0x35, 0x9a, 0x75, 0x33, 0x21, 0x6e, 0x29, 0x99, 0xfc, 0x87, 0xff, 0x7d, 0x8f, 0x17, 0x6f, 0xbe, 0xcb, 0x3d, 0x6f, 0x34, 0x27, 0x8b } },
+	{ 3073, { 0x71, 0x24, 0xb4, 0x95, 0x01, 0x01, 0x2f, 0x81, 0xcc, 0x7f, 0x11, 0xca, 0x06, 0x9e, 0xc9, 0x22, 0x6c, 0xec, 0xb8, 0xa2, 0xc8, 0x50, 0xcf, 0xe6, 0x44, 0xe3, 0x27, 0xd2, 0x2d, 0x3e, 0x1c, 0xd3, 0x9a, 0x27, 0xae, 0x3b, 0x79, 0xd6, 0x8d, 0x89, 0xda, 0x9b, 0xf2, 0x5b, 0xc2, 0x71, 0x39, 0xae, 0x65, 0xa3, 0x24, 0x91, 0x8a, 0x5f, 0x9b, 0x78, 0x28, 0x18, 0x1e, 0x52, 0xcf, 0x37, 0x3c, 0x84, 0xf3, 0x5b, 0x63, 0x9b, 0x7f, 0xcc, 0xbb, 0x98, 0x5b, 0x6f, 0x2f, 0xa5, 0x6a, 0xea, 0x0c, 0x18, 0xf5, 0x31, 0x20, 0x34, 0x97, 0xb8, 0xbb, 0xd3, 0xa0, 0x7c, 0xeb, 0x59, 0x26, 0xf1, 0xca, 0xb7, 0x4d, 0x14, 0xbd, 0x66, 0x48, 0x6d, 0x9a, 0x91, 0xeb, 0xa9, 0x90, 0x59, 0xa9, 0x8b, 0xd1, 0xcd, 0x25, 0x87, 0x6b, 0x2a, 0xf5, 0xa7, 0x6c, 0x3e, 0x9e, 0xed, 0x55, 0x4e, 0xd7, 0x2e, 0xa9, 0x52, 0xb6, 0x03, 0xbf }, { 0x68, 0xde, 0xde, 0x9b, 0xef, 0x00, 0xba, 0x89, 0xe4, 0x3f, 0x31, 0xa6, 0x82, 0x5f, 0x4c, 0xf4, 0x33, 0x38, 0x9f, 0xed, 0xae, 0x75, 0xc0, 0x4e, 0xe9, 0xf0, 0xcf, 0x16, 0xa4, 0x27, 0xc9, 0x5a, 0x96, 0xd6, 0xda, 0x3f, 0xe9, 0x85, 0x05, 0x4d, 0x34, 0x78, 0x86, 0x5b, 0xe9, 0xa0, 0x92, 0x25, 0x08, 0x39, 0xa6, 0x97, 0xbb, 0xda, 0x74, 0xe2, 0x79, 0xe8, 0xa9, 0xe6, 0x9f, 0x00, 0x25, 0xe4, 0xcf, 0xdd, 0xd6, 0xcf, 0xb4, 0x34, 0xb1, 0xcd, 0x95, 0x43, 0xaa, 0xf9, 0x7c, 0x63, 0x5d, 0x1b, 0x45, 0x1a, 0x43, 0x86, 0x04, 0x1e, 0x4b, 0xb1, 0x00, 0xf5, 0xe4, 0x54, 0x07, 0xcb, 0xbc, 0x24, 0xfa, 0x53, 0xea, 0x2d, 0xe3, 0x53, 0x6c, 0xcb, 0x32, 0x9e, 0x4e, 0xb9, 0x46, 0x6e, 0xc3, 0x70, 0x93, 0xa4, 0x2c, 0xf6, 0x2b, 0x82, 0x90, 0x3c, 0x69, 0x6a, 0x93, 0xa5, 0x0b, 0x70, 0x2c, 0x80, 0xf3, 0xc3, 0xc5 } },
+	{ 4096, { 0x01, 0x50, 0x94, 0x01, 0x3f, 0x57, 0xa5, 0x27, 0x7b, 0x59, 0xd8, 0x47, 0x5c, 0x05, 0x01, 0x04, 0x2c, 0x0b, 0x64, 0x2e, 0x53, 0x1b, 0x0a, 0x1c, 0x8f, 0x58, 0xd2, 0x16, 0x32, 0x29, 0xe9, 0x69, 0x02, 0x89, 0xe9, 0x40, 0x9d, 0xdb, 0x1b, 0x99, 0x76, 0x8e, 0xaf, 0xe1, 0x62, 0x3d, 0xa8, 0x96, 0xfa, 0xf7, 0xe1, 0x11, 0x4b, 0xeb, 0xea, 0xdc, 0x1b, 0xe3, 0x08, 0x29, 0xb6, 0xf8, 0xaf, 0x70, 0x7d, 0x85, 0xc2, 0x98, 0xf4, 0xf0, 0xff, 0x4d, 0x94, 0x38, 0xae, 0xf9, 0x48, 0x33, 0x56, 0x12, 0xae, 0x92, 0x1e, 0x76, 0xd4, 0x11, 0xc3, 0xa9, 0x11, 0x1d, 0xf6, 0x2d, 0x27, 0xea, 0xf8, 0x71, 0x95, 0x9a, 0xe0, 0x06, 0x2b, 0x54, 0x92, 0xa0, 0xfe, 0xb9, 0x8e, 0xf3, 0xed, 0x4a, 0xf2, 0x77, 0xf5, 0x39, 0x51, 0x72, 0xdb, 0xe5, 0xc3, 0x11, 0x91, 0x8e, 0xa0, 0x07, 0x4c, 0xe0, 0x03, 0x64, 0x54, 0xf6, 0x20 }, { 0xbe, 0xfc, 0x66, 0x0a, 0xea, 0x2f, 0x17, 0x18, 0x88, 0x4c, 0xd8, 0xde, 0xb9, 0x90, 0x28, 0x11, 0xd3, 0x32, 0xf4, 0xfc, 0x4a, 0x38, 0xcf, 0x7c, 0x73, 0x00, 0xd5, 0x97, 0xa0, 0x81, 0xbf, 0xc0, 0xbb, 0xb6, 0x4a, 0x36, 0xed, 0xb5, 0x64, 0xe0, 0x1e, 0x4b, 0x4a, 0xaf, 0x3b, 0x06, 0x00, 0x92, 0xa6, 0xb8, 0x38, 0xbe, 0xa4, 0x4a, 0xfe, 0xbd, 0x2d, 0xeb, 0x82, 0x98, 0xfa, 0x56, 0x2b, 0x7b, 0x59, 0x7c, 0x75, 0x7b, 0x9d, 0xf4, 0xc9, 0x11, 0xc3, 0xca, 0x46, 0x2e, 0x2a, 0xc8, 0x9e, 0x9a, 0x78, 0x73, 0x57, 0xaa, 0xf7, 0x4c, 0x3b, 0x56, 0xd5, 0xc0, 0x7b, 0xc9, 0x3c, 0xe8, 0x99, 0x56, 0x8a, 0x3e, 0xb1, 0x7d, 0x92, 0x50, 0xc2, 0x0f, 0x6c, 0x5f, 0x6c, 0x1e, 0x79, 0x2e, 0xc9, 0xa2, 0xdc, 0xb7, 0x15, 0x39, 0x8d, 0x5a, 0x6e, 0xc6, 0xd5, 0xc5, 0x4f, 0x58, 0x6a, 0x00, 0x40, 0x3a, 0x1a, 0xf1, 0xde } },
+	{ 4097, { 0x9b, 0x40, 0x52, 0xb3, 0x8f, 0x1c, 0x5f, 0xc8, 0xb1, 0xf9, 0xff, 0x7a, 0xc7, 0xb2, 0x7c, 0xd2, 0x42, 0x48, 0x7b, 0x3d, 0x89, 0x0d, 0x15, 0xc9, 0x6a, 0x1c, 0x25, 0xb8, 0xaa, 0x0f, 0xb9, 0x95, 0x05, 0xf9, 0x1b, 0x0b, 0x56, 0x00, 0xa1, 0x12, 0x51, 0x65, 0x2e, 0xac, 0xfa, 0x94, 0x97, 0xb3, 0x1c, 0xd3, 0xc4, 0x09, 0xce, 0x2e, 0x45, 0xcf, 0xe6, 0xc0, 0xa0, 0x16, 0x96, 0x73, 0x16, 0xc4, 0x26, 0xbd, 0x26, 0xf6, 0x19, 0xea, 0xb5, 0xd7, 0x0a, 0xf9, 0xa4, 0x18, 0xb8, 0x45, 0xc6, 0x08, 0x84, 0x03, 0x90, 0xf3, 0x61, 0x63, 0x0b, 0xd4, 0x97, 0xb1, 0xab, 0x44, 0x01, 0x93, 0x16, 0x35, 0x7c, 0x61, 0xdb, 0xe0, 0x91, 0xce, 0x72, 0xfc, 0x16, 0xdc, 0x34, 0x0a, 0xc3, 0xd6, 0xe0, 0x09, 0xe0, 0x50, 0xb3, 0xad, 0xac, 0x4b, 0x5b, 0x2c, 0x92, 0xe7, 0x22, 0xcf, 0xfd, 0xc4, 0x65, 0x01, 0x53, 0x19, 0x56 }, { 0x00, 0xdf, 0x94, 0x0c, 0xd3, 0x6b, 0xb9, 0xfa, 0x7c, 0xbb, 0xc3, 0x55, 0x67, 0x44, 0xe0, 0xdb, 0xc8, 0x19, 0x14, 0x01, 0xaf, 0xe7, 0x05, 0x20, 0xba, 0x29, 0x2e, 0xe3, 0xca, 0x80, 0xab, 0xbc, 0x60, 0x6d, 0xb4, 0x97, 0x6c, 0xfd, 0xd2, 0x66, 0xae, 0x0a, 0xbf, 0x66, 0x7d, 0x94, 0x81, 0x83, 0x1f, 0xf1, 0x2e, 0x0c, 0xaa, 0x26, 0x8e, 0x7d, 0x3e, 0x57, 0x26, 0x0c, 0x08, 0x24, 0x11, 0x5a, 0x54, 0xce, 0x59, 0x5c, 0xcc, 0x89, 0x77, 0x86, 0xd9, 0xdc, 0xbf, 0x49, 0x55, 0x99, 0xcf, 0xd9, 0x01, 0x57, 0x18, 0x6a, 0x46, 0xec, 0x80, 0x0a, 0x67, 0x63, 0xf1, 0xc5, 0x9e, 0x36, 0x19, 0x7e, 0x99, 0x39, 0xe9, 0x00, 0x80, 0x9f, 0x70, 0x77, 0xc1, 0x02, 0xf8, 0x88, 0xca, 0xaf, 0x86, 0x4b, 0x25, 0x3b, 0xc4, 0x1e, 0xea, 0x81, 0x26, 0x56, 0xd4, 0x67, 0x42, 0xe4, 0xea, 0x42, 0x76, 0x9f, 0x89, 0xb8, 0x3f } },
+	{ 5120, { 0x9c, 0xad, 0xc1, 0x5f, 0xed, 0x8b, 0x5d, 0x85, 0x45, 0x62, 0xb2, 0x6a, 0x95, 0x36, 0xd9, 0x70, 0x7c, 0xad, 0xed, 0xa9, 0xb1, 0x43, 0x97, 0x8f, 0x31, 0x9a, 0xb3, 0x42, 0x30, 0x53, 0x58, 0x33, 0xac, 0xc6, 0x1c, 0x8f, 0xdc, 0x11, 0x4a, 0x20, 0x10, 0xce, 0x80, 0x38, 0xc8, 0x53, 0xe1, 0x21, 0xe1, 0x54, 0x49, 0x85, 0x13, 0x3f, 0xcc, 0xdd, 0x0a, 0x2d, 0x50, 0x7e, 0x8e, 0x61, 0x5e, 0x61, 0x1e, 0x9a, 0x0b, 0xa4, 0xf4, 0x79, 0x15, 0xf4, 0x9e, 0x53, 0xd7, 0x21, 0x81, 0x6a, 0x91, 0x98, 0xe8, 0xb3, 0x0f, 0x12, 0xd2, 0x0e, 0xc3, 0x68, 0x99, 0x89, 0x17, 0x5f, 0x1b, 0xf7, 0xa3, 0x00, 0xee, 0xe0, 0xd9, 0x32, 0x1f, 0xad, 0x8d, 0xa2, 0x32, 0xec, 0xe6, 0xef, 0xb8, 0xe9, 0xfd, 0x81, 0xb4, 0x2a, 0xd1, 0x61, 0xf6, 0xb9, 0x55, 0x0a, 0x06, 0x9e, 0x66, 0xb1, 0x1b, 0x40, 0x48, 0x7a, 0x5f, 0x50, 0x59 }, { 0x2c, 0x49, 0x3e, 0x48, 0xe9, 0xb9, 0xbf, 0x31, 0xe0, 0x55, 0x3a, 0x22, 0xb2, 0x35, 0x03, 0xc0, 0xa3, 0x38, 0x8f, 0x03, 0x5c, 0xec, 0xe6, 0x8e, 0xb4, 0x38, 0xd2, 0x2f, 0xa1, 0x94, 0x3e, 0x20, 0x9b, 0x4d, 0xc9, 0x20, 0x9c, 0xd8, 0x0c, 0xe7, 0xc1, 0xf7, 0xc9, 0xa7, 0x44, 0x65, 0x8e, 0x7e, 0x28, 0x84, 0x65, 0x71, 0x7a, 0xe6, 0xe5, 0x6d, 0x54, 0x63, 0xd4, 0xf8, 0x0c, 0xdb, 0x2e, 0xf5, 0x64, 0x95, 0xf6, 0xa4, 0xf5, 0x48, 0x7f, 0x69, 0x74, 0x9a, 0xf0, 0xc3, 0x4c, 0x2c, 0xdf, 0xa8, 0x57, 0xf3, 0x05, 0x6b, 0xf8, 0xd8, 0x07, 0x33, 0x6a, 0x14, 0xd7, 0xb8, 0x9b, 0xf6, 0x2b, 0xef, 0x2f, 0xb5, 0x4f, 0x9a, 0xf6, 0xa5, 0x46, 0xf8, 0x18, 0xdc, 0x1e, 0x98, 0xb9, 0xe0, 0x7f, 0x8a, 0x58, 0x34, 0xda, 0x50, 0xfa, 0x28, 0xfb, 0x58, 0x74, 0xaf, 0x91, 0xbf, 0x06, 0x02, 0x0d, 0x1b, 0xf0, 0x12, 0x0e } },
+	{ 5121, { 0x62, 0x8b, 0xd2, 0xcb, 0x20, 0x04, 0x69, 0x4a, 0xda, 0xab, 0x7b, 0xbd, 0x77, 0x8a, 0x25, 0xdf, 0x25, 0xc4, 0x7b, 0x9d, 0x41, 0x55, 0xa5, 0x5f, 0x8f, 0xbd, 0x79, 0xf2, 0xfe, 0x15, 0x4c, 0xff, 0x96, 0xad, 0xaa, 0xb0, 0x61, 0x3a, 0x61, 0x46, 0xcd, 0xaa, 0xbe, 0x49, 0x8c, 0x3a, 0x94, 0xe5, 0x29, 0xd3, 0xfc, 0x1d, 0xa2, 0xbd, 0x08, 0xed, 0xf5, 0x4e, 0xd6, 0x4d, 0x40, 0xdc, 0xd6, 0x77, 0x76, 0x47, 0xea, 0xc5, 0x1d, 0x82, 0x77, 0xd7, 0x02, 0x19, 0xa9, 0x69, 0x43, 0x34, 0xa6, 0x8b, 0xc8, 0xf0, 0xf2, 0x3e, 0x20, 0xb0, 0xff, 0x70, 0xad, 0xa6, 0xf8, 0x44, 0x54, 0x2d, 0xfa, 0x32, 0xcd, 0x42, 0x04, 0xca, 0x18, 0x46, 0xef, 0x76, 0xd8, 0x11, 0xcd, 0xb2, 0x96, 0xf6, 0x5e, 0x26, 0x02, 0x27, 0xf4, 0x77, 0xaa, 0x7a, 0xa0, 0x08, 0xba, 0xc8, 0x78, 0xf7, 0x22, 0x57, 0x48, 0x4f, 0x2b, 0x6c, 0x95 }, { 0x6c, 0xcf, 0x1c, 0x34, 0x75, 0x3e, 0x7a, 0x04, 0x4d, 0xb8, 0x07, 0x98, 0xec, 0xd0, 0x78, 0x2a, 0x8f, 0x76, 0xf3, 0x35, 0x63, 0xac, 0xca, 0xdd, 0xbf, 0xbb, 0x2e, 0x0e, 0xa4, 0xb2, 0xd0, 0x24, 0x0d, 0x07, 0xe6, 0x3f, 0x13, 0x66, 0x7a, 0x8d, 0x14, 0x90, 0xe5, 0xe0, 0x4f, 0x13, 0xeb, 0x61, 0x7a, 0xea, 0x16, 0xa8, 0xc8, 0xa5, 0xaa, 0xed, 0x1e, 0xf6, 0xfb, 0xde, 0x1b, 0x05, 0x15, 0xe3, 0xc8, 0x10, 0x50, 0xb3, 0x61, 0xaf, 0x6e, 0xad, 0x12, 0x60, 0x32, 0x99, 0x82, 0x90, 0xb5, 0x63, 0xe3, 0xca, 0xdd, 0xea, 0xeb, 0xfa, 0xb5, 0x92, 0xe1, 0x55, 0xf2, 0xe1, 0x61, 0xfb, 0x7c, 0xba, 0x93, 0x90, 0x92, 0x13, 0x3f, 0x23, 0xf9, 0xe6, 0x52, 0x45, 0xe5, 0x8e, 0xc2, 0x34, 0x57, 0xb7, 0x8a, 0x2e, 0x8a, 0x12, 0x55, 0x88, 0xaa, 0xd6, 0xe0, 0x7d, 0x7f, 0x11, 0xa8, 0x5b, 0x88, 0xd3, 0x75, 0xb7, 0x2d } },
+	{ 6144, { 0x3e, 0x2e, 0x5b, 0x74, 0xe0, 0x48, 0xf3, 0xad, 0xd6, 0xd2, 0x1f, 0xaa, 0xb3, 0xf8, 0x3a, 0xa4, 0x4d, 0x3b, 0x22, 0x78, 0xaf, 0xb8, 0x3b, 0x80, 0xb3, 0xc3, 0x51, 0x64, 0xeb, 0xec, 0xa2, 0x05, 0x4d, 0x74, 0x20, 0x22, 0xda, 0x6f, 0xdd, 0xa4, 0x44, 0xeb, 0xc3, 0x84, 0xb0, 0x4a, 0x54, 0xc3, 0xac, 0x58, 0x39, 0xb4, 0x9d, 0xa7, 0xd3, 0x9f, 0x6d, 0x8a, 0x9d, 0xb0, 0x3d, 0xea, 0xb3, 0x2a, 0xad, 0xe1, 0x56, 0xc1, 0xc0, 0x31, 0x1e, 0x9b, 0x34, 0x35, 0xcd, 0xe0, 0xdd, 0xba, 0x0d, 0xce, 0x7b, 0x26, 0xa3, 0x76, 0xca, 0xd1, 0x21, 0x29, 0x4b, 0x68, 0x91, 0x93, 0x50, 0x8d, 0xd6, 0x31, 0x51, 0x60, 0x3c, 0x6d, 0xdb, 0x86, 0x6a, 0xd1, 0x6c, 0x2e, 0xe4, 0x15, 0x85, 0xd1, 0x63, 0x3a, 0x2c, 0xea, 0x09, 0x3b, 0xea, 0x71, 0x4f, 0x4c, 0x5d, 0x6b, 0x90, 0x35, 0x22, 0x04, 0x5b, 0x20, 0x39, 0x5c, 0x83 }, { 0x3d, 0x6b, 0x6d, 0x21, 0x28, 0x1d, 0x0a, 0xde, 0x5b, 0x2b, 0x01, 0x6a, 0xe4, 0x03, 0x4c, 0x5d, 0xec, 0x10, 0xca, 0x7e, 0x47, 0x5f, 0x90, 0xf7, 0x6e, 0xac, 0x71, 0x38, 0xe9, 0xbc, 0x8f, 0x1d, 0xc3, 0x57, 0x54, 0x06, 0x00, 0x91, 0xdc, 0x5c, 0xaf, 0x3e, 0xfa, 0xbe, 0x06, 0x03, 0xc6, 0x0f, 0x45, 0xe4, 0x15, 0xbb, 0x34, 0x07, 0xdb, 0x67, 0xe6, 0xbe, 0xb3, 0xd1, 0x1c, 0xf8, 0xe4, 0xf7, 0x90, 0x75, 0x61, 0xf0, 0x5d, 0xac, 0xe0, 0xc1, 0x58, 0x07, 0xf4, 0xb5, 0xf3, 0x89, 0xc8, 0x41, 0xeb, 0x11, 0x4d, 0x81, 0xa8, 0x2c, 0x02, 0xa0, 0x0b, 0x57, 0x20, 0x6b, 0x1d, 0x11, 0xfa, 0x6e, 0x80, 0x34, 0x86, 0xb0, 0x48, 0xa5, 0xce, 0x87, 0x10, 0x5a, 0x68, 0x6d, 0xee, 0x04, 0x12, 0x07, 0xe0, 0x95, 0x32, 0x3d, 0xfe, 0x17, 0x2d, 0xf7, 0x3d, 0xeb, 0x8c, 0x95, 0x32, 0x06, 0x6d, 0x88, 0xf9, 0xda, 0x7e } },
+	{ 6145, { 0xf1, 0x32, 0x3a, 0x86, 0x31, 0x44, 0x6c, 0xc5, 0x05, 0x36, 0xa9, 0xf7, 0x05, 0xee, 0x5c, 0xb6, 0x19, 0x42, 0x4d, 0x46, 0x88, 0x7f, 0x3c, 0x37, 0x6c, 0x69, 0x5b, 0x70, 0xe0, 0xf0, 0x50, 0x7f, 0x18, 0xa2, 0xcf, 0xdd, 0x73, 0xc6, 0xe3, 0x9d, 0xd7, 0x5c, 0xe7, 0xc1, 0xc6, 0xe3, 0xef, 0x23, 0x8f, 0xd5, 0x44, 0x65, 0xf0, 0x53, 0xb2, 0x5d, 0x21, 0x04, 0x4c, 0xcb, 0x20, 0x93, 0xbe, 0xb0, 0x15, 0x01, 0x55, 0x32, 0xb1, 0x08, 0x31, 0x3b, 0x58, 0x29, 0xc3, 0x62, 0x1c, 0xe3, 0x24, 0xb8, 0xe1, 0x42, 0x29, 0x09, 0x1b, 0x7c, 0x93, 0xf3, 0x2d, 0xb2, 0xe4, 0xe6, 0x31, 0x26, 0xa3, 0x77, 0xd2, 0xa6, 0x3a, 0x35, 0x97, 0x99, 0x7d, 0x4f, 0x1c, 0xba, 0x59, 0x30, 0x9c, 0xb4, 0xaf, 0x24, 0x0b, 0xa7, 0x0c, 0xeb, 0xff, 0x9a, 0x23, 0xd5, 0xe3, 0xff, 0x0c, 0xda, 0xe2, 0xcf, 0xd5, 0x4e, 0x07, 0x00, 0x22 }, { 0x9a, 0xc3, 0x01, 0xe9, 0xe3, 0x9e, 0x45, 0xe3, 0x25, 0x0a, 0x7e, 0x3b, 0x3d, 0xf7, 0x01, 0xaa, 0x0f, 0xb6, 0x88, 0x9f, 0xbd, 0x80, 0xee, 0xec, 0xf2, 0x8d, 0xbc, 0x63, 0x00, 0xfb, 0xc5, 0x39, 0xf3, 0xc1, 0x84, 0xca, 0x2f, 0x59, 0x78, 0x0e, 0x27, 0xa5, 0x76, 0xc1, 0xd1, 0xfb, 0x97, 0x72, 0xe9, 0x9f, 0xd1, 0x78, 0x81, 0xd0, 0x2a, 0xc7, 0xdf, 0xd3, 0x96, 0x75, 0xac, 0xa9, 0x18, 0x45, 0x32, 0x83, 0xed, 0x8c, 0x31, 0x69, 0x08, 0x5e, 0xf4, 0xa4, 0x66, 0xb9, 0x1c, 0x16, 0x49, 0xcc, 0x34, 0x1d, 0xfd, 0xee, 0x60, 0xe3, 0x22, 0x31, 0xfc, 0x34, 0xc9, 0xc4, 0xe0, 0xb9, 0xa2, 0xba, 0x87, 0xca, 0x8f, 0x37, 0x25, 0x89, 0xc7, 0x44, 0xc1, 0x5f, 0xd6, 0xf9, 0x85, 0xee, 0xc1, 0x5e, 0x98, 0x13, 0x6f, 0x25, 0xbe, 0xeb, 0x4b, 0x13, 0xc4, 0xe4, 0x3d, 0xc8, 0x4a, 0xbc, 0xc7, 0x9c, 0xd4, 0x64, 0x6c } },
+	{ 7168, { 0x61, 0xda, 0x95, 0x7e, 0xc2, 0x49, 0x9a, 0x95, 0xd6, 0xb8, 0x02, 0x3e, 0x2b, 0x0e, 0x60, 0x4e, 0xc7, 0xf6, 0xb5, 0x0e, 0x80, 0xa9, 0x67, 0x8b, 0x89, 0xd2, 0x62, 0x8e, 0x99, 0xad, 0xa7, 0x7a, 0x57, 0x07, 0xc3, 0x21, 0xc8, 0x33, 0x61, 0x79, 0x3b, 0x9a, 0xf6, 0x2a, 0x40, 0xf4, 0x3b, 0x52, 0x3d, 0xf1, 0xc8, 0x63, 0x3c, 0xec, 0xb4, 0xcd, 0x14, 0xd0, 0x0b, 0xdc, 0x79, 0xc7, 0x8f, 0xca, 0x51, 0x65, 0xb8, 0x63, 0x89, 0x3f, 0x6d, 0x38, 0xb0, 0x2f, 0xf7, 0x23, 0x6c, 0x5a, 0x9a, 0x8a, 0xd2, 0xdb, 0xa8, 0x7d, 0x24, 0xc5, 0x47, 0xca, 0xb0, 0x46, 0xc2, 0x9f, 0xc5, 0xbc, 0x1e, 0xd1, 0x42, 0xe1, 0xde, 0x47, 0x63, 0x61, 0x3b, 0xb1, 0x62, 0xa5, 0xa5, 0x38, 0xe6, 0xef, 0x05, 0xed, 0x05, 0x19, 0x9d, 0x75, 0x1f, 0x9e, 0xb5, 0x8d, 0x33, 0x27, 0x91, 0xb8, 0xd7, 0x3f, 0xb7, 0x4e, 0x4f, 0xce, 0x95 }, { 0xb4, 0x28, 0x35, 0xe4, 0x0e, 0x9d, 0x4a, 0x7f, 0x42, 0xad, 0x8c, 0xc0, 0x4f, 0x85, 0xa9, 0x63, 0xa7, 0x6e, 0x18, 0x19, 0x83, 0x77, 0xed, 0x84, 0xad, 0xdd, 0xea, 0xec, 0xac, 0xc6, 0xf3, 0xfc, 0xa2, 0xf0, 0x1d, 0x52, 0x77, 0xd6, 0x9b, 0xb6, 0x81, 0xc7, 0x0f, 0xa8, 0xd3, 0x60, 0x94, 0xf7, 0x3e, 0xc0, 0x6e, 0x45, 0x2c, 0x80, 0xd2, 0xff, 0x22, 0x57, 0xed, 0x82, 0xe7, 0xba, 0x34, 0x84, 0x00, 0x98, 0x9a, 0x65, 0xee, 0x8d, 0xaa, 0x70, 0x94, 0xae, 0x09, 0x33, 0xe3, 0xd2, 0x21, 0x0a, 0xc6, 0x39, 0x5c, 0x4a, 0xf2, 0x4f, 0x91, 0xc2, 0xb5, 0x90, 0xef, 0x87, 0xd7, 0x78, 0x8d, 0x70, 0x66, 0xea, 0x3e, 0xae, 0xbc, 0xa4, 0xc0, 0x8a, 0x4f, 0x14, 0xb9, 0xa2, 0x76, 0x44, 0xf9, 0x90, 0x84, 0xc3, 0x54, 0x37, 0x11, 0xb6, 0x4a, 0x07, 0x0b, 0x94, 0xf2, 0xc9, 0xd1, 0xd8, 0xa9, 0x0d, 0x03, 0x5d, 0x52 } },
+	{ 7169, { 0xa0, 0x03, 0xfc, 0x7a, 0x51, 0x75, 0x4a, 0x9b, 0x3c, 0x7f, 0xae, 0x03, 0x67, 0xab, 0x3d, 0x78, 0x2d, 0xcc, 0xf2, 0x88, 0x55, 0xa0, 0x3d, 0x43, 0x5f, 0x8c, 0xfe, 0x74, 0x60, 0x5e, 0x78, 0x17, 0x98, 0xa8, 0xb2, 0x05, 0x34, 0xbe, 0x1c, 0xa9, 0xeb, 0x2a, 0xe2, 0xdf, 0x3f, 0xae, 0x2e, 0xa6, 0x0e, 0x48, 0xc6, 0xfb, 0x0b, 0x85, 0x0b, 0x13, 0x85, 0xb5, 0xde, 0x0f, 0xe4, 0x60, 0xdb, 0xe9, 0xd9, 0xf9, 0xb0, 0xd8, 0xdb, 0x44, 0x35, 0xda, 0x75, 0xc6, 0x01, 0x15, 0x6d, 0xf9, 0xd0, 0x47, 0xf4, 0xed, 0xe0, 0x08, 0x73, 0x2e, 0xb1, 0x7a, 0xdc, 0x05, 0xd9, 0x61, 0x80, 0xf8, 0xa7, 0x35, 0x48, 0x52, 0x28, 0x40, 0x77, 0x9e, 0x60, 0x62, 0xd6, 0x43, 0xb7, 0x94, 0x78, 0xa6, 0xe8, 0xdb, 0xce, 0x68, 0x92, 0x7f, 0x36, 0xeb, 0xf6, 0x76, 0xff, 0xa7, 0xd7, 0x2d, 0x5f, 0x68, 0xf0, 0x50, 0xb1, 0x19, 0xc8 }, { 0xed, 0x9b, 0x1a, 0x92, 0x2c, 0x04, 0x6f, 0xdb, 0x3d, 0x42, 0x3a, 0xe3, 0x4e, 0x14, 0x3b, 0x05, 0xca, 0x1b, 0xf2, 0x8b, 0x71, 0x04, 0x32, 0x85, 0x7b, 0xf7, 0x38, 0xbc, 0xed, 0xbf, 0xa5, 0x11, 0x3c, 0x9e, 0x28, 0xd7, 0x2f, 0xcb, 0xfc, 0x02, 0x08, 0x14, 0xce, 0x3f, 0x5d, 0x4f, 0xc8, 0x67, 0xf0, 0x1c, 0x8f, 0x5b, 0x6c, 0xaf, 0x30, 0x5b, 0x3e, 0xa8, 0xa8, 0xba, 0x2d, 0xa3, 0xab, 0x69, 0xfa, 0xbc, 0xb4, 0x38, 0xf1, 0x9f, 0xf1, 0x1f, 0x53, 0x78, 0xad, 0x44, 0x84, 0xd7, 0x5c, 0x47, 0x8d, 0xe4, 0x25, 0xfb, 0x8e, 0x6e, 0xe8, 0x09, 0xb5, 0x4e, 0xec, 0x9b, 0xdb, 0x18, 0x43, 0x15, 0xdc, 0x85, 0x66, 0x17, 0xc0, 0x9f, 0x53, 0x40, 0x45, 0x1b, 0xf4, 0x2f, 0xd3, 0x27, 0x0a, 0x7b, 0x0b, 0x65, 0x66, 0x16, 0x9f, 0x24, 0x2e, 0x53, 0x37, 0x77, 0x60, 0x4c, 0x11, 0x8a, 0x63, 0x58, 0x25, 0x0f, 0x54 } },
+	{ 8192, { 0xaa, 0xe7, 0x92, 0x48, 0x4c, 0x8e, 0xfe, 0x4f, 0x19, 0xe2, 0xca, 0x7d, 0x37, 0x1d, 0x8c, 0x46, 0x7f, 0xfb, 0x10, 0x74, 0x8d, 0x8a, 0x5a, 0x1a, 0xe5, 0x79, 0x94, 0x8f, 0x71, 0x8a, 0x2a, 0x63, 0x5f, 0xe5, 0x1a, 0x27, 0xdb, 0x04, 0x5a, 0x56, 0x7c, 0x1a, 0xd5, 0x1b, 0xe5, 0xaa, 0x34, 0xc0, 0x1c, 0x66, 0x51, 0xc4, 0xd9, 0xb5, 0xb5, 0xac, 0x5d, 0x0f, 0xd5, 0x8c, 0xf1, 0x8d, 0xd6, 0x1a, 0x47, 0x77, 0x85, 0x66, 0xb7, 0x97, 0xa8, 0xc6, 0x7d, 0xf7, 0xb1, 0xd6, 0x0b, 0x97, 0xb1, 0x92, 0x88, 0xd2, 0xd8, 0x77, 0xbb, 0x2d, 0xf4, 0x17, 0xac, 0xe0, 0x09, 0xdc, 0xb0, 0x24, 0x1c, 0xa1, 0x25, 0x7d, 0x62, 0x71, 0x2b, 0x6a, 0x40, 0x43, 0xb4, 0xff, 0x33, 0xf6, 0x90, 0xd8, 0x49, 0xda, 0x91, 0xea, 0x3b, 0xf7, 0x11, 0xed, 0x58, 0x3c, 0xb7, 0xb7, 0xa7, 0xda, 0x28, 0x39, 0xba, 0x71, 0x30, 0x9b, 0xbf }, { 0xdc, 0x96, 0x37, 0xc8, 0x84, 0x5a, 0x77, 0x0b, 0x4c, 0xbf, 0x76, 0xb8, 0xda, 0xec, 0x0e, 0xeb, 0xf7, 0xdc, 0x2e, 0xac, 0x11, 0x49, 0x85, 0x17, 0xf0, 0x8d, 0x44, 0xc8, 0xfc, 0x00, 0xd5, 0x8a, 0x48, 0x34, 0x46, 0x41, 0x59, 0xdc, 0xbc, 0x12, 0xa0, 0xba, 0x0c, 0x6d, 0x6e, 0xb4, 0x1b, 0xac, 0x0e, 0xd6, 0x58, 0x5c, 0xab, 0xfe, 0x0a, 0xca, 0x36, 0xa3, 0x75, 0xe6, 0xc5, 0x48, 0x0c, 0x22, 0xaf, 0xdc, 0x40, 0x78, 0x5c, 0x17, 0x0f, 0x5a, 0x6b, 0x8a, 0x11, 0x07, 0xdb, 0xee, 0x28, 0x23, 0x18, 0xd0, 0x0d, 0x91, 0x5a, 0xc9, 0xed, 0x11, 0x43, 0xad, 0x40, 0x76, 0x5e, 0xc1, 0x20, 0x04, 0x2e, 0xe1, 0x21, 0xcd, 0x2b, 0xaa, 0x36, 0x25, 0x0c, 0x61, 0x8a, 0xda, 0xf9, 0xe2, 0x72, 0x60, 0xfd, 0xa2, 0xf9, 0x4d, 0xea, 0x8f, 0xb6, 0xf0, 0x8c, 0x04, 0xf8, 0xf1, 0x0c, 0x78, 0x29, 0x2a, 0xa4, 0x61, 0x02 } },
+	{ 8193, { 0xba, 0xb6, 0xc0, 0x9c, 0xb8, 0xce, 0x8c, 0xf4, 0x59, 0x26, 0x13, 0x98, 0xd2, 0xe7, 0xae, 0xf3, 0x57, 0x00, 0xbf, 0x48, 0x81, 0x16, 0xce, 0xb9, 0x4a, 0x36, 0xd0, 0xf5, 0xf1, 0xb7, 0xbc, 0x3b, 0xb2, 0x28, 0x2a, 0xa6, 0x9b, 0xe0, 0x89, 0x35, 0x9e, 0xa1, 0x15, 0x4b, 0x9a, 0x92, 0x86, 0xc4, 0xa5, 0x6a, 0xf4, 0xde, 0x97, 0x5a, 0x9a, 0xa4, 0xa5, 0xc4, 0x97, 0x65, 0x49, 0x14, 0xd2, 0x79, 0xbe, 0xa6, 0x0b, 0xb6, 0xd2, 0xcf, 0x72, 0x25, 0xa2, 0xfa, 0x0f, 0xf5, 0xef, 0x56, 0xbb, 0xe4, 0xb1, 0x49, 0xf3, 0xed, 0x15, 0x86, 0x0f, 0x78, 0xb4, 0xe2, 0xad, 0x04, 0xe1, 0x58, 0xe3, 0x75, 0xc1, 0xe0, 0xc0, 0xb5, 0x51, 0xcd, 0x7d, 0xfc, 0x82, 0xf1, 0xb1, 0x55, 0xc1, 0x1b, 0x6b, 0x3e, 0xd5, 0x1e, 0xc9, 0xed, 0xb3, 0x0d, 0x13, 0x36, 0x53, 0xbb, 0x57, 0x09, 0xd1, 0xdb, 0xd5, 0x5f, 0x4e, 0x1f, 0xf6 }, { 0x95, 0x4a, 0x2a, 0x75, 0x42, 0x0c, 0x8d, 0x65, 0x47, 0xe3, 0xba, 0x5b, 0x98, 0xd9, 0x63, 0xe6, 0xfa, 0x64, 0x91, 0xad, 0xdc, 0x8c, 0x02, 0x31, 0x89, 0xcc, 0x51, 0x98, 0x21, 0xb4, 0xa1, 0xf5, 0xf0, 0x32, 0x28, 0x64, 0x8f, 0xd9, 0x83, 0xae, 0xf0, 0x45, 0xc2, 0xfa, 0x82, 0x90, 0x93, 0x4b, 0x08, 0x66, 0xb6, 0x15, 0xf5, 0x85, 0x14, 0x95, 0x87, 0xdd, 0xa2, 0x29, 0x90, 0x39, 0x96, 0x53, 0x28, 0x83, 0x5a, 0x2b, 0x18, 0xf1, 0xd6, 0x3b, 0x7e, 0x30, 0x0f, 0xc7, 0x6f, 0xf2, 0x60, 0xb5, 0x71, 0x83, 0x9f, 0xe4, 0x48, 0x76, 0xa4, 0xea, 0xe6, 0x6c, 0xba, 0xc8, 0xc6, 0x76, 0x94, 0x41, 0x1e, 0xd7, 0xe0, 0x9d, 0xf5, 0x10, 0x68, 0xa2, 0x2c, 0x6e, 0x67, 0xd6, 0xd3, 0xdd, 0x2c, 0xca, 0x8f, 0xf1, 0x2e, 0x32, 0x75, 0x38, 0x40, 0x06, 0xc8, 0x0f, 0x4d, 0xb6, 0x80, 0x23, 0xf2, 0x4e, 0xeb, 0xba, 0x57 } },
+	{ 16384, { 0xf8, 0x75, 0xd6, 0x64, 0x6d, 0xe2, 0x89, 0x85, 0x64, 0x6f, 0x34, 0xee, 0x13, 0xbe, 0x9a, 0x57, 0x6f, 0xd5, 0x15, 0xf7, 0x6b, 0x5b, 0x0a, 0x26, 0xbb, 0x32, 0x47, 0x35, 0x04, 0x1d, 0xdd, 0xe4, 0x9d, 0x76, 0x4c, 0x27, 0x01, 0x76, 0xe5, 0x3e, 0x97, 0xbd, 0xff, 0xa5, 0x8d, 0x54, 0x90, 0x73, 0xf2, 0xc6, 0x60, 0xbe, 0x0e, 0x81, 0x29, 0x37, 0x67, 0xed, 0x4e, 0x49, 0x29, 0xf9, 0xad, 0x34, 0xbb, 0xb3, 0x9a, 0x52, 0x93, 0x34, 0xc5, 0x7c, 0x4a, 0x38, 0x1f, 0xfd, 0x2a, 0x6d, 0x4b, 0xfd, 0xbf, 0x14, 0x82, 0x65, 0x1b, 0x17, 0x2a, 0xa8, 0x83, 0xcc, 0x13, 0x40, 0x8f, 0xa6, 0x77, 0x58, 0xa3, 0xe4, 0x75, 0x03, 0xf9, 0x3f, 0x87, 0x72, 0x0a, 0x31, 0x77, 0x32, 0x5f, 0x78, 0x23, 0x25, 0x1b, 0x85, 0x27, 0x5f, 0x64, 0x63, 0x6a, 0x8f, 0x1d, 0x59, 0x9c, 0x2e, 0x49, 0x72, 0x2f, 0x42, 0xe9, 0x38, 0x93 }, { 0x9e, 0x9f, 0xc4, 0xeb, 0x7c, 0xf0, 0x81, 0xea, 0x7c, 0x47, 0xd1, 0x80, 0x77, 0x90, 0xed, 0x21, 0x1b, 0xfe, 0xc5, 0x6a, 0xa2, 0x5b, 0xb7, 0x03, 0x77, 0x84, 0xc1, 0x3c, 0x4b, 0x70, 0x7b, 0x0d, 0xf9, 0xe6, 0x01, 0xb1, 0x01, 0xe4, 0xcf, 0x63, 0xa4, 0x04, 0xdf, 0xe5, 0x0f, 0x2e, 0x18, 0x65, 0xbb, 0x12, 0xed, 0xc8, 0xfc, 0xa1, 0x66, 0x57, 0x9c, 0xe0, 0xc7, 0x0d, 0xba, 0x5a, 0x5c, 0x0f, 0xc9, 0x60, 0xad, 0x6f, 0x37, 0x72, 0x18, 0x34, 0x16, 0xa0, 0x0b, 0xd2, 0x9d, 0x4c, 0x6e, 0x65, 0x1e, 0xa7, 0x62, 0x0b, 0xb1, 0x00, 0xc9, 0x44, 0x98, 0x58, 0xbf, 0x14, 0xe1, 0xdd, 0xc9, 0xec, 0xd3, 0x57, 0x25, 0x58, 0x1c, 0xa5, 0xb9, 0x16, 0x0d, 0xe0, 0x40, 0x60, 0x04, 0x59, 0x93, 0xd9, 0x72, 0x57, 0x1c, 0x3e, 0x8f, 0x71, 0xe9, 0xd0, 0x49, 0x6b, 0xfa, 0x74, 0x46, 0x56, 0x86, 0x1b, 0x16, 0x9d, 0x65 } },
+	{ 31744, { 0x62, 0xb6, 0x96, 0x0e, 0x1a, 0x44, 0xbc, 0xc1, 0xeb, 0x1a, 0x61, 0x1a, 0x8d, 0x62, 0x35, 0xb6, 0xb4, 0xb7, 0x8f, 0x32, 0xe7, 0xab, 0xc4, 0xfb, 0x4c, 0x6c, 0xdc, 0xce, 0x94, 0x89, 0x5c, 0x47, 0x86, 0x0c, 0xc5, 0x1f, 0x2b, 0x0c, 0x28, 0xa7, 0xb7, 0x73, 0x04, 0xbd, 0x55, 0xfe, 0x73, 0xaf, 0x66, 0x3c, 0x02, 0xd3, 0xf5, 0x2e, 0xa0, 0x53, 0xba, 0x43, 0x43, 0x1c, 0xa5, 0xba, 0xb7, 0xbf, 0xea, 0x2f, 0x5e, 0x9d, 0x71, 0x21, 0x77, 0x0d, 0x88, 0xf7, 0x0a, 0xe9, 0x64, 0x9e, 0xa7, 0x13, 0x08, 0x7d, 0x19, 0x14, 0xf7, 0xf3, 0x12, 0x14, 0x7e, 0x24, 0x7f, 0x87, 0xeb, 0x2d, 0x4f, 0xfe, 0xf0, 0xac, 0x97, 0x8b, 0xf7, 0xb6, 0x57, 0x9d, 0x57, 0xd5, 0x33, 0x35, 0x5a, 0xa2, 0x0b, 0x8b, 0x77, 0xb1, 0x3f, 0xd0, 0x97, 0x48, 0x72, 0x8a, 0x5c, 0xc3, 0x27, 0xa8, 0xec, 0x47, 0x0f, 0x40, 0x13, 0x22, 0x6f }, { 0xef, 0xa5, 0x3b, 0x38, 0x9a, 0xb6, 0x7c, 0x59, 0x3d, 0xba, 0x62, 0x4d, 0x89, 0x8d, 0x0f, 0x73, 0x53, 0xab, 0x99, 0xe4, 0xac, 0x9d, 0x42, 0x30, 0x2e, 0xe6, 0x4c, 0xbf, 0x99, 0x39, 0xa4, 0x19, 0x3a, 0x72, 0x58, 0xdb, 0x2d, 0x9c, 0xd3, 0x2a, 0x7a, 0x3e, 0xcf, 0xce, 0x46, 0x14, 0x41, 0x14, 0xb1, 0x5c, 0x2f, 0xcb, 0x68, 0xa6, 0x18, 0xa9, 0x76, 0xbd, 0x74, 0x51, 0x5d, 0x47, 0xbe, 0x08, 0xb6, 0x28, 0xbe, 0x42, 0x0b, 0x5e, 0x83, 0x0f, 0xad, 0xe7, 0xc0, 0x80, 0xe3, 0x51, 0xa0, 0x76, 0xfb, 0xc3, 0x86, 0x41, 0xad, 0x80, 0xc7, 0x36, 0xc8, 0xa1, 0x8f, 0xe3, 0xc6, 0x6c, 0xe1, 0x2f, 0x95, 0xc6, 0x1c, 0x24, 0x62, 0xa9, 0x77, 0x0d, 0x60, 0xd0, 0xf7, 0x71, 0x15, 0xbb, 0xcd, 0x37, 0x82, 0xb5, 0x93, 0x01, 0x6a, 0x4e, 0x72, 0x8d, 0x4c, 0x06, 0xce, 0xe4, 0x50, 0x5c, 0xb0, 0xc0, 0x8a, 0x42, 0xec } },
+	{ 102400, { 0xbc, 0x3e, 0x3d, 0x41, 0xa1, 0x14, 0x6b, 0x06, 0x9a, 0xbf, 0xfa, 0xd3, 0xc0, 0xd4, 0x48, 0x60, 0xcf, 0x66, 0x43, 0x90, 0xaf, 0xce, 0x4d, 0x96, 0x61, 0xf7, 0x90, 0x2e, 0x79, 0x43, 0xe0, 0x85, 0xe0, 0x1c, 0x59, 0xda, 0xb9, 0x08, 0xc0, 0x4c, 0x33, 0x42, 0xb8, 0x16, 0x94, 0x1a, 0x26, 0xd6, 0x9c, 0x26, 0x05, 0xeb, 0xee, 0x5e, 0xc5, 0x29, 0x1c, 0xc5, 0x5e, 0x15, 0xb7, 0x61, 0x46, 0xe6, 0x74, 0x5f, 0x06, 0x01, 0x15, 0x6c, 0x35, 0x96, 0xcb, 0x75, 0x06, 0x5a, 0x9c, 0x57, 0xf3, 0x55, 0x85, 0xa5, 0x2e, 0x1a, 0xc7, 0x0f, 0x69, 0x13, 0x1c, 0x23, 0xd6, 0x11, 0xce, 0x11, 0xee, 0x4a, 0xb1, 0xec, 0x2c, 0x00, 0x90, 0x12, 0xd2, 0x36, 0x64, 0x8e, 0x77, 0xbe, 0x92, 0x95, 0xdd, 0x04, 0x26, 0xf2, 0x9b, 0x76, 0x4d, 0x65, 0xde, 0x58, 0xeb, 0x7d, 0x01, 0xdd, 0x42, 0x24, 0x82, 0x04, 0xf4, 0x5f, 0x8e }, { 0x1c, 0x35, 0xd1, 0xa5, 0x81, 0x10, 0x83, 0xfd, 0x71, 0x19, 0xf5, 0xd5, 0xd1, 0xba, 0x02, 0x7b, 0x4d, 0x01, 0xc0, 0xc6, 0xc4, 0x9f, 0xb6, 0xff, 0x2c, 0xf7, 0x53, 0x93, 0xea, 0x5d, 0xb4, 0xa7, 0xf9, 0xdb, 0xdd, 0x3e, 0x1d, 0x81, 0xdc, 0xbc, 0xa3, 0xba, 0x24, 0x1b, 0xb1, 0x87, 0x60, 0xf2, 0x07, 0x71, 0x0b, 0x75, 0x18, 0x46, 0xfa, 0xae, 0xb9, 0xdf, 0xf8, 0x26, 0x27, 0x10, 0x99, 0x9a, 0x59, 0xb2, 0xaa, 0x1a, 0xca, 0x29, 0x8a, 0x03, 0x2d, 0x94, 0xea, 0xcf, 0xad, 0xf1, 0xaa, 0x19, 0x24, 0x18, 0xeb, 0x54, 0x80, 0x8d, 0xb2, 0x3b, 0x56, 0xe3, 0x42, 0x13, 0x26, 0x6a, 0xa0, 0x84, 0x99, 0xa1, 0x6b, 0x35, 0x4f, 0x01, 0x8f, 0xc4, 0x96, 0x7d, 0x05, 0xf8, 0xb9, 0xd2, 0xad, 0x87, 0xa7, 0x27, 0x83, 0x37, 0xbe, 0x96, 0x93, 0xfc, 0x63, 0x8a, 0x3b, 0xfd, 0xbe, 0x31, 0x45, 0x74, 0xee, 0x6f, 0xc4 } },
+};
+
+#endif
\ No newline at end of file
@@ -17,6 +17,17 @@ void test_poly1305(const poly1305_test_vector (&array)[N])
 			std::cerr << "poly1305 fail\n";
 			std::terminate();
 		}
+
+		//split so that the first piece ends inside a block
+		poly1305 mac_split(array[i].key);
+		mac_split.update(array[i].message, array[i].length / 3);
+		mac_split.update(array[i].message + array[i].length / 3, array[i].length - array[i].length / 3);
+		mac_split.final(mac);
+		if (!std::equal(mac, mac + poly1305::output_size, array[i].mac))
+		{
+			std::cerr << "poly1305 fail\n";
+			std::terminate();
+		}
 	}
 }
 
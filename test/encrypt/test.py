@@ -3,6 +3,11 @@
 import os
 import sys
 import glob
+import hashlib
+import time
+import shutil
+import socket
+import threading
 import platform
 import subprocess
 
@@ -28,7 +33,7 @@ if is_linux or is_darwin:
 elif is_windows:
 	sanitizers = [[]]
 out = ['-o', 'a.exe']
-source = ['../../program/encrypt/src/main.cpp'] + glob.glob('../../include/libencrypt/*.cpp')
+source = glob.glob('../../program/encrypt/src/*.cpp') + glob.glob('../../include/libencrypt/*.cpp')
 if not use_openssl:
 	source += glob.glob('../../include/crypto/*.cpp')
 if use_openssl:
@@ -79,6 +84,288 @@ def test_stdio():
 	if result2.stdout != block:
 		raise RuntimeError("test_stdio fail")
 
+def test_pipe():
+	data = os.urandom(1024 * 1024 * 4 + 1)
+	with open('chunk', 'wb') as f:
+		f.write(data)
+	#the reader is slower than the threads, so the chunks spliced into the pipe stay referenced for a while
+	process = subprocess.Popen(['./a.exe', '-e', '-i', 'chunk', '-k', 'argon2d,1,8,1', '-t', '4', '-b', '64K'], stdout=subprocess.PIPE, stderr=sys.stderr)
+	ciphertext = b''
+	while True:
+		block = process.stdout.read(4096)
+		if not block:
+			break
+		ciphertext += block
+		time.sleep(0.0001)
+	if process.wait() != 0:
+		raise RuntimeError("test_pipe fail")
+	result = subprocess.run(['./a.exe', '-d', '-k', 'argon2d,1,8,1'], input=ciphertext, stdout=subprocess.PIPE, stderr=sys.stderr, check=True)
+	if result.stdout != data:
+		raise RuntimeError("test_pipe fail")
+
+	#a relay that splices the output into a second pipe keeps referencing the pages after the first pipe is drained
+	if hasattr(os, 'splice'):
+		import fcntl
+		process = subprocess.Popen(['./a.exe', '-e', '-i', 'chunk', '-k', 'argon2d,1,8,1', '-t', '4', '-b', '64K'], stdout=subprocess.PIPE, stderr=sys.stderr)
+		r, w = os.pipe()
+		fcntl.fcntl(w, fcntl.F_SETPIPE_SZ, 1024 * 1024)
+		def relay():
+			while os.splice(process.stdout.fileno(), w, 1024 * 1024):
+				pass
+			os.close(w)
+		thread = threading.Thread(target=relay)
+		thread.start()
+		time.sleep(0.5)
+		ciphertext = b''
+		while True:
+			block = os.read(r, 65536)
+			if not block:
+				break
+			ciphertext += block
+		thread.join()
+		os.close(r)
+		if process.wait() != 0:
+			raise RuntimeError("test_pipe fail")
+		result = subprocess.run(['./a.exe', '-d', '-k', 'argon2d,1,8,1'], input=ciphertext, stdout=subprocess.PIPE, stderr=sys.stderr, check=True)
+		if result.stdout != data:
+			raise RuntimeError("test_pipe fail")
+	os.remove('chunk')
+
+def test_chunk_size():
+	data = os.urandom(1024 * 1024 + 1)
+	with open('chunk', 'wb') as f:
+		f.write(data)
+	for size in ['64', '4K', '3M']:
+		subprocess.run(['./a.exe', '-e', '-i', 'chunk', '-o', 'ciphertext', '-k', 'argon2d,1,8,1', '-b', size], stderr=sys.stderr, check=True)
+		subprocess.run(['./a.exe', '-d', '-i', 'ciphertext', '-o', 'plaintext', '-k', 'argon2d,1,8,1', '-b', '4K'], stderr=sys.stderr, check=True)
+		with open('plaintext', 'rb') as f:
+			if f.read() != data:
+				raise RuntimeError("test_chunk_size fail")
+	os.remove('chunk')
+
+def test_max_memory():
+	data = os.urandom(1024 * 1024 + 1)
+	with open('chunk', 'wb') as f:
+		f.write(data)
+	arg = ['-k', 'argon2d,1,8,1', '-t', '8', '-b', '8M', '--max-memory', '512K']
+	subprocess.run(['./a.exe', '-e', '-i', 'chunk', '-o', 'ciphertext'] + arg, stderr=sys.stderr, check=True)
+	subprocess.run(['./a.exe', '-d', '-i', 'ciphertext', '-o', 'plaintext'] + arg, stderr=sys.stderr, check=True)
+	with open('plaintext', 'rb') as f:
+		if f.read() != data:
+			raise RuntimeError("test_max_memory fail")
+	os.remove('chunk')
+
+	result = subprocess.run(['./a.exe', '-e', '-i', 'zero', '-o', 'ciphertext', '-k', 'argon2d,1,4096,1', '--max-memory', '1M'], stderr=subprocess.PIPE)
+	if (result.returncode == 0) or ('max_memory' not in result.stderr.decode()):
+		raise RuntimeError("test_max_memory fail")
+
+def test_blake2p():
+	data = os.urandom(1024 * 1024 + 12345)
+	with open('chunk', 'wb') as f:
+		f.write(data)
+	for mac in ['blake2bp', 'blake2sp', 'blake2bp,blake2sp']:
+		arg = ['-k', 'argon2d,1,8,1', '-m', mac, '-t', '3', '-b', '4K']
+		subprocess.run(['./a.exe', '-e', '-i', 'chunk', '-o', 'ciphertext'] + arg, stderr=sys.stderr, check=True)
+		subprocess.run(['./a.exe', '-d', '-i', 'ciphertext', '-o', 'plaintext'] + arg, stderr=sys.stderr, check=True)
+		with open('plaintext', 'rb') as f:
+			if f.read() != data:
+				raise RuntimeError("test_blake2p fail")
+	os.remove('chunk')
+
+def test_blake3():
+	data = os.urandom(1024 * 1024 + 12345)
+	with open('chunk', 'wb') as f:
+		f.write(data)
+	for size in ['4K', '64K', '192']:
+		arg = ['-k', 'argon2d,1,8,1', '-m', 'blake3', '-t', '4', '-b', size]
+		subprocess.run(['./a.exe', '-e', '-i', 'chunk', '-o', 'ciphertext'] + arg, stderr=sys.stderr, check=True)
+		subprocess.run(['./a.exe', '-d', '-i', 'ciphertext', '-o', 'plaintext'] + arg, stderr=sys.stderr, check=True)
+		with open('plaintext', 'rb') as f:
+			if f.read() != data:
+				raise RuntimeError("test_blake3 fail")
+
+	digests = []
+	for size in ['4K', '192']:
+		result = subprocess.run(['./a.exe', '-e', '-i', 'chunk', '-o', 'ciphertext', '-k', 'argon2d,1,8,1', '-t', '4', '-b', size, '--digest', 'plaintext:blake3'], stderr=subprocess.PIPE, check=True)
+		digests.append(result.stderr.decode().split('\n')[0])
+	if digests[0] != digests[1] or not digests[0].startswith('plaintext blake3 '):
+		raise RuntimeError("test_blake3 fail")
+	os.remove('chunk')
+
+def test_kmac():
+	data = os.urandom(1024 * 1024 + 12345)
+	with open('chunk', 'wb') as f:
+		f.write(data)
+	macs = ['kmac256'] if use_openssl else ['kmac256', 'parallelhash256']
+	#encrypted with blocks of leaves hashed by the threads, decrypted with chunks that don't start at a block
+	for mac in macs:
+		for size1, size2 in [('64K', '192'), ('8K', '8K'), ('192', '24K')]:
+			arg = ['-k', 'argon2d,1,8,1', '-m', mac, '-t', '4']
+			subprocess.run(['./a.exe', '-e', '-i', 'chunk', '-o', 'ciphertext', '-b', size1] + arg, stderr=sys.stderr, check=True)
+			subprocess.run(['./a.exe', '-d', '-i', 'ciphertext', '-o', 'plaintext', '-b', size2] + arg, stderr=sys.stderr, check=True)
+			with open('plaintext', 'rb') as f:
+				if f.read() != data:
+					raise RuntimeError("test_kmac fail")
+	os.remove('chunk')
+
+def test_affinity():
+	block = b'\0' * 1024 * 1024 * 3
+	for mode in ['cores', 'cpus']:
+		arg = ['-k', 'argon2d,1,8,1', '-t', 'auto', '-b', '64K', '--affinity', mode]
+		result1 = subprocess.run(['./a.exe', '-e'] + arg, input=block, stdout=subprocess.PIPE, stderr=sys.stderr, check=True)
+		result2 = subprocess.run(['./a.exe', '-d'] + arg, input=result1.stdout, stdout=subprocess.PIPE, stderr=sys.stderr, check=True)
+		if result2.stdout != block:
+			raise RuntimeError("test_affinity fail")
+
+	#the files of a batch run at once with a thread each, pinned to different CPUs
+	files = {str(i): os.urandom(1024 * 1024 + i) for i in range(8)}
+	os.makedirs('affinity', exist_ok=True)
+	for name, data in files.items():
+		with open(os.path.join('affinity', name), 'wb') as f:
+			f.write(data)
+	arg = ['-k', 'argon2d,1,8,1', '-t', '4', '-b', '64K', '--affinity', 'cpus']
+	subprocess.run(['./a.exe', '-e', '--batch', 'affinity', '-o', 'affinity_ciphertext'] + arg, stderr=sys.stderr, check=True)
+	subprocess.run(['./a.exe', '-d', '--batch', 'affinity_ciphertext', '-o', 'affinity_plaintext'] + arg, stderr=sys.stderr, check=True)
+	for name, data in files.items():
+		with open(os.path.join('affinity_plaintext', name), 'rb') as f:
+			if f.read() != data:
+				raise RuntimeError("test_affinity fail")
+	for i in ['affinity', 'affinity_ciphertext', 'affinity_plaintext']:
+		shutil.rmtree(i)
+
+def test_page_cache():
+	data = os.urandom(1024 * 1024 * 20 + 1)
+	with open('chunk', 'wb') as f:
+		f.write(data)
+	arg = ['-k', 'argon2d,1,8,1', '-t', '2', '--page-cache', 'drop']
+	subprocess.run(['./a.exe', '-e', '-i', 'chunk', '-o', 'ciphertext'] + arg, stderr=sys.stderr, check=True)
+	subprocess.run(['./a.exe', '-d', '-i', 'ciphertext', '-o', 'plaintext'] + arg, stderr=sys.stderr, check=True)
+	with open('plaintext', 'rb') as f:
+		if f.read() != data:
+			raise RuntimeError("test_page_cache fail")
+	os.remove('chunk')
+
+def test_volume():
+	data = os.urandom(1024 * 1024 * 3 + 1)
+	with open('chunk', 'wb') as f:
+		f.write(data)
+	volumes = ['volume0', 'volume1', 'volume2']
+	arg = ['-k', 'argon2d,1,8,1', '-t', '4', '-b', '64K']
+	subprocess.run(['./a.exe', '-e', '-i', 'chunk'] + sum([['--volume', i] for i in volumes], []) + arg, stderr=sys.stderr, check=True)
+	subprocess.run(['./a.exe', '-d', '-o', 'plaintext'] + sum([['--volume', i] for i in reversed(volumes)], []) + arg, stderr=sys.stderr, check=True)
+	with open('plaintext', 'rb') as f:
+		if f.read() != data:
+			raise RuntimeError("test_volume fail")
+	subprocess.run(['./a.exe', '-d', '--verify-volume', 'volume1', '-k', 'argon2d,1,8,1'], stdout=subprocess.PIPE, stderr=sys.stderr, check=True)
+	with open('volume1', 'r+b') as f:
+		f.seek(1000)
+		byte = f.read(1)
+		f.seek(1000)
+		f.write(bytes([byte[0] ^ 1]))
+	if subprocess.run(['./a.exe', '-d', '--verify-volume', 'volume1', '-k', 'argon2d,1,8,1'], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL).returncode == 0:
+		raise RuntimeError("test_volume tamper fail")
+	for i in ['chunk'] + volumes:
+		os.remove(i)
+
+def test_shard():
+	data = os.urandom(1024 * 1024 * 3 + 1)
+	with open('chunk', 'wb') as f:
+		f.write(data)
+	with open('salt', 'wb') as f:
+		f.write(os.urandom(32))
+	shards = ['shard0', 'shard1', 'shard2', 'shard3']
+	arg = ['-k', 'argon2d,1,8,1', '-t', '2', '-b', '64K']
+	for i, name in enumerate(shards):
+		subprocess.run(['./a.exe', '-e', '-i', 'chunk', '-o', name, '--range', '{},1M'.format(i * 1024 * 1024), '--salt', 'salt'] + arg, stderr=sys.stderr, check=True)
+	subprocess.run(['./a.exe', '-d', '-o', 'plaintext'] + sum([['--shard', i] for i in reversed(shards)], []) + arg, stderr=sys.stderr, check=True)
+	with open('plaintext', 'rb') as f:
+		if f.read() != data:
+			raise RuntimeError("test_shard fail")
+	subprocess.run(['./a.exe', '-d'] + sum([['--verify-shard', i] for i in shards], []) + ['-k', 'argon2d,1,8,1'], stdout=subprocess.PIPE, stderr=sys.stderr, check=True)
+	if subprocess.run(['./a.exe', '-d', '-o', 'plaintext', '--shard', 'shard0', '--shard', 'shard2', '--shard', 'shard3'] + arg, stderr=subprocess.DEVNULL).returncode == 0:
+		raise RuntimeError("test_shard missing shard fail")
+	with open('shard1', 'r+b') as f:
+		f.seek(1000)
+		byte = f.read(1)
+		f.seek(1000)
+		f.write(bytes([byte[0] ^ 1]))
+	if subprocess.run(['./a.exe', '-d'] + sum([['--verify-shard', i] for i in shards], []) + ['-k', 'argon2d,1,8,1'], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL).returncode == 0:
+		raise RuntimeError("test_shard tamper fail")
+	for i in ['chunk', 'salt'] + shards:
+		os.remove(i)
+
+def test_digest():
+	data = os.urandom(1024 * 1024 * 3 + 1)
+	with open('chunk', 'wb') as f:
+		f.write(data)
+	result = subprocess.run(['./a.exe', '-e', '-i', 'chunk', '-o', 'ciphertext', '-k', 'argon2d,1,8,1', '-t', '4', '-b', '64K', '--digest', 'plaintext:sha256', '--digest', 'ciphertext:sha512'], stderr=subprocess.PIPE, check=True)
+	with open('ciphertext', 'rb') as f:
+		ciphertext = f.read()
+	if result.stderr.decode().split('\n')[:2] != ['plaintext sha256 ' + hashlib.sha256(data).hexdigest(), 'ciphertext sha512 ' + hashlib.sha512(ciphertext).hexdigest()]:
+		raise RuntimeError("test_digest fail")
+	os.remove('chunk')
+
+def test_batch():
+	files = {'a': os.urandom(3000), 'empty': b'', os.path.join('sub', 'b'): os.urandom(1024 * 1024 + 1)}
+	os.makedirs(os.path.join('batch', 'sub'), exist_ok=True)
+	for name, data in files.items():
+		with open(os.path.join('batch', name), 'wb') as f:
+			f.write(data)
+
+	arg = ['-k', 'argon2d,1,8,1', '-t', '2']
+	subprocess.run(['./a.exe', '-e', '--batch', 'batch', '-o', 'batch_ciphertext'] + arg, stderr=sys.stderr, check=True)
+	subprocess.run(['./a.exe', '-d', '--batch', 'batch_ciphertext', '-o', 'batch_plaintext'] + arg, stderr=sys.stderr, check=True)
+	for name, data in files.items():
+		with open(os.path.join('batch_plaintext', name), 'rb') as f:
+			if f.read() != data:
+				raise RuntimeError("test_batch fail")
+
+def test_agent():
+	agent = subprocess.Popen(['./a.exe', '--agent', 'agent.sock', '-k', 'argon2d,1,8,1', '-t', '2'], stderr=sys.stderr)
+	try:
+		for _ in range(600):
+			try:
+				with socket.socket(socket.AF_UNIX, socket.SOCK_STREAM) as s:
+					s.connect('agent.sock')
+				break
+			except OSError:
+				time.sleep(0.1)
+		if os.stat('agent.sock').st_mode & 0o777 != 0o600:
+			raise RuntimeError("test_agent fail")
+
+		data = os.urandom(1024 * 1024 + 1)
+		result1 = subprocess.run(['./a.exe', '-e', '--connect', 'agent.sock'], input=data, stdout=subprocess.PIPE, stderr=sys.stderr, check=True)
+		result2 = subprocess.run(['./a.exe', '-d', '--connect', 'agent.sock'], input=result1.stdout, stdout=subprocess.PIPE, stderr=sys.stderr, check=True)
+		if result2.stdout != data:
+			raise RuntimeError("test_agent fail")
+
+		subprocess.run(['./a.exe', '-d', '--connect', 'agent.sock', '-i', os.path.join('batch_ciphertext', 'a'), '-o', 'plaintext'], stderr=sys.stderr, check=True)
+		with open(os.path.join('batch', 'a'), 'rb') as f1, open('plaintext', 'rb') as f2:
+			if f1.read() != f2.read():
+				raise RuntimeError("test_agent fail")
+
+		#files of two other salts decrypted at once, the requests of one salt share its key
+		subprocess.run(['./a.exe', '-e', '--batch', 'batch', '-o', 'batch_ciphertext2', '-k', 'argon2d,1,8,1'], stderr=sys.stderr, check=True)
+		names = [(d, n) for d in ['batch_ciphertext', 'batch_ciphertext2'] for n in ['a', os.path.join('sub', 'b')]]
+		clients = [subprocess.Popen(['./a.exe', '-d', '--connect', 'agent.sock', '-i', os.path.join(d, n)], stdout=subprocess.PIPE, stderr=sys.stderr) for d, n in names]
+		for (d, n), client in zip(names, clients):
+			output = client.communicate()[0]
+			with open(os.path.join('batch', n), 'rb') as f:
+				if client.returncode != 0 or f.read() != output:
+					raise RuntimeError("test_agent fail")
+	finally:
+		agent.terminate()
+		agent.wait()
+	os.remove('agent.sock')
+
+	#only a socket is replaced
+	with open('plaintext', 'wb') as f:
+		f.write(b'keep')
+	result = subprocess.run(['./a.exe', '--agent', 'plaintext', '-k', 'argon2d,1,8,1'], stderr=subprocess.PIPE, timeout=60)
+	with open('plaintext', 'rb') as f:
+		if result.returncode == 0 or f.read() != b'keep':
+			raise RuntimeError("test_agent fail")
+
 #----------------------------------------------------------------------------------------------------
 
 block = b'\0' * 1024 * 1024
@@ -93,8 +380,24 @@ for compiler in compilers:
 		test_decrypt()
 		test_encrypt()
 		test_mac()
+		test_chunk_size()
+		test_max_memory()
+		if not use_openssl:
+			test_blake2p()
+			test_blake3()
+		test_kmac()
+		test_volume()
+		test_shard()
+		test_digest()
+		test_batch()
 		if is_linux or is_darwin:
 			test_stdio()
+			test_pipe()
+			test_affinity()
+			test_page_cache()
+			test_agent()
 
 for i in ['a.exe', 'zero', 'plaintext', 'ciphertext']:
-	os.remove(i)
\ No newline at end of file
+	os.remove(i)
+for i in ['batch', 'batch_ciphertext', 'batch_ciphertext2', 'batch_plaintext']:
+	shutil.rmtree(i)
\ No newline at end of file
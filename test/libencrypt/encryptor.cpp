@@ -0,0 +1,120 @@
+#include<iostream>
+#include<cstdio>
+#include<algorithm>
+#include<exception>
+#include<stdexcept>
+#include<vector>
+#include<libencrypt/encrypt.h>
+
+using namespace libencrypt;
+
+void check(bool ok, const char* str)
+{
+	if (!ok)
+	{
+		std::cerr << str;
+		std::terminate();
+	}
+}
+
+//the pieces are never a multiple of the block size of a cipher or a MAC
+template<typename Stream>
+std::vector<byte> stream(Stream& s, const std::vector<byte>& input)
+{
+	constexpr size_t pieces[] = { 1, 7, 63, 65, 1000, 4097, 3 };
+	std::vector<byte> output(input.size());
+	for (size_t i = 0, j = 0; i < input.size(); j++)
+	{
+		const size_t length = std::min(pieces[j % std::size(pieces)], input.size() - i);
+		s.update(input.data() + i, output.data() + i, length);
+		i += length;
+	}
+	return output;
+}
+
+std::vector<byte> encrypt_file(const std::vector<byte>& plaintext, kdf_parameter& parameter, const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list)
+{
+	std::FILE* input = std::tmpfile();
+	std::FILE* output = std::tmpfile();
+	std::fwrite(plaintext.data(), 1, plaintext.size(), input);
+	std::rewind(input);
+	encrypt(input, output, kdf_algorithm::argon2d, parameter, cipher_list, mac_list, 2);
+
+	std::vector<byte> result(std::ftell(output));
+	std::rewind(output);
+	check(std::fread(result.data(), 1, result.size(), output) == result.size(), "encrypt_file read fail\n");
+	std::fclose(input);
+	std::fclose(output);
+	return result;
+}
+
+template<typename Stream>
+bool throws_after_final(Stream& s)
+{
+	byte buf[1] = {};
+	try
+	{
+		s.update(buf, buf, 1);
+	}
+	catch (const std::runtime_error&)
+	{
+		return true;
+	}
+	return false;
+}
+
+void test_encryptor(const std::vector<cipher_algorithm>& cipher_list, const std::vector<mac_algorithm>& mac_list)
+{
+	const byte password[] = { 'p', 'a', 's', 's' };
+	std::vector<byte> plaintext(200000);
+	for (size_t i = 0; i < plaintext.size(); i++)
+		plaintext[i] = static_cast<byte>(i * 7 % 251);
+
+	//the salt of the caller is copied, so it may go away after the constructor
+	std::vector<byte> salt(32, 0x5a);
+	argon2_parameter parameter({ password, sizeof(password) }, { salt.data(), salt.size() }, {}, 1, 8, 1);
+	encryptor enc(kdf_algorithm::argon2d, parameter, cipher_list, mac_list);
+	salt.assign(32, 0);
+	const_array enc_salt = enc.salt();
+	check(enc_salt.length == 32 && std::all_of(enc_salt.data, enc_salt.data + 32, [](byte b) { return b == 0x5a; }), "encryptor salt fail\n");
+
+	std::vector<byte> ciphertext = stream(enc, plaintext);
+	std::vector<byte> tag(enc.tag_size());
+	enc.final(tag.data());
+	check(throws_after_final(enc), "encryptor update after final fail\n");
+
+	//with the salt given, encrypt() writes ciphertext || mac
+	salt.assign(32, 0x5a);
+	parameter.salt = { salt.data(), salt.size() };
+	std::vector<byte> file = encrypt_file(plaintext, parameter, cipher_list, mac_list);
+	check(file.size() == ciphertext.size() + tag.size(), "encryptor file size fail\n");
+	check(std::equal(ciphertext.begin(), ciphertext.end(), file.begin()) && std::equal(tag.begin(), tag.end(), file.begin() + ciphertext.size()), "encryptor file fail\n");
+
+	decryptor dec(kdf_algorithm::argon2d, parameter, cipher_list, mac_list);
+	check(stream(dec, ciphertext) == plaintext, "decryptor fail\n");
+	dec.final(tag.data());
+	check(throws_after_final(dec), "decryptor update after final fail\n");
+
+	tag[0] ^= 1;
+	decryptor tampered(kdf_algorithm::argon2d, parameter, cipher_list, mac_list);
+	stream(tampered, ciphertext);
+	bool thrown = false;
+	try
+	{
+		tampered.final(tag.data());
+	}
+	catch (const std::runtime_error&)
+	{
+		thrown = true;
+	}
+	check(thrown, "decryptor tag mismatch fail\n");
+}
+
+int main()
+{
+	test_encryptor({ cipher_algorithm::aes_128_ctr }, { mac_algorithm::hmac_sha256 });
+	test_encryptor({ cipher_algorithm::aes_256_ctr, cipher_algorithm::chacha20 }, { mac_algorithm::hmac_sha512, mac_algorithm::poly1305 });
+	test_encryptor({ cipher_algorithm::chacha20 }, { mac_algorithm::poly1305 });
+
+	return 0;
+}
\ No newline at end of file
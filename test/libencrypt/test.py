@@ -0,0 +1,48 @@
+#!/usr/bin/python3
+
+import os
+import sys
+import glob
+import platform
+import subprocess
+
+is_linux = platform.system() == 'Linux'
+is_windows = platform.system() == 'Windows'
+is_darwin = platform.system() == 'Darwin'
+use_openssl = len(sys.argv) >= 2 and sys.argv[1] == 'use_openssl'
+
+if is_linux:
+	compilers = ['g++', 'clang++']
+elif is_darwin or is_windows:
+	compilers = ['clang++']
+standard = ['-x', 'c++', '-std=c++17']
+warning = ['-w']
+macro = ['-D', 'libencrypt_use_openssl'] if use_openssl else []
+include = ['-I../../include']
+if is_linux or is_darwin:
+	optimization =  ['-O3', '-flto']
+elif is_windows:
+	optimization =  ['-O3', '-flto', '-fuse-ld=lld']
+if is_linux or is_darwin:
+	sanitizers = [['-fsanitize=address', '-fsanitize=undefined']]
+elif is_windows:
+	sanitizers = [[]]
+out = ['-o', 'a.exe']
+source = glob.glob('../../include/libencrypt/*.cpp')
+if not use_openssl:
+	source += glob.glob('../../include/crypto/*.cpp')
+if use_openssl:
+	opt = sys.argv[2:] if len(sys.argv) >= 3 else ['-lcrypto']
+else:
+	opt = []
+
+
+files = glob.glob('./*.cpp')
+for compiler in compilers:
+	for file in files:
+		for sanitizer in sanitizers:
+			command = [compiler] + standard + warning + macro + include + optimization + sanitizer + out + source + [file] + opt
+			subprocess.run(command, stdout=sys.stdout, stderr=sys.stderr, check=True)
+			subprocess.run('./a.exe', stderr=sys.stderr, check=True)
+
+os.remove('a.exe')
\ No newline at end of file